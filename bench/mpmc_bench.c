@@ -0,0 +1,162 @@
+/**
+* @file
+* @brief Measures contention behaviour of bounded multi-producer/multi-consumer queues.
+* @details Compares mutex + condition variable protected ring buffer
+*          against lock-free MPMC queue with equal amount of producers and consumers.
+*
+* Usage: mpmc_bench [records] [max threads]
+*/
+
+#include "mpmc.h"
+#include "ring.h"
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+typedef struct
+{
+    uint64_t seq;
+    uint64_t payload;
+}
+record_t;
+
+typedef struct
+{
+    ring_t *ring;
+    pthread_mutex_t lock;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+}
+locked_queue_t;
+
+typedef struct
+{
+    bool lock_free;
+    size_t per_thread;
+    locked_queue_t locked;
+    mpmc_t *mpmc;
+}
+bench_t;
+
+static const size_t queue_cap = 1024;
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void locked_push(locked_queue_t *q, const record_t *record)
+{
+    pthread_mutex_lock(&q->lock);
+    while (ring_size(q->ring) == queue_cap)
+    {
+        pthread_cond_wait(&q->not_full, &q->lock);
+    }
+    ring_push_back(&q->ring, record);
+    pthread_cond_signal(&q->not_empty);
+    pthread_mutex_unlock(&q->lock);
+}
+
+static void locked_pop(locked_queue_t *q, record_t *record)
+{
+    pthread_mutex_lock(&q->lock);
+    while (RING_EMPTY == ring_pop_front(q->ring, record))
+    {
+        pthread_cond_wait(&q->not_empty, &q->lock);
+    }
+    pthread_cond_signal(&q->not_full);
+    pthread_mutex_unlock(&q->lock);
+}
+
+static void *producer(void *param)
+{
+    bench_t *b = param;
+    for (size_t i = 0; i < b->per_thread; ++i)
+    {
+        const record_t record = {.seq = i, .payload = i * 7};
+        if (b->lock_free) mpmc_push(b->mpmc, &record);
+        else locked_push(&b->locked, &record);
+    }
+    return NULL;
+}
+
+static void *consumer(void *param)
+{
+    bench_t *b = param;
+    volatile uint64_t sink = 0;
+    for (size_t i = 0; i < b->per_thread; ++i)
+    {
+        record_t record;
+        if (b->lock_free) mpmc_pop(b->mpmc, &record);
+        else locked_pop(&b->locked, &record);
+        sink += record.payload;
+    }
+    (void) sink;
+    return NULL;
+}
+
+static double run(bench_t *b, const size_t threads)
+{
+    pthread_t *ids = malloc(2 * threads * sizeof(pthread_t));
+    const double start = now();
+
+    for (size_t i = 0; i < threads; ++i)
+    {
+        pthread_create(&ids[2 * i], NULL, producer, b);
+        pthread_create(&ids[2 * i + 1], NULL, consumer, b);
+    }
+    for (size_t i = 0; i < 2 * threads; ++i)
+    {
+        pthread_join(ids[i], NULL);
+    }
+
+    const double elapsed = now() - start;
+    free(ids);
+    return b->per_thread * threads / elapsed;
+}
+
+int main(int argc, char **argv)
+{
+    const size_t records = argc > 1 ? strtoul(argv[1], NULL, 10) : 4000000;
+    const size_t max_threads = argc > 2 ? strtoul(argv[2], NULL, 10) : 64;
+
+    bench_t b = {
+        .locked = {
+            .ring = ring_create(.element_size = sizeof(record_t), .initial_cap = queue_cap),
+            .lock = PTHREAD_MUTEX_INITIALIZER,
+            .not_empty = PTHREAD_COND_INITIALIZER,
+            .not_full = PTHREAD_COND_INITIALIZER,
+        },
+        .mpmc = mpmc_create(.element_size = sizeof(record_t), .capacity = queue_cap),
+    };
+
+    if (!b.locked.ring || !b.mpmc)
+    {
+        fprintf(stderr, "allocation failed\n");
+        return 1;
+    }
+
+    printf("records: %zu, queue capacity: %zu\n", records, queue_cap);
+    printf("%8s %16s %16s\n", "threads", "mutex Mrec/s", "mpmc Mrec/s");
+
+    for (size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        b.per_thread = records / threads;
+
+        b.lock_free = false;
+        const double locked = run(&b, threads);
+        b.lock_free = true;
+        const double lock_free = run(&b, threads);
+
+        printf("%8zu %16.2f %16.2f\n", threads, locked / 1e6, lock_free / 1e6);
+    }
+
+    ring_destroy(b.locked.ring);
+    mpmc_destroy(b.mpmc);
+    return 0;
+}
@@ -0,0 +1,198 @@
+/**
+* @file
+* @brief Measures throughput of passing fixed-size records between two threads.
+* @details Compares mutex protected ring buffer against lock-free SPSC queue
+*          with single element and batched operations.
+*
+* Usage: spsc_bench [records] [batch] [producer cpu] [consumer cpu]
+*/
+
+#define _GNU_SOURCE /* pthread_setaffinity_np */
+
+#include "ring.h"
+#include "spsc.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+typedef struct
+{
+    uint64_t seq;
+    uint64_t payload;
+}
+record_t;
+
+typedef enum
+{
+    MODE_MUTEX,
+    MODE_SPSC,
+    MODE_SPSC_BATCH,
+}
+bench_mode_t;
+
+typedef struct
+{
+    bench_mode_t mode;
+    size_t records;
+    size_t batch;
+    int cpu;
+    ring_t *ring;
+    pthread_mutex_t lock;
+    spsc_t *spsc;
+}
+bench_t;
+
+static const size_t queue_cap = 4096;
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void pin(const int cpu)
+{
+#if defined(__linux__)
+    if (cpu < 0) return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void) cpu;
+#endif
+}
+
+static void *producer(void *param)
+{
+    bench_t *b = param;
+    pin(b->cpu);
+    record_t batch[256];
+
+    for (size_t i = 0; i < b->records;)
+    {
+        size_t n = 0;
+        for (; n < b->batch && i + n < b->records; ++n)
+        {
+            batch[n] = (record_t){.seq = i + n, .payload = (i + n) * 3};
+        }
+
+        size_t sent = 0;
+        while (sent < n)
+        {
+            size_t done = 0;
+            switch (b->mode)
+            {
+                case MODE_MUTEX:
+                    pthread_mutex_lock(&b->lock);
+                    if (ring_size(b->ring) < queue_cap)
+                    {
+                        ring_push_back(&b->ring, &batch[sent]);
+                        done = 1;
+                    }
+                    pthread_mutex_unlock(&b->lock);
+                    break;
+
+                case MODE_SPSC:
+                    done = spsc_try_push(b->spsc, &batch[sent]);
+                    break;
+
+                case MODE_SPSC_BATCH:
+                    done = spsc_publish(b->spsc, &batch[sent], n - sent);
+                    break;
+            }
+            if (!done) sched_yield();
+            sent += done;
+        }
+        i += n;
+    }
+    return NULL;
+}
+
+static double run(bench_t *b, const int consumer_cpu)
+{
+    pthread_t thread;
+    record_t batch[256];
+    uint64_t expected = 0;
+
+    const double start = now();
+    pthread_create(&thread, NULL, producer, b);
+    pin(consumer_cpu);
+
+    while (expected < b->records)
+    {
+        size_t got = 0;
+        switch (b->mode)
+        {
+            case MODE_MUTEX:
+                pthread_mutex_lock(&b->lock);
+                got = (RING_SUCCESS == ring_pop_front(b->ring, batch));
+                pthread_mutex_unlock(&b->lock);
+                break;
+
+            case MODE_SPSC:
+                got = spsc_try_pop(b->spsc, batch);
+                break;
+
+            case MODE_SPSC_BATCH:
+                got = spsc_consume(b->spsc, batch, b->batch);
+                break;
+        }
+
+        if (!got) sched_yield();
+        for (size_t i = 0; i < got; ++i)
+        {
+            if (batch[i].seq != expected++)
+            {
+                fprintf(stderr, "order violation\n");
+                exit(1);
+            }
+        }
+    }
+
+    pthread_join(thread, NULL);
+    return b->records / (now() - start);
+}
+
+int main(int argc, char **argv)
+{
+    const size_t records = argc > 1 ? strtoul(argv[1], NULL, 10) : 10000000;
+    size_t batch = argc > 2 ? strtoul(argv[2], NULL, 10) : 64;
+    const int producer_cpu = argc > 3 ? atoi(argv[3]) : -1;
+    const int consumer_cpu = argc > 4 ? atoi(argv[4]) : -1;
+    if (batch == 0 || batch > 256) batch = 64;
+
+    bench_t b = {
+        .records = records,
+        .batch = batch,
+        .cpu = producer_cpu,
+        .ring = ring_create(.element_size = sizeof(record_t), .initial_cap = queue_cap),
+        .lock = PTHREAD_MUTEX_INITIALIZER,
+        .spsc = spsc_create(.element_size = sizeof(record_t), .capacity = queue_cap),
+    };
+
+    if (!b.ring || !b.spsc)
+    {
+        fprintf(stderr, "allocation failed\n");
+        return 1;
+    }
+
+    printf("records: %zu, record size: %zu, batch: %zu\n", records, sizeof(record_t), batch);
+
+    b.mode = MODE_MUTEX;
+    printf("mutex ring:       %8.2f Mrec/s\n", run(&b, consumer_cpu) / 1e6);
+    b.mode = MODE_SPSC;
+    printf("spsc single:      %8.2f Mrec/s\n", run(&b, consumer_cpu) / 1e6);
+    b.mode = MODE_SPSC_BATCH;
+    printf("spsc batched:     %8.2f Mrec/s\n", run(&b, consumer_cpu) / 1e6);
+
+    ring_destroy(b.ring);
+    spsc_destroy(b.spsc);
+    pthread_mutex_destroy(&b.lock);
+    return 0;
+}
@@ -0,0 +1,173 @@
+/**
+* @file
+* @brief Measures last level cache pollution caused by bulk vector operations.
+* @details Victim thread repeatedly scans a cache resident working set,
+*          while aggressor thread initializes and copies a large vector
+*          using regular (temporal) and streaming (non-temporal) stores.
+*          Less pollution results in higher victim scan rate.
+*
+* Usage: stream_bench [working set KiB] [bulk MiB] [seconds per run]
+*/
+
+#include "vector.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+typedef enum
+{
+    OP_ZERO,
+    OP_FILL,
+    OP_COPY,
+}
+op_t;
+
+typedef struct
+{
+    op_t op;
+    bool streaming;
+    vector_t *bulk;
+    char *out;
+    atomic_bool stop;
+    size_t aggressor_bytes;
+    size_t victim_passes;
+    const long *working_set;
+    size_t working_set_len;
+}
+bench_t;
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void *victim(void *param)
+{
+    bench_t *b = param;
+    volatile long sink = 0;
+    while (!atomic_load_explicit(&b->stop, memory_order_relaxed))
+    {
+        long acc = 0;
+        for (size_t i = 0; i < b->working_set_len; i += 8) /* one load per cache line */
+        {
+            acc += b->working_set[i];
+        }
+        sink += acc;
+        ++b->victim_passes;
+    }
+    (void) sink;
+    return NULL;
+}
+
+static void *aggressor(void *param)
+{
+    bench_t *b = param;
+    const size_t capacity = vector_capacity(b->bulk);
+    const long value = 0x5a5a5a5a;
+
+    while (!atomic_load_explicit(&b->stop, memory_order_relaxed))
+    {
+        switch (b->op)
+        {
+            case OP_ZERO:
+                if (b->streaming) vector_zero_range(b->bulk, 0, capacity);
+                else memset(vector_data(b->bulk), 0x00, vector_capacity_bytes(b->bulk));
+                break;
+
+            case OP_FILL:
+                vector_set(b->bulk, 0, &value);
+                if (b->streaming) vector_fill_range(b->bulk, 0, capacity, &value);
+                else vector_spread(b->bulk, 0, capacity);
+                break;
+
+            case OP_COPY:
+                if (b->streaming) vector_stream_copy(b->bulk, b->out, 0, capacity);
+                else vector_copy(b->bulk, b->out, 0, capacity);
+                break;
+        }
+        b->aggressor_bytes += vector_capacity_bytes(b->bulk);
+    }
+    return NULL;
+}
+
+static void run(bench_t *b, const char *name, const double seconds)
+{
+    pthread_t v, a;
+    atomic_store(&b->stop, false);
+    b->aggressor_bytes = 0;
+    b->victim_passes = 0;
+
+    pthread_create(&v, NULL, victim, b);
+    pthread_create(&a, NULL, aggressor, b);
+
+    const double start = now();
+    struct timespec ts = {.tv_sec = (time_t)seconds, .tv_nsec = (long)((seconds - (time_t)seconds) * 1e9)};
+    nanosleep(&ts, NULL);
+    atomic_store(&b->stop, true);
+
+    pthread_join(a, NULL);
+    pthread_join(v, NULL);
+    const double elapsed = now() - start;
+
+    printf("%-5s %-9s victim: %10.1f scans/s   aggressor: %6.2f GiB/s\n",
+            name, b->streaming ? "streaming" : "temporal",
+            b->victim_passes / elapsed,
+            b->aggressor_bytes / elapsed / (1024.0 * 1024.0 * 1024.0));
+}
+
+int main(int argc, char **argv)
+{
+    const size_t ws_kib = argc > 1 ? strtoul(argv[1], NULL, 10) : 4 * 1024;
+    const size_t bulk_mib = argc > 2 ? strtoul(argv[2], NULL, 10) : 256;
+    const double seconds = argc > 3 ? strtod(argv[3], NULL) : 2.0;
+
+    const size_t ws_len = ws_kib * 1024 / sizeof(long);
+    long *working_set = malloc(ws_len * sizeof(long));
+    vector_t *bulk = vector_create(.element_size = sizeof(long),
+            .initial_cap = bulk_mib * 1024 * 1024 / sizeof(long));
+    char *out = malloc(bulk_mib * 1024 * 1024);
+
+    if (!working_set || !bulk || !out)
+    {
+        fprintf(stderr, "allocation failed\n");
+        return 1;
+    }
+
+    for (size_t i = 0; i < ws_len; ++i) working_set[i] = (long)i;
+    vector_zero_range(bulk, 0, vector_capacity(bulk));
+    memset(out, 0x00, bulk_mib * 1024 * 1024);
+
+    printf("working set: %zu KiB, bulk: %zu MiB, threshold: %d bytes\n",
+            ws_kib, bulk_mib, VECTOR_STREAM_THRESHOLD);
+
+    bench_t b = {
+        .bulk = bulk,
+        .out = out,
+        .working_set = working_set,
+        .working_set_len = ws_len,
+    };
+
+    const struct { op_t op; const char *name; } ops[] = {
+        {OP_ZERO, "zero"}, {OP_FILL, "fill"}, {OP_COPY, "copy"},
+    };
+
+    for (size_t i = 0; i < sizeof(ops)/sizeof(ops[0]); ++i)
+    {
+        b.op = ops[i].op;
+        b.streaming = false;
+        run(&b, ops[i].name, seconds);
+        b.streaming = true;
+        run(&b, ops[i].name, seconds);
+    }
+
+    vector_destroy(bulk);
+    free(out);
+    free(working_set);
+    return 0;
+}
@@ -0,0 +1,146 @@
+/**
+* @file
+* @brief Measures deduplication and run-length encoding of sorted vectors.
+* @details Sorted vectors of 4 byte keys are generated with high and low duplicate ratios,
+*          then compacted with a naive vector_get/vector_set loop, with
+*          @ref vector_unique through a user comparator and through its bytewise fast path,
+*          and encoded with @ref vector_run_length.
+*
+* Usage: unique_bench [elements] [repetitions]
+*/
+
+#include "vector.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+typedef enum
+{
+    OP_NAIVE,
+    OP_CALLBACK,
+    OP_BYTEWISE,
+    OP_RUN_LENGTH,
+}
+op_t;
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static ssize_t cmp_u32(const void *value, const void *element, void *param)
+{
+    (void) param;
+    const uint32_t a = *(const uint32_t *)value, b = *(const uint32_t *)element;
+    return (a > b) - (a < b);
+}
+
+static size_t naive_unique(vector_t *vector, const size_t limit)
+{
+    size_t dest = 1;
+    for (size_t i = 1; i < limit; ++i)
+    {
+        if (cmp_u32(vector_get(vector, i), vector_get(vector, dest - 1), NULL))
+        {
+            vector_set(vector, dest++, vector_get(vector, i));
+        }
+    }
+    return dest;
+}
+
+static void generate(uint32_t *keys, const size_t length, const size_t run)
+{
+    /* sorted keys, each repeated about `run` times */
+    uint32_t key = 0;
+    for (size_t i = 0; i < length; ++i)
+    {
+        if (0 == rand() % run) ++key;
+        keys[i] = key;
+    }
+}
+
+static void run(const char *name, op_t op, vector_t *vector, const uint32_t *keys,
+        const size_t length, const size_t repetitions)
+{
+    vector_t *values = vector_create(.element_size = sizeof(uint32_t), .initial_cap = length);
+    vector_t *counts = vector_create(.element_size = sizeof(size_t), .initial_cap = length);
+    double elapsed = 0.0;
+    size_t result = 0;
+
+    for (size_t r = 0; r < repetitions; ++r)
+    {
+        memcpy(vector_data(vector), keys, length * sizeof(uint32_t));
+
+        const double start = now();
+        switch (op)
+        {
+            case OP_NAIVE:
+                result = naive_unique(vector, length);
+                break;
+
+            case OP_CALLBACK:
+                result = vector_unique(vector, length, cmp_u32, NULL);
+                break;
+
+            case OP_BYTEWISE:
+                result = vector_unique(vector, length, cmp_lex_asc, (void *)sizeof(uint32_t));
+                break;
+
+            case OP_RUN_LENGTH:
+                vector_run_length(vector, length, cmp_lex_asc, (void *)sizeof(uint32_t), &values, &counts, &result);
+                break;
+        }
+        elapsed += now() - start;
+    }
+
+    printf("  %-10s %10zu distinct   %8.2f Melem/s\n",
+            name, result, length * repetitions / elapsed / 1e6);
+
+    vector_destroy(counts);
+    vector_destroy(values);
+}
+
+int main(int argc, char **argv)
+{
+    const size_t length = argc > 1 ? strtoul(argv[1], NULL, 10) : 16 * 1024 * 1024;
+    const size_t repetitions = argc > 2 ? strtoul(argv[2], NULL, 10) : 5;
+
+    uint32_t *keys = malloc(length * sizeof(uint32_t));
+    vector_t *vector = vector_create(.element_size = sizeof(uint32_t), .initial_cap = length);
+
+    if (!keys || !vector)
+    {
+        fprintf(stderr, "allocation failed\n");
+        return 1;
+    }
+
+    const struct { size_t run; const char *name; } ratios[] = {
+        {64, "high duplicate ratio (runs of ~64)"},
+        {2, "low duplicate ratio (runs of ~2)"},
+    };
+
+    const struct { op_t op; const char *name; } ops[] = {
+        {OP_NAIVE, "naive"}, {OP_CALLBACK, "callback"}, {OP_BYTEWISE, "bytewise"}, {OP_RUN_LENGTH, "rle"},
+    };
+
+    srand(1);
+    for (size_t i = 0; i < sizeof(ratios)/sizeof(ratios[0]); ++i)
+    {
+        generate(keys, length, ratios[i].run);
+        printf("%s, %zu elements\n", ratios[i].name, length);
+
+        for (size_t j = 0; j < sizeof(ops)/sizeof(ops[0]); ++j)
+        {
+            run(ops[j].name, ops[j].op, vector, keys, length, repetitions);
+        }
+    }
+
+    vector_destroy(vector);
+    free(keys);
+    return 0;
+}
@@ -0,0 +1,91 @@
+#define _GNU_SOURCE /* mremap */
+
+#include "vector.h"
+#include <sys/mman.h>
+#include <stdio.h>
+#include <assert.h>
+
+#define MMAP_ALLOC &(alloc_t){0}
+
+typedef struct alloc
+{
+    size_t size;
+}
+alloc_t;
+
+int main(void)
+{
+    vector_t *vector = vector_create (
+        .element_size = sizeof(int),
+        .initial_cap = 1024 * 1024,
+        .zero_init = true,
+        .alloc_opts = alloc_opts(
+            .size = sizeof(alloc_t),
+            .data = MMAP_ALLOC,
+        ),
+    );
+
+    assert(vector && "mmap failed");
+
+    // grown pages are fresh anonymous pages, no memset involved
+    if (VECTOR_SUCCESS != vector_resize_zeroed(&vector, 16 * 1024 * 1024, VECTOR_ALLOC_ERROR))
+    {
+        perror("mremap");
+    }
+
+    assert(0 == *(int*)vector_get(vector, vector_capacity(vector) - 1));
+
+    // ...
+
+    vector_destroy(vector);
+    return 0;
+}
+
+void *vector_alloc(const size_t alloc_size, void *const param)
+{
+    assert(param);
+    alloc_t *alloc = (alloc_t*)param;
+    void *ptr = mmap(NULL, alloc_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (MAP_FAILED == ptr)
+    {
+        return NULL;
+    }
+    alloc->size = alloc_size;
+    return ptr;
+}
+
+void *vector_calloc(const size_t alloc_size, void *const param)
+{
+    // anonymous mappings are zero initialized
+    return vector_alloc(alloc_size, param);
+}
+
+void *vector_realloc(void *const ptr, const size_t alloc_size, void *const param)
+{
+    assert(ptr);
+    assert(param);
+    alloc_t *alloc = (alloc_t*)param;
+    const size_t old_size = alloc->size;
+
+    alloc->size = alloc_size; // param lives inside the mapping, moved along with it
+    void *new = mremap(ptr, old_size, alloc_size, MREMAP_MAYMOVE);
+    if (MAP_FAILED == new)
+    {
+        alloc->size = old_size;
+        return NULL;
+    }
+    return new;
+}
+
+void *vector_realloc_zeroed(void *const ptr, const size_t old_size, const size_t alloc_size, void *const param)
+{
+    (void) old_size;
+    // mremap extends anonymous mapping with zero pages
+    return vector_realloc(ptr, alloc_size, param);
+}
+
+void vector_free(void *const ptr, void *const param)
+{
+    assert(param);
+    munmap(ptr, ((alloc_t*)param)->size);
+}
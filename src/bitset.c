@@ -0,0 +1,391 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Implementation of the dense bitset
+*/
+
+#include "bitset.h"
+
+#include <assert.h> /** assert */
+#include <stdint.h> /** uint64_t */
+#include <string.h> /** memset */
+
+#if defined(__AVX2__)
+#include <immintrin.h> /** _mm256_and_si256, _mm256_shuffle_epi8 */
+#elif defined(__SSE2__)
+#include <emmintrin.h> /** _mm_and_si128 */
+#endif
+
+/**
+ * @internal
+ * @brief Bits per word.
+ */
+#define WORD_BITS 64
+
+/**
+ * @internal
+ * @brief Bitset state stored in vector's extension header.
+ */
+typedef struct bitset_header_t
+{
+    size_t bits; /**< @brief Amount of bits. */
+}
+bitset_header_t;
+
+/**
+ * @internal
+ * @brief Bulk binary operations.
+ */
+typedef enum bitset_op_t
+{
+    OP_AND,
+    OP_OR,
+    OP_XOR,
+    OP_ANDNOT,
+}
+bitset_op_t;
+
+/*                             *
+* === Forward Declarations === *
+*                             */
+
+/**
+* @brief   Access bitset state.
+*/
+static bitset_header_t *get_bitset_header(const bitset_t *const bitset);
+
+/**
+* @brief   Access words.
+*/
+static uint64_t *get_words(const bitset_t *const bitset);
+
+/**
+* @brief   Amount of words holding @c bits.
+*/
+static size_t word_count(const size_t bits);
+
+/**
+* @brief   Clears bits past the size in the last word.
+*/
+static void trim_tail(bitset_t *const bitset);
+
+/**
+* @brief   Applies binary operation word by word.
+*/
+static void apply_op(bitset_t *const dest, const bitset_t *const src, const bitset_op_t op);
+
+/**
+* @brief   Counts set bits in a span of words.
+*/
+static size_t popcount_words(const uint64_t *words, size_t count);
+
+
+/*                             *
+* === API Implementation   === *
+*                             */
+
+bitset_t *bitset_create_(const bitset_opts_t *const opts)
+{
+    assert(opts && "non-null opts required!");
+
+    /* pad extension header so words start on a word boundary of the region */
+    const size_t ext_header_size = calc_aligned_size(opts->alloc_opts.size + sizeof(bitset_header_t), sizeof(uint64_t))
+        - opts->alloc_opts.size;
+
+    vector_t *vector = vector_create_(&(vector_opts_t) {
+        .alloc_opts = opts->alloc_opts,
+        .ext_header_size = ext_header_size,
+        .element_size = sizeof(uint64_t),
+        .initial_cap = word_count(opts->bits),
+        .zero_init = true,
+    });
+
+    if (!vector)
+    {
+        return NULL;
+    }
+
+    *(bitset_header_t *) vector_get_ext_header(vector) = (bitset_header_t) {
+        .bits = opts->bits,
+    };
+    return (bitset_t *) vector;
+}
+
+
+void bitset_destroy(bitset_t *const bitset)
+{
+    assert(bitset);
+    vector_destroy((vector_t *) bitset);
+}
+
+
+size_t bitset_size(const bitset_t *const bitset)
+{
+    assert(bitset);
+    return get_bitset_header(bitset)->bits;
+}
+
+
+vector_status_t bitset_resize(bitset_t **const bitset, const size_t bits, const vector_status_t error)
+{
+    assert(bitset && *bitset);
+
+    vector_t *vector = (vector_t *) *bitset;
+    const size_t words = word_count(bits);
+
+    if (words != vector_capacity(vector))
+    {
+        vector_status_t status = vector_resize_zeroed(&vector, words, error);
+        if (VECTOR_SUCCESS != status)
+        {
+            return status;
+        }
+        *bitset = (bitset_t *) vector;
+    }
+
+    get_bitset_header(*bitset)->bits = bits;
+    trim_tail(*bitset);
+    return VECTOR_SUCCESS;
+}
+
+
+void bitset_set(bitset_t *const bitset, const size_t index)
+{
+    assert(bitset);
+    assert((index < bitset_size(bitset)) && "Index out of bitset bounds!");
+    get_words(bitset)[index / WORD_BITS] |= (uint64_t)1 << (index % WORD_BITS);
+}
+
+
+void bitset_clear(bitset_t *const bitset, const size_t index)
+{
+    assert(bitset);
+    assert((index < bitset_size(bitset)) && "Index out of bitset bounds!");
+    get_words(bitset)[index / WORD_BITS] &= ~((uint64_t)1 << (index % WORD_BITS));
+}
+
+
+void bitset_flip(bitset_t *const bitset, const size_t index)
+{
+    assert(bitset);
+    assert((index < bitset_size(bitset)) && "Index out of bitset bounds!");
+    get_words(bitset)[index / WORD_BITS] ^= (uint64_t)1 << (index % WORD_BITS);
+}
+
+
+bool bitset_test(const bitset_t *const bitset, const size_t index)
+{
+    assert(bitset);
+    assert((index < bitset_size(bitset)) && "Index out of bitset bounds!");
+    return (get_words(bitset)[index / WORD_BITS] >> (index % WORD_BITS)) & 1;
+}
+
+
+void bitset_fill(bitset_t *const bitset, const bool value)
+{
+    assert(bitset);
+    memset(get_words(bitset), value ? 0xFF : 0, word_count(bitset_size(bitset)) * sizeof(uint64_t));
+    trim_tail(bitset);
+}
+
+
+size_t bitset_count(const bitset_t *const bitset)
+{
+    assert(bitset);
+    return popcount_words(get_words(bitset), word_count(bitset_size(bitset)));
+}
+
+
+ssize_t bitset_find_first(const bitset_t *const bitset)
+{
+    assert(bitset);
+
+    const uint64_t *words = get_words(bitset);
+    const size_t count = word_count(bitset_size(bitset));
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (words[i])
+        {
+            return (ssize_t) (i * WORD_BITS + (size_t) __builtin_ctzll(words[i]));
+        }
+    }
+    return -1;
+}
+
+
+ssize_t bitset_find_next(const bitset_t *const bitset, const size_t index)
+{
+    assert(bitset);
+
+    const size_t next = index + 1;
+    if (next >= bitset_size(bitset))
+    {
+        return -1;
+    }
+
+    const uint64_t *words = get_words(bitset);
+    const size_t count = word_count(bitset_size(bitset));
+    size_t i = next / WORD_BITS;
+
+    /* mask out bits before next in its word */
+    uint64_t word = words[i] & (~(uint64_t)0 << (next % WORD_BITS));
+    for (;;)
+    {
+        if (word)
+        {
+            return (ssize_t) (i * WORD_BITS + (size_t) __builtin_ctzll(word));
+        }
+        if (++i == count)
+        {
+            return -1;
+        }
+        word = words[i];
+    }
+}
+
+
+void bitset_and(bitset_t *const dest, const bitset_t *const src)
+{
+    apply_op(dest, src, OP_AND);
+}
+
+
+void bitset_or(bitset_t *const dest, const bitset_t *const src)
+{
+    apply_op(dest, src, OP_OR);
+}
+
+
+void bitset_xor(bitset_t *const dest, const bitset_t *const src)
+{
+    apply_op(dest, src, OP_XOR);
+}
+
+
+void bitset_andnot(bitset_t *const dest, const bitset_t *const src)
+{
+    apply_op(dest, src, OP_ANDNOT);
+}
+
+
+/*                        **
+* === Static Functions === *
+*                         */
+
+static bitset_header_t *get_bitset_header(const bitset_t *const bitset)
+{
+    return (bitset_header_t *) vector_get_ext_header((const vector_t *) bitset);
+}
+
+
+static uint64_t *get_words(const bitset_t *const bitset)
+{
+    return (uint64_t *) vector_data((const vector_t *) bitset);
+}
+
+
+static size_t word_count(const size_t bits)
+{
+    return (bits + WORD_BITS - 1) / WORD_BITS;
+}
+
+
+static void trim_tail(bitset_t *const bitset)
+{
+    const size_t bits = bitset_size(bitset);
+    if (bits % WORD_BITS)
+    {
+        get_words(bitset)[bits / WORD_BITS] &= ((uint64_t)1 << (bits % WORD_BITS)) - 1;
+    }
+}
+
+
+static void apply_op(bitset_t *const dest, const bitset_t *const src, const bitset_op_t op)
+{
+    assert(dest);
+    assert(src);
+    assert((bitset_size(dest) == bitset_size(src)) && "Bitsets must be of the same size!");
+
+    uint64_t *a = get_words(dest);
+    const uint64_t *b = get_words(src);
+    const size_t count = word_count(bitset_size(dest));
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m256i x = _mm256_loadu_si256((const __m256i *) (a + i));
+        const __m256i y = _mm256_loadu_si256((const __m256i *) (b + i));
+        __m256i r;
+        switch (op)
+        {
+            case OP_AND:    r = _mm256_and_si256(x, y); break;
+            case OP_OR:     r = _mm256_or_si256(x, y); break;
+            case OP_XOR:    r = _mm256_xor_si256(x, y); break;
+            case OP_ANDNOT: r = _mm256_andnot_si256(y, x); break;
+            default:        r = x; break;
+        }
+        _mm256_storeu_si256((__m256i *) (a + i), r);
+    }
+#elif defined(__SSE2__)
+    for (; i + 2 <= count; i += 2)
+    {
+        const __m128i x = _mm_loadu_si128((const __m128i *) (a + i));
+        const __m128i y = _mm_loadu_si128((const __m128i *) (b + i));
+        __m128i r;
+        switch (op)
+        {
+            case OP_AND:    r = _mm_and_si128(x, y); break;
+            case OP_OR:     r = _mm_or_si128(x, y); break;
+            case OP_XOR:    r = _mm_xor_si128(x, y); break;
+            case OP_ANDNOT: r = _mm_andnot_si128(y, x); break;
+            default:        r = x; break;
+        }
+        _mm_storeu_si128((__m128i *) (a + i), r);
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        switch (op)
+        {
+            case OP_AND:    a[i] &= b[i]; break;
+            case OP_OR:     a[i] |= b[i]; break;
+            case OP_XOR:    a[i] ^= b[i]; break;
+            case OP_ANDNOT: a[i] &= ~b[i]; break;
+        }
+    }
+}
+
+
+static size_t popcount_words(const uint64_t *words, size_t count)
+{
+    size_t total = 0;
+
+#if defined(__AVX2__)
+    /* nibble lookup, byte counts are summed with sad against zero */
+    const __m256i lut = _mm256_setr_epi8(
+            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low_mask = _mm256_set1_epi8(0x0F);
+    __m256i acc = _mm256_setzero_si256();
+
+    for (; count >= 4; count -= 4, words += 4)
+    {
+        const __m256i v = _mm256_loadu_si256((const __m256i *) words);
+        const __m256i lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(v, low_mask));
+        const __m256i hi = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask));
+        acc = _mm256_add_epi64(acc, _mm256_sad_epu8(_mm256_add_epi8(lo, hi), _mm256_setzero_si256()));
+    }
+
+    total += (size_t) _mm256_extract_epi64(acc, 0) + (size_t) _mm256_extract_epi64(acc, 1)
+           + (size_t) _mm256_extract_epi64(acc, 2) + (size_t) _mm256_extract_epi64(acc, 3);
+#endif
+
+    for (; count; --count, ++words)
+    {
+        total += (size_t) __builtin_popcountll(*words);
+    }
+    return total;
+}
@@ -0,0 +1,204 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Public interface of the dense bitset
+*/
+
+#ifndef _BITSET_H_
+#define _BITSET_H_
+
+#include "vector.h"
+
+/**
+* @brief   Dense bitset derived from @ref vector_t.
+* @details Bits are packed into 64 bit words stored as vector's elements,
+*          amount of bits is kept in the extension header.
+*          Bits past the size in the last word are always zero.
+*          Bulk operations process words with AVX2 or SSE2 where available.
+*          Functions that can grow the bitset take a double pointer.
+*/
+typedef struct bitset_t bitset_t;
+
+/**
+* @brief   Bitset options.
+* @details Parameters that are passed to a @ref bitset_create_ function.
+*/
+typedef struct bitset_opts_t
+{
+    alloc_opts_t alloc_opts;  /**< @brief optional allocator */
+    /* optional: */
+    size_t bits;              /**< @brief Amount of bits, all cleared. */
+}
+bitset_opts_t;
+
+/**
+ * @addtogroup Bitset_API Bitset API
+ * @brief      Dense bitset methods. @{ */
+
+/**
+* @brief   Bitset constructor.
+* @details Preferable way to invoke bitset constructor.
+* @see bitset_create_
+*/
+#define bitset_create(...) \
+    bitset_create_( \
+        &(bitset_opts_t) { \
+            __VA_ARGS__ \
+        }\
+    )\
+
+/**
+* @brief   Bitset constructor.
+*
+* @param[in] opts Options according to which bitset will be created.
+* @returns        Fresh new bitset with all bits cleared or @c NULL if allocation failed.
+*/
+bitset_t *bitset_create_(const bitset_opts_t *const opts);
+
+
+/**
+* @brief   Deallocates bitset.
+*
+* @param[in] bitset Bitset pointer that will be deallocated.
+*/
+void bitset_destroy(bitset_t *const bitset);
+
+
+/**
+* @brief   Reports amount of bits.
+*
+* @param[in] bitset Pointer to a bitset instance.
+* @returns          Amount of bits in the bitset.
+*/
+size_t bitset_size(const bitset_t *const bitset);
+
+
+/**
+* @brief   Changes amount of bits.
+* @details Added bits are cleared.
+*
+* @param[in] bitset Reference to bitset pointer.
+* @param[in] bits   New amount of bits.
+* @param[in] error  Status returned when allocation fails.
+* @returns          @ref VECTOR_SUCCESS or @c error, bitset is left intact on failure.
+*/
+vector_status_t bitset_resize(bitset_t **const bitset, const size_t bits, const vector_status_t error);
+
+
+/**
+* @brief   Sets bit at @c index.
+*
+* @param[in] bitset Pointer to a bitset instance.
+* @param[in] index  Bit position.
+*/
+void bitset_set(bitset_t *const bitset, const size_t index);
+
+
+/**
+* @brief   Clears bit at @c index.
+*
+* @param[in] bitset Pointer to a bitset instance.
+* @param[in] index  Bit position.
+*/
+void bitset_clear(bitset_t *const bitset, const size_t index);
+
+
+/**
+* @brief   Flips bit at @c index.
+*
+* @param[in] bitset Pointer to a bitset instance.
+* @param[in] index  Bit position.
+*/
+void bitset_flip(bitset_t *const bitset, const size_t index);
+
+
+/**
+* @brief   Tests bit at @c index.
+*
+* @param[in] bitset Pointer to a bitset instance.
+* @param[in] index  Bit position.
+* @returns          @c true if bit is set.
+*/
+bool bitset_test(const bitset_t *const bitset, const size_t index);
+
+
+/**
+* @brief   Sets or clears all bits.
+*
+* @param[in] bitset Pointer to a bitset instance.
+* @param[in] value  @c true to set, @c false to clear.
+*/
+void bitset_fill(bitset_t *const bitset, const bool value);
+
+
+/**
+* @brief   Counts set bits.
+*
+* @param[in] bitset Pointer to a bitset instance.
+* @returns          Amount of set bits.
+*/
+size_t bitset_count(const bitset_t *const bitset);
+
+
+/**
+* @brief   Finds first set bit.
+*
+* @param[in] bitset Pointer to a bitset instance.
+* @returns          Position of the first set bit or @c -1 if none.
+*/
+ssize_t bitset_find_first(const bitset_t *const bitset);
+
+
+/**
+* @brief   Finds next set bit after @c index.
+* @details Together with @ref bitset_find_first iterates over set bits.
+*
+* @param[in] bitset Pointer to a bitset instance.
+* @param[in] index  Position to search after.
+* @returns          Position of the next set bit or @c -1 if none.
+*/
+ssize_t bitset_find_next(const bitset_t *const bitset, const size_t index);
+
+
+/**
+* @brief   Intersection, @c dest &= @c src.
+* @warning Bitsets must be of the same size.
+*
+* @param[in,out] dest Bitset to be modified.
+* @param[in]     src  Second operand.
+*/
+void bitset_and(bitset_t *const dest, const bitset_t *const src);
+
+
+/**
+* @brief   Union, @c dest |= @c src.
+* @warning Bitsets must be of the same size.
+*
+* @param[in,out] dest Bitset to be modified.
+* @param[in]     src  Second operand.
+*/
+void bitset_or(bitset_t *const dest, const bitset_t *const src);
+
+
+/**
+* @brief   Symmetric difference, @c dest ^= @c src.
+* @warning Bitsets must be of the same size.
+*
+* @param[in,out] dest Bitset to be modified.
+* @param[in]     src  Second operand.
+*/
+void bitset_xor(bitset_t *const dest, const bitset_t *const src);
+
+
+/**
+* @brief   Difference, @c dest &= ~@c src.
+* @warning Bitsets must be of the same size.
+*
+* @param[in,out] dest Bitset to be modified.
+* @param[in]     src  Second operand.
+*/
+void bitset_andnot(bitset_t *const dest, const bitset_t *const src);
+
+/** @} @noop Bitset_API */
+
+#endif/*_BITSET_H_*/
@@ -0,0 +1,271 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Implementation of the chunked vector
+*/
+
+#include "chunkvec.h"
+
+#include <assert.h> /** assert */
+
+/**
+ * @internal
+ * @brief Chunked vector state stored in block index extension header.
+ */
+typedef struct chunkvec_header_t
+{
+    size_t blocks;       /**< @brief Amount of allocated blocks. */
+    size_t block_shift;  /**< @brief Binary logarithm of block capacity. */
+    size_t element_size; /**< @brief Size of the stored element type. */
+}
+chunkvec_header_t;
+
+/*                             *
+* === Forward Declarations === *
+*                             */
+
+/**
+* @brief   Access chunked vector state.
+*/
+static chunkvec_header_t *get_chunkvec_header(const chunkvec_t *const chunkvec);
+
+/**
+* @brief   Access block pointer stored in the index.
+*/
+static vector_t **get_block_ref(const chunkvec_t *const chunkvec, const size_t block);
+
+/**
+* @brief   Amount of elements of a block covered by first @c limit elements.
+*/
+static size_t block_limit(const chunkvec_header_t *const header, const size_t block, const size_t limit);
+
+
+/*                             *
+* === API Implementation   === *
+*                             */
+
+chunkvec_t *chunkvec_create_(const chunkvec_opts_t *const opts)
+{
+    assert(opts && "non-null opts required!");
+    assert(opts->element_size && "'element_size' gt then zero required!");
+
+    size_t block_shift = 0;
+    while (((size_t)1 << block_shift) < opts->block_cap) ++block_shift;
+
+    vector_t *index = vector_create_(&(vector_opts_t) {
+        .alloc_opts = opts->alloc_opts,
+        .ext_header_size = sizeof(chunkvec_header_t),
+        .element_size = sizeof(vector_t *),
+    });
+
+    if (!index)
+    {
+        return NULL;
+    }
+
+    *(chunkvec_header_t *) vector_get_ext_header(index) = (chunkvec_header_t) {
+        .block_shift = block_shift,
+        .element_size = opts->element_size,
+    };
+
+    chunkvec_t *chunkvec = (chunkvec_t *) index;
+    if (opts->initial_cap && VECTOR_SUCCESS != chunkvec_resize(&chunkvec, opts->initial_cap, VECTOR_ALLOC_ERROR))
+    {
+        chunkvec_destroy(chunkvec);
+        return NULL;
+    }
+
+    return chunkvec;
+}
+
+
+void chunkvec_destroy(chunkvec_t *const chunkvec)
+{
+    assert(chunkvec);
+
+    const chunkvec_header_t *header = get_chunkvec_header(chunkvec);
+    for (size_t i = 0; i < header->blocks; ++i)
+    {
+        vector_destroy(*get_block_ref(chunkvec, i));
+    }
+
+    vector_destroy((vector_t *) chunkvec);
+}
+
+
+size_t chunkvec_capacity(const chunkvec_t *const chunkvec)
+{
+    assert(chunkvec);
+    const chunkvec_header_t *header = get_chunkvec_header(chunkvec);
+    return header->blocks << header->block_shift;
+}
+
+
+size_t chunkvec_block_cap(const chunkvec_t *const chunkvec)
+{
+    assert(chunkvec);
+    return (size_t)1 << get_chunkvec_header(chunkvec)->block_shift;
+}
+
+
+vector_status_t chunkvec_resize(chunkvec_t **const chunkvec, const size_t capacity, const vector_status_t error)
+{
+    assert(chunkvec && *chunkvec);
+
+    vector_t *index = (vector_t *) *chunkvec;
+    chunkvec_header_t *header = vector_get_ext_header(index);
+    const size_t block_cap = (size_t)1 << header->block_shift;
+    const size_t blocks = (capacity + block_cap - 1) >> header->block_shift;
+
+    if (blocks <= header->blocks)
+    {
+        for (size_t i = blocks; i < header->blocks; ++i)
+        {
+            vector_destroy(*get_block_ref(*chunkvec, i));
+        }
+        header->blocks = blocks;
+        return VECTOR_SUCCESS;
+    }
+
+    /* only the block index is reallocated, it holds one pointer per block */
+    if (blocks > vector_capacity(index))
+    {
+        const size_t desired = (blocks > vector_capacity(index) * 2) ? blocks : vector_capacity(index) * 2;
+        vector_status_t status = vector_resize(&index, desired, error);
+        if (VECTOR_SUCCESS != status)
+        {
+            return status;
+        }
+
+        *chunkvec = (chunkvec_t *) index;
+        header = vector_get_ext_header(index);
+    }
+
+    for (size_t i = header->blocks; i < blocks; ++i)
+    {
+        vector_t *block = vector_create_(&(vector_opts_t) {
+            .alloc_opts = vector_alloc_opts(index),
+            .element_size = header->element_size,
+            .initial_cap = block_cap,
+        });
+
+        if (!block)
+        {
+            /* release blocks allocated by this call */
+            for (size_t j = header->blocks; j < i; ++j)
+            {
+                vector_destroy(*get_block_ref(*chunkvec, j));
+            }
+            return error;
+        }
+
+        *get_block_ref(*chunkvec, i) = block;
+    }
+
+    header->blocks = blocks;
+    return VECTOR_SUCCESS;
+}
+
+
+vector_t *chunkvec_block(const chunkvec_t *const chunkvec, const size_t block)
+{
+    assert(chunkvec);
+    assert((block < get_chunkvec_header(chunkvec)->blocks) && "Block out of bounds!");
+
+    return *get_block_ref(chunkvec, block);
+}
+
+
+void *chunkvec_get(const chunkvec_t *const chunkvec, const size_t index)
+{
+    assert(chunkvec);
+    assert((index < chunkvec_capacity(chunkvec)) && "Index out of capacity bounds!");
+
+    const size_t shift = get_chunkvec_header(chunkvec)->block_shift;
+    return vector_get(*get_block_ref(chunkvec, index >> shift), index & (((size_t)1 << shift) - 1));
+}
+
+
+void chunkvec_set(chunkvec_t *const chunkvec, const size_t index, const void *const value)
+{
+    assert(chunkvec);
+    assert((index < chunkvec_capacity(chunkvec)) && "Index out of capacity bounds!");
+
+    const size_t shift = get_chunkvec_header(chunkvec)->block_shift;
+    vector_set(*get_block_ref(chunkvec, index >> shift), index & (((size_t)1 << shift) - 1), value);
+}
+
+
+int chunkvec_foreach(const chunkvec_t *const chunkvec, const size_t limit, const foreach_t func, void *const param)
+{
+    assert(chunkvec);
+    assert(limit && limit <= chunkvec_capacity(chunkvec));
+    assert(func);
+
+    const chunkvec_header_t *header = get_chunkvec_header(chunkvec);
+    for (size_t i = 0; (i << header->block_shift) < limit; ++i)
+    {
+        int status = vector_foreach(*get_block_ref(chunkvec, i), block_limit(header, i, limit), func, param);
+        if (status) return status;
+    }
+
+    return 0;
+}
+
+
+int chunkvec_aggregate(const chunkvec_t *const chunkvec, const size_t limit, const aggregate_t func, void *const acc, void *const param)
+{
+    assert(chunkvec);
+    assert(limit && limit <= chunkvec_capacity(chunkvec));
+    assert(func);
+
+    const chunkvec_header_t *header = get_chunkvec_header(chunkvec);
+    for (size_t i = 0; (i << header->block_shift) < limit; ++i)
+    {
+        int status = vector_aggregate(*get_block_ref(chunkvec, i), block_limit(header, i, limit), func, acc, param);
+        if (status) return status;
+    }
+
+    return 0;
+}
+
+
+int chunkvec_transform(chunkvec_t *const chunkvec, const size_t limit, const transform_t func, void *const param)
+{
+    assert(chunkvec);
+    assert(limit && limit <= chunkvec_capacity(chunkvec));
+    assert(func);
+
+    const chunkvec_header_t *header = get_chunkvec_header(chunkvec);
+    for (size_t i = 0; (i << header->block_shift) < limit; ++i)
+    {
+        int status = vector_transform(*get_block_ref(chunkvec, i), block_limit(header, i, limit), func, param);
+        if (status) return status;
+    }
+
+    return 0;
+}
+
+
+/*                        **
+* === Static Functions === *
+*                         */
+
+static chunkvec_header_t *get_chunkvec_header(const chunkvec_t *const chunkvec)
+{
+    return (chunkvec_header_t *) vector_get_ext_header((const vector_t *) chunkvec);
+}
+
+
+static vector_t **get_block_ref(const chunkvec_t *const chunkvec, const size_t block)
+{
+    return (vector_t **) vector_get((const vector_t *) chunkvec, block);
+}
+
+
+static size_t block_limit(const chunkvec_header_t *const header, const size_t block, const size_t limit)
+{
+    const size_t begin = block << header->block_shift;
+    const size_t block_cap = (size_t)1 << header->block_shift;
+    return (limit - begin < block_cap) ? limit - begin : block_cap;
+}
@@ -0,0 +1,167 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Public interface of the chunked vector
+*/
+
+#ifndef _CHUNKVEC_H_
+#define _CHUNKVEC_H_
+
+#include "vector.h"
+
+/**
+* @brief   Chunked vector, composed of fixed size @ref vector_t blocks.
+* @details Top level @ref vector_t stores pointers to blocks, block capacity is a power of two,
+*          so indexed access is O(1) with a shift and a mask.
+*          Growth only allocates new blocks and resizes the small block index,
+*          elements are never copied and peak memory stays bounded.
+*          Functions that can grow the vector take a double pointer.
+*/
+typedef struct chunkvec_t chunkvec_t;
+
+/**
+* @brief   Chunked vector options.
+* @details Parameters that are passed to a @ref chunkvec_create_ function.
+*/
+typedef struct chunkvec_opts_t
+{
+    alloc_opts_t alloc_opts;  /**< @brief optional allocator, shared by all blocks */
+    /* required: */
+    size_t element_size;      /**< @brief Size of the stored element type. */
+
+    /* optional: */
+    size_t block_cap;         /**< @brief Elements per block, rounded up to a power of two. */
+    size_t initial_cap;       /**< @brief Amount of elements that will be preallocated. */
+}
+chunkvec_opts_t;
+
+/**
+* Represents chunked vector default create values.
+*/
+#define CHUNKVEC_DEFAULT_ARGS \
+    .block_cap = 4096
+
+/**
+ * @addtogroup Chunkvec_API Chunked Vector API
+ * @brief      Chunked vector methods. @{ */
+
+/**
+* @brief   Chunked vector constructor.
+* @details Preferable way to invoke constructor.
+*          Provides default values.
+* @warning @ref chunkvec_opts_t::element_size "element_size" is mandatory!
+* @see chunkvec_create_
+*/
+#define chunkvec_create(...) \
+    chunkvec_create_( \
+        &(chunkvec_opts_t) { \
+            CHUNKVEC_DEFAULT_ARGS,\
+            __VA_ARGS__ \
+        }\
+    )\
+
+/**
+* @brief   Chunked vector constructor.
+*
+* @param[in] opts Options according to which vector will be created.
+* @returns        Fresh new vector or @c NULL if allocation failed.
+*/
+chunkvec_t *chunkvec_create_(const chunkvec_opts_t *const opts);
+
+
+/**
+* @brief   Deallocates vector with all its blocks.
+*
+* @param[in] chunkvec Vector that will be deallocated.
+*/
+void chunkvec_destroy(chunkvec_t *const chunkvec);
+
+
+/**
+* @brief   Reports current capacity.
+*
+* @param[in] chunkvec Pointer to a vector instance.
+* @returns            Amount of elements in allocated blocks.
+*/
+size_t chunkvec_capacity(const chunkvec_t *const chunkvec);
+
+
+/**
+* @brief   Reports amount of elements per block.
+*
+* @param[in] chunkvec Pointer to a vector instance.
+* @returns            Block capacity, power of two.
+*/
+size_t chunkvec_block_cap(const chunkvec_t *const chunkvec);
+
+
+/**
+* @brief   Changes capacity by allocating or releasing whole blocks.
+* @details Capacity is rounded up to a multiple of block capacity.
+*          Existing blocks are never moved.
+*
+* @param[in] chunkvec Reference to vector pointer.
+* @param[in] capacity New capacity.
+* @param[in] error    Status returned when allocation fails.
+* @returns            @ref VECTOR_SUCCESS or @c error, vector is left intact on failure.
+*/
+vector_status_t chunkvec_resize(chunkvec_t **const chunkvec, const size_t capacity, const vector_status_t error);
+
+
+/**
+* @brief   Access block of elements.
+*
+* @param[in] chunkvec Pointer to a vector instance.
+* @param[in] block    Block index.
+* @returns            Block holding elements starting at @c block * @ref chunkvec_block_cap.
+*/
+vector_t *chunkvec_block(const chunkvec_t *const chunkvec, const size_t block);
+
+
+/**
+* @brief   Returns pointer for the element at @c index.
+* @see vector_get
+*/
+void *chunkvec_get(const chunkvec_t *const chunkvec, const size_t index);
+
+
+/**
+* @brief   Sets element at given @c index to a @c value.
+* @see vector_set
+*/
+void chunkvec_set(chunkvec_t *const chunkvec, const size_t index, const void *const value);
+
+
+/**
+* @brief   Perform immutable action on each element, block by block.
+* @see vector_foreach
+*/
+int chunkvec_foreach(const chunkvec_t *const chunkvec,
+        const size_t limit,
+        const foreach_t func,
+        void *const param);
+
+
+/**
+* @brief   Perform immutable accamulating action on each element, block by block.
+* @see vector_aggregate
+*/
+int chunkvec_aggregate(const chunkvec_t *const chunkvec,
+        const size_t limit,
+        const aggregate_t func,
+        void *const acc,
+        void *const param);
+
+
+/**
+* @brief   Perform mutable transformation on each element, block by block.
+* @see vector_transform
+*/
+int chunkvec_transform(chunkvec_t *const chunkvec,
+        const size_t limit,
+        const transform_t func,
+        void *const param);
+
+/** @} @noop Chunkvec_API */
+
+#endif/*_CHUNKVEC_H_*/
@@ -0,0 +1,290 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Implementation of the concurrent append-only vector
+*/
+
+#include "cvec.h"
+
+#include <assert.h>    /** assert */
+#include <limits.h>    /** CHAR_BIT */
+#include <sched.h>     /** sched_yield */
+#include <stdatomic.h> /** atomic_size_t, atomic_compare_exchange_weak_explicit */
+#include <string.h>    /** memcpy */
+
+/**
+ * @internal
+ * @brief Container state stored in segment index extension header.
+ */
+typedef struct cvec_header_t
+{
+    atomic_size_t size;  /**< @brief Amount of reserved slots. */
+    size_t element_size; /**< @brief Size of the stored element type. */
+    size_t segment_cap;  /**< @brief Capacity of the first segment, power of two. */
+    size_t segment_log;  /**< @brief Binary logarithm of @ref cvec_header_t::segment_cap. */
+}
+cvec_header_t;
+
+/**
+ * @internal
+ * @brief Segment index element, segments are installed once and never moved.
+ */
+typedef _Atomic(vector_t *) segment_ref_t;
+
+/**
+ * @internal
+ * @brief Placeholder of a segment being allocated by one of the threads.
+ */
+static char busy_segment;
+#define SEGMENT_BUSY ((vector_t *) &busy_segment)
+
+/*                             *
+* === Forward Declarations === *
+*                             */
+
+/**
+* @brief   Access container state.
+*/
+static cvec_header_t *get_cvec_header(const cvec_t *const cvec);
+
+/**
+* @brief   Maps an index to a segment and offset inside of it.
+*/
+static size_t locate(const cvec_header_t *const header, const size_t index, size_t *const offset);
+
+/**
+* @brief   Returns installed segment, allocating and installing it if missing.
+* @details Only the thread that claimed the segment allocates it, others wait for installation.
+*/
+static vector_t *acquire_segment(cvec_t *const cvec, const size_t segment);
+
+/**
+* @brief   Access publication flag of an element inside of a segment.
+*/
+static atomic_uchar *get_ready_flag(const vector_t *const segment, const size_t offset);
+
+
+/*                             *
+* === API Implementation   === *
+*                             */
+
+cvec_t *cvec_create_(const cvec_opts_t *const opts)
+{
+    assert(opts && "non-null opts required!");
+    assert(opts->element_size && "'element_size' gt then zero required!");
+
+    size_t segment_log = 0;
+    while (((size_t)1 << segment_log) < opts->segment_cap) ++segment_log;
+
+    /* enough segments to address every representable index */
+    const size_t segments = sizeof(size_t) * CHAR_BIT - segment_log;
+
+    vector_t *index = vector_create_(&(vector_opts_t) {
+        .alloc_opts = opts->alloc_opts,
+        .ext_header_size = sizeof(cvec_header_t),
+        .element_size = sizeof(segment_ref_t),
+        .initial_cap = segments,
+    });
+
+    if (!index)
+    {
+        return NULL;
+    }
+
+    cvec_header_t *header = vector_get_ext_header(index);
+    atomic_init(&header->size, 0);
+    header->element_size = opts->element_size;
+    header->segment_cap = (size_t)1 << segment_log;
+    header->segment_log = segment_log;
+
+    for (size_t i = 0; i < segments; ++i)
+    {
+        atomic_init((segment_ref_t *) vector_get(index, i), NULL);
+    }
+
+    return (cvec_t *) index;
+}
+
+
+void cvec_destroy(cvec_t *const cvec)
+{
+    assert(cvec);
+
+    vector_t *index = (vector_t *) cvec;
+    for (size_t i = 0; i < vector_capacity(index); ++i)
+    {
+        vector_t *segment = atomic_load_explicit((segment_ref_t *) vector_get(index, i), memory_order_acquire);
+        if (segment && segment != SEGMENT_BUSY)
+        {
+            vector_destroy(segment);
+        }
+    }
+
+    vector_destroy(index);
+}
+
+
+size_t cvec_size(const cvec_t *const cvec)
+{
+    assert(cvec);
+    return atomic_load_explicit(&get_cvec_header(cvec)->size, memory_order_acquire);
+}
+
+
+cvec_status_t cvec_append(cvec_t *const cvec, const void *const value, size_t *const index)
+{
+    assert(cvec);
+    assert(value);
+
+    cvec_header_t *header = get_cvec_header(cvec);
+    size_t slot = atomic_load_explicit(&header->size, memory_order_relaxed);
+    size_t offset;
+    vector_t *segment;
+
+    /* slot is handed out only once its segment is installed, so failed allocation leaves no hole */
+    do
+    {
+        segment = acquire_segment(cvec, locate(header, slot, &offset));
+        if (!segment)
+        {
+            return CVEC_ALLOC_ERROR;
+        }
+    }
+    while (!atomic_compare_exchange_weak_explicit(&header->size, &slot, slot + 1,
+                memory_order_relaxed, memory_order_relaxed));
+
+    vector_set(segment, offset, value);
+    atomic_store_explicit(get_ready_flag(segment, offset), 1, memory_order_release);
+
+    if (index) *index = slot;
+    return CVEC_SUCCESS;
+}
+
+
+void *cvec_get(const cvec_t *const cvec, const size_t index)
+{
+    assert(cvec);
+
+    const cvec_header_t *header = get_cvec_header(cvec);
+    size_t offset;
+    const size_t segment_index = locate(header, index, &offset);
+
+    if (segment_index >= vector_capacity((const vector_t *) cvec))
+    {
+        return NULL;
+    }
+
+    vector_t *segment = atomic_load_explicit(
+            (segment_ref_t *) vector_get((const vector_t *) cvec, segment_index), memory_order_acquire);
+
+    if (!segment || segment == SEGMENT_BUSY
+            || !atomic_load_explicit(get_ready_flag(segment, offset), memory_order_acquire))
+    {
+        return NULL;
+    }
+
+    return vector_get(segment, offset);
+}
+
+
+int cvec_foreach(const cvec_t *const cvec, const foreach_t func, void *const param)
+{
+    assert(cvec);
+    assert(func);
+
+    const size_t size = cvec_size(cvec);
+    for (size_t i = 0; i < size; ++i)
+    {
+        const void *element = cvec_get(cvec, i);
+        if (!element) break;
+
+        int status = func(element, param);
+        if (status) return status;
+    }
+
+    return 0;
+}
+
+
+/*                        **
+* === Static Functions === *
+*                         */
+
+static cvec_header_t *get_cvec_header(const cvec_t *const cvec)
+{
+    return (cvec_header_t *) vector_get_ext_header((const vector_t *) cvec);
+}
+
+
+static size_t locate(const cvec_header_t *const header, const size_t index, size_t *const offset)
+{
+    /* segment k starts at segment_cap * (2^k - 1) */
+    const size_t block = (index >> header->segment_log) + 1;
+    const size_t segment = sizeof(unsigned long long) * CHAR_BIT - 1 - (size_t)__builtin_clzll(block);
+    *offset = index - ((((size_t)1 << segment) - 1) << header->segment_log);
+    return segment;
+}
+
+
+static vector_t *acquire_segment(cvec_t *const cvec, const size_t segment)
+{
+    vector_t *index = (vector_t *) cvec;
+    assert((segment < vector_capacity(index)) && "Index space exhausted!");
+
+    segment_ref_t *ref = vector_get(index, segment);
+    vector_t *installed = atomic_load_explicit(ref, memory_order_acquire);
+
+    for (;;)
+    {
+        if (installed && installed != SEGMENT_BUSY)
+        {
+            return installed;
+        }
+
+        if (!installed && atomic_compare_exchange_weak_explicit(ref, &installed, SEGMENT_BUSY,
+                    memory_order_acquire, memory_order_acquire))
+        {
+            break;
+        }
+
+        /* another thread allocates the segment, avoid transient duplicate allocations */
+        if (installed == SEGMENT_BUSY)
+        {
+            sched_yield();
+            installed = atomic_load_explicit(ref, memory_order_acquire);
+        }
+    }
+
+    const cvec_header_t *header = get_cvec_header(cvec);
+    const size_t capacity = header->segment_cap << segment;
+
+    /* publication flags are kept in segment's extension header */
+    vector_t *fresh = vector_create_(&(vector_opts_t) {
+        .alloc_opts = vector_alloc_opts(index),
+        .ext_header_size = calc_aligned_size(capacity * sizeof(atomic_uchar), sizeof(max_align_t)),
+        .element_size = header->element_size,
+        .initial_cap = capacity,
+    });
+
+    if (!fresh)
+    {
+        /* release the claim, a later append may retry */
+        atomic_store_explicit(ref, NULL, memory_order_release);
+        return NULL;
+    }
+
+    atomic_uchar *flags = vector_get_ext_header(fresh);
+    for (size_t i = 0; i < capacity; ++i)
+    {
+        atomic_init(&flags[i], 0);
+    }
+
+    atomic_store_explicit(ref, fresh, memory_order_release);
+    return fresh;
+}
+
+
+static atomic_uchar *get_ready_flag(const vector_t *const segment, const size_t offset)
+{
+    return (atomic_uchar *) vector_get_ext_header(segment) + offset;
+}
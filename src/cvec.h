@@ -0,0 +1,141 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Public interface of the concurrent append-only vector
+*/
+
+#ifndef _CVEC_H_
+#define _CVEC_H_
+
+#include "vector.h"
+
+/**
+* @brief   Concurrent append-only vector with stable element addresses.
+* @details Elements are stored in exponentially growing segments,
+*          segment @c k holds @c segment_cap * 2^k elements and is a separate @ref vector_t.
+*          Threads reserve slots with an atomic CAS once the slot's segment is installed,
+*          a missing segment is allocated by a single thread, so no element is ever moved
+*          and pointers to elements stay valid until the container is destroyed.
+*          Readers access published elements without locking.
+*/
+typedef struct cvec_t cvec_t;
+
+/**
+* @brief   Concurrent vector options.
+* @details Parameters that are passed to a @ref cvec_create_ function.
+*/
+typedef struct cvec_opts_t
+{
+    alloc_opts_t alloc_opts;  /**< @brief optional allocator, shared by all segments */
+    /* required: */
+    size_t element_size;      /**< @brief Size of the stored element type. */
+
+    /* optional: */
+    size_t segment_cap;       /**< @brief Capacity of the first segment, rounded up to a power of two. */
+}
+cvec_opts_t;
+
+/**
+* @brief   Status of concurrent vector operations that may fail.
+* @details Extends @ref vector_status_t.
+*/
+typedef enum cvec_status_t
+{
+    CVEC_SUCCESS = VECTOR_SUCCESS,         /**< Success operation status code. */
+    CVEC_ALLOC_ERROR = VECTOR_ALLOC_ERROR, /**< Segment allocation failed, no slot is reserved. */
+    CVEC_STATUS_LAST = VECTOR_STATUS_LAST  /**< Indicates end of the enum values. */
+}
+cvec_status_t;
+
+/**
+* Represents concurrent vector default create values.
+*/
+#define CVEC_DEFAULT_ARGS \
+    .segment_cap = 64
+
+/**
+ * @addtogroup CVEC_API Concurrent Vector API
+ * @brief      Concurrent append-only vector methods. @{ */
+
+/**
+* @brief   Concurrent vector constructor.
+* @details Preferable way to invoke constructor.
+*          Provides default values.
+* @warning @ref cvec_opts_t::element_size "element_size" is mandatory!
+* @see cvec_create_
+*/
+#define cvec_create(...) \
+    cvec_create_( \
+        &(cvec_opts_t) { \
+            CVEC_DEFAULT_ARGS,\
+            __VA_ARGS__ \
+        }\
+    )\
+
+/**
+* @brief   Concurrent vector constructor.
+* @warning Not thread safe, publish container to other threads after creation.
+*
+* @param[in] opts Options according to which container will be created.
+* @returns        Fresh new empty container or @c NULL if allocation failed.
+*/
+cvec_t *cvec_create_(const cvec_opts_t *const opts);
+
+
+/**
+* @brief   Deallocates container with all its segments.
+* @warning All threads must be done with the container.
+*
+* @param[in] cvec Container that will be deallocated.
+*/
+void cvec_destroy(cvec_t *const cvec);
+
+
+/**
+* @brief   Reports amount of reserved slots.
+* @details Some of the reserved slots may not be published yet.
+*
+* @param[in] cvec Pointer to a container instance.
+* @returns        Amount of reserved slots.
+*/
+size_t cvec_size(const cvec_t *const cvec);
+
+
+/**
+* @brief   Appends element, thread safe.
+* @details Allocates the segment of the next slot if needed, reserves the slot,
+*          copies @c value and publishes the slot for readers.
+*          Failed allocation reserves nothing, so later elements stay visible.
+*
+* @param[in]  cvec  Pointer to a container instance.
+* @param[in]  value Value to be copied.
+* @param[out] index Optional location for the index of appended element.
+* @returns          Operation status.
+*/
+cvec_status_t cvec_append(cvec_t *const cvec, const void *const value, size_t *const index);
+
+
+/**
+* @brief   Access published element, thread safe.
+*
+* @param[in] cvec  Pointer to a container instance.
+* @param[in] index Index of the element.
+* @returns         Stable pointer to the element or @c NULL if it is not published yet.
+*/
+void *cvec_get(const cvec_t *const cvec, const size_t index);
+
+
+/**
+* @brief   Perform immutable action on published elements, thread safe.
+* @details Visits elements in index order, stopping at the first unpublished one.
+*
+* @param[in] cvec       Pointer to a container instance.
+* @param[in] func       Action to be performed.
+* @param[in,out] param  User defined parameter, passed to func.
+* @returns              Zero on success, or nonzero value - user defined status code.
+*/
+int cvec_foreach(const cvec_t *const cvec, const foreach_t func, void *const param);
+
+/** @} @noop CVEC_API */
+
+#endif/*_CVEC_H_*/
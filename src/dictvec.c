@@ -0,0 +1,339 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Implementation of the dictionary encoded vector
+*/
+
+#include "dictvec.h"
+#include "bitset.h"
+#include "hashmap.h"
+
+#include <assert.h> /** assert */
+#include <stdint.h> /** uint8_t, uint16_t, uint32_t */
+#include <string.h> /** memcpy, memset */
+
+/**
+ * @internal
+ * @brief Initial dictionary capacity.
+ */
+#define INITIAL_DICT_CAP 16
+
+/**
+ * @internal
+ * @brief Vector state stored in code vector's extension header.
+ */
+typedef struct dictvec_header_t
+{
+    vector_t *dictionary; /**< @brief Distinct values, indexed by code. */
+    hashmap_t *lookup;    /**< @brief Maps value to its code. */
+    bitset_t *matches;    /**< @brief Per code predicate results, reused by filter. */
+    size_t cardinality;   /**< @brief Amount of dictionary entries. */
+    size_t max_codes;     /**< @brief Amount of codes representable by a code. */
+}
+dictvec_header_t;
+
+/*                             *
+* === Forward Declarations === *
+*                             */
+
+/**
+* @brief   Access vector state.
+*/
+static dictvec_header_t *get_dictvec_header(const dictvec_t *const dictvec);
+
+/**
+* @brief   Reads code at @c index.
+*/
+static size_t load_code(const dictvec_t *const dictvec, const size_t index);
+
+/**
+* @brief   Writes code at @c index.
+*/
+static void store_code(dictvec_t *const dictvec, const size_t index, const size_t code);
+
+/**
+* @brief   Adds value to the dictionary.
+*/
+static dictvec_status_t add_value(dictvec_header_t *const header, const void *const value, uint32_t *const code);
+
+
+/*                             *
+* === API Implementation   === *
+*                             */
+
+dictvec_t *dictvec_create_(const dictvec_opts_t *const opts)
+{
+    assert(opts && "non-null opts required!");
+    assert(opts->element_size && "'element_size' gt then zero required!");
+    assert((opts->code_size == 1 || opts->code_size == 2 || opts->code_size == 4) && "'code_size' must be 1, 2 or 4!");
+
+    vector_t *codes = vector_create_(&(vector_opts_t) {
+        .alloc_opts = opts->alloc_opts,
+        .ext_header_size = sizeof(dictvec_header_t),
+        .element_size = opts->code_size,
+        .initial_cap = opts->initial_cap,
+        .zero_init = true,
+    });
+
+    if (!codes)
+    {
+        return NULL;
+    }
+
+    dictvec_header_t *header = vector_get_ext_header(codes);
+    *header = (dictvec_header_t) {
+        .max_codes = (4 == opts->code_size) ? (size_t)UINT32_MAX + 1 : (size_t)1 << (opts->code_size * 8),
+    };
+
+    header->dictionary = vector_create_(&(vector_opts_t) {
+        .alloc_opts = vector_alloc_opts(codes),
+        .element_size = opts->element_size,
+        .initial_cap = INITIAL_DICT_CAP,
+        .zero_init = true,
+    });
+
+    header->lookup = hashmap_create(
+        .alloc_opts = vector_alloc_opts(codes),
+        .key_size = opts->element_size,
+        .value_size = sizeof(uint32_t)
+    );
+
+    header->matches = bitset_create(.alloc_opts = vector_alloc_opts(codes));
+
+    uint32_t zero_code;
+    if (!header->dictionary || !header->lookup || !header->matches
+        || DICTVEC_SUCCESS != add_value(header, vector_get(header->dictionary, 0), &zero_code))
+    {
+        dictvec_destroy((dictvec_t *) codes);
+        return NULL;
+    }
+
+    return (dictvec_t *) codes;
+}
+
+
+void dictvec_destroy(dictvec_t *const dictvec)
+{
+    assert(dictvec);
+
+    dictvec_header_t *header = get_dictvec_header(dictvec);
+    if (header->dictionary) vector_destroy(header->dictionary);
+    if (header->lookup) hashmap_destroy(header->lookup);
+    if (header->matches) bitset_destroy(header->matches);
+
+    vector_destroy((vector_t *) dictvec);
+}
+
+
+size_t dictvec_capacity(const dictvec_t *const dictvec)
+{
+    assert(dictvec);
+    return vector_capacity((const vector_t *) dictvec);
+}
+
+
+vector_status_t dictvec_resize(dictvec_t **const dictvec, const size_t capacity, const vector_status_t error)
+{
+    assert(dictvec && *dictvec);
+    return vector_resize_zeroed((vector_t **) dictvec, capacity, error);
+}
+
+
+const vector_t *dictvec_dictionary(const dictvec_t *const dictvec)
+{
+    assert(dictvec);
+    return get_dictvec_header(dictvec)->dictionary;
+}
+
+
+size_t dictvec_cardinality(const dictvec_t *const dictvec)
+{
+    assert(dictvec);
+    return get_dictvec_header(dictvec)->cardinality;
+}
+
+
+dictvec_status_t dictvec_set(dictvec_t *const dictvec, const size_t index, const void *const value)
+{
+    assert(dictvec);
+    assert(value);
+    assert((index < dictvec_capacity(dictvec)) && "Index out of capacity bounds!");
+
+    dictvec_header_t *header = get_dictvec_header(dictvec);
+    const uint32_t *found = hashmap_get(header->lookup, value);
+    uint32_t code;
+
+    if (found)
+    {
+        code = *found;
+    }
+    else
+    {
+        dictvec_status_t status = add_value(header, value, &code);
+        if (DICTVEC_SUCCESS != status)
+        {
+            return status;
+        }
+    }
+
+    store_code(dictvec, index, code);
+    return DICTVEC_SUCCESS;
+}
+
+
+const void *dictvec_get(const dictvec_t *const dictvec, const size_t index)
+{
+    assert(dictvec);
+    return vector_get(get_dictvec_header(dictvec)->dictionary, dictvec_code(dictvec, index));
+}
+
+
+size_t dictvec_code(const dictvec_t *const dictvec, const size_t index)
+{
+    assert(dictvec);
+    assert((index < dictvec_capacity(dictvec)) && "Index out of capacity bounds!");
+    return load_code(dictvec, index);
+}
+
+
+int dictvec_foreach(const dictvec_t *const dictvec, const size_t limit, const foreach_t func, void *const param)
+{
+    assert(dictvec);
+    assert(limit && limit <= dictvec_capacity(dictvec));
+    assert(func);
+
+    const vector_t *dictionary = get_dictvec_header(dictvec)->dictionary;
+    for (size_t i = 0; i < limit; ++i)
+    {
+        int status = func(vector_get(dictionary, load_code(dictvec, i)), param);
+        if (status) return status;
+    }
+
+    return 0;
+}
+
+
+size_t dictvec_filter(const dictvec_t *const dictvec,
+        const size_t limit,
+        const predicate_t predicate,
+        void *const param,
+        size_t *const indices)
+{
+    assert(dictvec);
+    assert(limit <= dictvec_capacity(dictvec));
+    assert(predicate);
+
+    const dictvec_header_t *header = get_dictvec_header(dictvec);
+
+    /* predicate runs once per distinct value */
+    bitset_fill(header->matches, false);
+    for (size_t code = 0; code < header->cardinality; ++code)
+    {
+        if (predicate(vector_get(header->dictionary, code), param))
+        {
+            bitset_set(header->matches, code);
+        }
+    }
+
+    if (0 == bitset_count(header->matches))
+    {
+        return 0;
+    }
+
+    /* scan is specialized per code width */
+    const char *codes = vector_data((const vector_t *) dictvec);
+    size_t count = 0;
+
+#define FILTER_CODES(type) \
+    for (size_t i = 0; i < limit; ++i) \
+    { \
+        if (bitset_test(header->matches, ((const type *) codes)[i])) \
+        { \
+            if (indices) indices[count] = i; \
+            ++count; \
+        } \
+    }
+
+    switch (vector_element_size((const vector_t *) dictvec))
+    {
+        case 1:  FILTER_CODES(uint8_t);  break;
+        case 2:  FILTER_CODES(uint16_t); break;
+        default: FILTER_CODES(uint32_t); break;
+    }
+
+#undef FILTER_CODES
+
+    return count;
+}
+
+
+/*                        **
+* === Static Functions === *
+*                         */
+
+static dictvec_header_t *get_dictvec_header(const dictvec_t *const dictvec)
+{
+    return (dictvec_header_t *) vector_get_ext_header((const vector_t *) dictvec);
+}
+
+
+static size_t load_code(const dictvec_t *const dictvec, const size_t index)
+{
+    /* code storage offset depends on user allocator size, may be misaligned */
+    const void *code = vector_get((const vector_t *) dictvec, index);
+    switch (vector_element_size((const vector_t *) dictvec))
+    {
+        case 1:  { uint8_t c; memcpy(&c, code, sizeof(c)); return c; }
+        case 2:  { uint16_t c; memcpy(&c, code, sizeof(c)); return c; }
+        default: { uint32_t c; memcpy(&c, code, sizeof(c)); return c; }
+    }
+}
+
+
+static void store_code(dictvec_t *const dictvec, const size_t index, const size_t code)
+{
+    void *dest = vector_get((vector_t *) dictvec, index);
+    switch (vector_element_size((vector_t *) dictvec))
+    {
+        case 1:  *(uint8_t *) dest = (uint8_t) code; break;
+        case 2:  memcpy(dest, &(uint16_t) {(uint16_t) code}, sizeof(uint16_t)); break;
+        default: memcpy(dest, &(uint32_t) {(uint32_t) code}, sizeof(uint32_t)); break;
+    }
+}
+
+
+static dictvec_status_t add_value(dictvec_header_t *const header, const void *const value, uint32_t *const code)
+{
+    if (header->cardinality == header->max_codes)
+    {
+        return DICTVEC_FULL;
+    }
+
+    const size_t capacity = vector_capacity(header->dictionary);
+    if (header->cardinality == capacity
+        && VECTOR_SUCCESS != vector_resize(&header->dictionary, capacity * 2, VECTOR_ALLOC_ERROR))
+    {
+        return DICTVEC_ALLOC_ERROR;
+    }
+
+    if (bitset_size(header->matches) <= header->cardinality
+        && VECTOR_SUCCESS != bitset_resize(&header->matches, vector_capacity(header->dictionary), VECTOR_ALLOC_ERROR))
+    {
+        return DICTVEC_ALLOC_ERROR;
+    }
+
+    *code = (uint32_t) header->cardinality;
+    if (HASHMAP_SUCCESS != hashmap_insert(&header->lookup, value, code))
+    {
+        return DICTVEC_ALLOC_ERROR;
+    }
+
+    /* value may point into the dictionary itself (zero entry), copy is a no-op then */
+    void *entry = vector_get(header->dictionary, header->cardinality);
+    if (entry != value)
+    {
+        vector_set(header->dictionary, header->cardinality, value);
+    }
+    ++header->cardinality;
+    return DICTVEC_SUCCESS;
+}
@@ -0,0 +1,197 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Public interface of the dictionary encoded vector
+*/
+
+#ifndef _DICTVEC_H_
+#define _DICTVEC_H_
+
+#include "vector.h"
+
+/**
+* @brief   Dictionary encoded vector for low cardinality wide elements.
+* @details Each distinct element value is stored once in a dictionary @ref vector_t,
+*          elements themselves are 8, 16 or 32 bit codes stored as vector's elements.
+*          Dictionary starts with the zero value under code zero,
+*          so fresh elements read as zero.
+*          Predicates are evaluated once per dictionary entry, then codes are filtered.
+*          Functions that can grow the vector take a double pointer.
+*/
+typedef struct dictvec_t dictvec_t;
+
+/**
+* @brief   Dictionary encoded vector options.
+* @details Parameters that are passed to a @ref dictvec_create_ function.
+*/
+typedef struct dictvec_opts_t
+{
+    alloc_opts_t alloc_opts;  /**< @brief optional allocator */
+    /* required: */
+    size_t element_size;      /**< @brief Size of the stored element type. */
+
+    /* optional: */
+    size_t code_size;         /**< @brief Size of a code: 1, 2 or 4 bytes, limits amount of distinct values. */
+    size_t initial_cap;       /**< @brief Amount of elements that will be preallocated, all zero. */
+}
+dictvec_opts_t;
+
+/**
+* @brief   Status of dictionary encoded vector operations that may fail.
+* @details Extends @ref vector_status_t.
+*/
+typedef enum dictvec_status_t
+{
+    DICTVEC_SUCCESS = VECTOR_SUCCESS,         /**< Success operation status code. */
+    DICTVEC_ALLOC_ERROR = VECTOR_ALLOC_ERROR, /**< Allocation error status code. */
+    DICTVEC_FULL = VECTOR_STATUS_LAST,        /**< Code space is exhausted, new value was not added. */
+    DICTVEC_STATUS_LAST                       /**< Indicates end of the enum values. */
+}
+dictvec_status_t;
+
+/**
+* Represents dictionary encoded vector default create values.
+*/
+#define DICTVEC_DEFAULT_ARGS \
+    .code_size = 2
+
+/**
+ * @addtogroup Dictvec_API Dictionary Encoded Vector API
+ * @brief      Dictionary encoded vector methods. @{ */
+
+/**
+* @brief   Dictionary encoded vector constructor.
+* @details Preferable way to invoke constructor.
+*          Provides default values.
+* @warning @ref dictvec_opts_t::element_size "element_size" is mandatory!
+* @see dictvec_create_
+*/
+#define dictvec_create(...) \
+    dictvec_create_( \
+        &(dictvec_opts_t) { \
+            DICTVEC_DEFAULT_ARGS,\
+            __VA_ARGS__ \
+        }\
+    )\
+
+/**
+* @brief   Dictionary encoded vector constructor.
+*
+* @param[in] opts Options according to which vector will be created.
+* @returns        Fresh new vector or @c NULL if allocation failed.
+*/
+dictvec_t *dictvec_create_(const dictvec_opts_t *const opts);
+
+
+/**
+* @brief   Deallocates vector along with its dictionary.
+*
+* @param[in] dictvec Vector that will be deallocated.
+*/
+void dictvec_destroy(dictvec_t *const dictvec);
+
+
+/**
+* @brief   Reports capacity.
+*
+* @param[in] dictvec Pointer to a vector instance.
+* @returns           Amount of elements.
+*/
+size_t dictvec_capacity(const dictvec_t *const dictvec);
+
+
+/**
+* @brief   Changes capacity, new elements are zero.
+*
+* @param[in] dictvec  Reference to vector pointer.
+* @param[in] capacity New capacity.
+* @param[in] error    Status returned when allocation fails.
+* @returns            @ref VECTOR_SUCCESS or @c error, vector is left intact on failure.
+*/
+vector_status_t dictvec_resize(dictvec_t **const dictvec, const size_t capacity, const vector_status_t error);
+
+
+/**
+* @brief   Access dictionary.
+* @details Dictionary entry at index @c code holds the value of that code,
+*          entries past @ref dictvec_cardinality are unused.
+*
+* @param[in] dictvec Pointer to a vector instance.
+* @returns           Dictionary vector.
+*/
+const vector_t *dictvec_dictionary(const dictvec_t *const dictvec);
+
+
+/**
+* @brief   Reports amount of distinct values in the dictionary.
+*
+* @param[in] dictvec Pointer to a vector instance.
+* @returns           Amount of dictionary entries.
+*/
+size_t dictvec_cardinality(const dictvec_t *const dictvec);
+
+
+/**
+* @brief   Sets element at given @c index to a @c value.
+* @details Value is looked up in the dictionary and added there if missing.
+*
+* @param[in] dictvec Pointer to a vector instance.
+* @param[in] index   Element index.
+* @param[in] value   Value to be stored.
+* @returns           Operation status.
+*/
+dictvec_status_t dictvec_set(dictvec_t *const dictvec, const size_t index, const void *const value);
+
+
+/**
+* @brief   Returns pointer to the decoded element at @c index.
+* @warning Points into the dictionary, shared by all elements with the same value.
+*
+* @param[in] dictvec Pointer to a vector instance.
+* @param[in] index   Element index.
+* @returns           Pointer to the value.
+*/
+const void *dictvec_get(const dictvec_t *const dictvec, const size_t index);
+
+
+/**
+* @brief   Returns code of the element at @c index.
+*
+* @param[in] dictvec Pointer to a vector instance.
+* @param[in] index   Element index.
+* @returns           Code, index into the dictionary.
+*/
+size_t dictvec_code(const dictvec_t *const dictvec, const size_t index);
+
+
+/**
+* @brief   Perform immutable action on each decoded element.
+* @see vector_foreach
+*/
+int dictvec_foreach(const dictvec_t *const dictvec,
+        const size_t limit,
+        const foreach_t func,
+        void *const param);
+
+
+/**
+* @brief   Finds elements matching the predicate.
+* @details Predicate is called once per dictionary entry,
+*          elements are then selected by their codes.
+*
+* @param[in]  dictvec   Pointer to a vector instance.
+* @param[in]  limit     Amount of leading elements to be scanned.
+* @param[in]  predicate Condition for elements to be selected.
+* @param[in]  param     User defined parameter, passed to @c predicate.
+* @param[out] indices   Ascending indices of matching elements, room for @c limit entries, may be @c NULL.
+* @returns              Amount of matching elements.
+*/
+size_t dictvec_filter(const dictvec_t *const dictvec,
+        const size_t limit,
+        const predicate_t predicate,
+        void *const param,
+        size_t *const indices);
+
+/** @} @noop Dictvec_API */
+
+#endif/*_DICTVEC_H_*/
@@ -0,0 +1,225 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Implementation of the incremental content digest
+*/
+
+#include "digest.h"
+
+#include <assert.h>  /** assert */
+#include <pthread.h> /** pthread_create, pthread_join */
+
+/**
+* @brief   Upper bound of threads hashing chunks on creation.
+*/
+#define MAX_THREADS 64
+
+/**
+ * @internal
+ * @brief Digest state stored in vector's extension header.
+ */
+typedef struct digest_header_t
+{
+    uint64_t seed;       /**< @brief Seed of the hash function. */
+    uint64_t value;      /**< @brief Folded digest of all chunks. */
+    size_t size;         /**< @brief Size of the hashed range in bytes. */
+    size_t element_size; /**< @brief Element size of the hashed vector. */
+}
+digest_header_t;
+
+/**
+ * @internal
+ * @brief Share of chunks hashed by a single thread.
+ */
+typedef struct digest_job_t
+{
+    const char *data;
+    size_t size;
+    uint64_t seed;
+    uint64_t *digests;
+    size_t first; /**< @brief First chunk of the share. */
+    size_t last;  /**< @brief Chunk after the share. */
+}
+digest_job_t;
+
+/*                             *
+* === Forward Declarations === *
+*                             */
+
+/**
+* @brief   Access digest state.
+*/
+static digest_header_t *get_digest_header(const digest_t *const digest);
+
+/**
+* @brief   Hashes chunks of a job, thread entry point.
+*/
+static void *hash_chunks(void *const job);
+
+/**
+* @brief   Folds chunk digests into the digest value.
+*/
+static void refold(digest_t *const digest);
+
+
+/*                             *
+* === API Implementation   === *
+*                             */
+
+digest_t *digest_create_(const digest_opts_t *const opts)
+{
+    assert(opts && "non-null opts required!");
+    assert(opts->vector && "'vector' required!");
+    assert((opts->length <= vector_capacity(opts->vector)) && "Length out of vector bounds!");
+
+    const size_t element_size = vector_element_size(opts->vector);
+    const size_t size = opts->length * element_size;
+    const size_t count = size ? (size + VECTOR_HASH_CHUNK - 1) / VECTOR_HASH_CHUNK : 1;
+
+    /* pad extension header so digests start on a word boundary of the region */
+    const size_t ext_header_size = calc_aligned_size(opts->alloc_opts.size + sizeof(digest_header_t), sizeof(uint64_t))
+        - opts->alloc_opts.size;
+
+    vector_t *vector = vector_create_(&(vector_opts_t) {
+        .alloc_opts = opts->alloc_opts,
+        .ext_header_size = ext_header_size,
+        .element_size = sizeof(uint64_t),
+        .initial_cap = count,
+    });
+
+    if (!vector)
+    {
+        return NULL;
+    }
+
+    *(digest_header_t *) vector_get_ext_header(vector) = (digest_header_t) {
+        .seed = opts->seed,
+        .size = size,
+        .element_size = element_size,
+    };
+
+    size_t threads = opts->threads ? opts->threads : 1;
+    if (threads > count) threads = count;
+    if (threads > MAX_THREADS) threads = MAX_THREADS;
+
+    digest_job_t jobs[MAX_THREADS];
+    pthread_t helpers[MAX_THREADS];
+    bool started[MAX_THREADS] = {false};
+
+    for (size_t t = 0; t < threads; ++t)
+    {
+        jobs[t] = (digest_job_t) {
+            .data = vector_data(opts->vector),
+            .size = size,
+            .seed = opts->seed,
+            .digests = (uint64_t *) vector_data(vector),
+            .first = count * t / threads,
+            .last = count * (t + 1) / threads,
+        };
+    }
+
+    /* calling thread takes share zero and any share whose helper did not start */
+    for (size_t t = 1; t < threads; ++t)
+    {
+        started[t] = 0 == pthread_create(&helpers[t], NULL, hash_chunks, &jobs[t]);
+    }
+
+    hash_chunks(&jobs[0]);
+
+    for (size_t t = 1; t < threads; ++t)
+    {
+        if (started[t]) pthread_join(helpers[t], NULL);
+        else hash_chunks(&jobs[t]);
+    }
+
+    refold((digest_t *) vector);
+    return (digest_t *) vector;
+}
+
+
+void digest_destroy(digest_t *const digest)
+{
+    assert(digest);
+    vector_destroy((vector_t *) digest);
+}
+
+
+uint64_t digest_value(const digest_t *const digest)
+{
+    assert(digest);
+    return get_digest_header(digest)->value;
+}
+
+
+size_t digest_chunks(const digest_t *const digest)
+{
+    assert(digest);
+    return vector_capacity((const vector_t *) digest);
+}
+
+
+uint64_t digest_update(digest_t *const digest,
+        const vector_t *const vector,
+        const size_t offset,
+        const size_t length)
+{
+    assert(digest);
+    assert(vector);
+
+    digest_header_t *header = get_digest_header(digest);
+    assert((vector_element_size(vector) == header->element_size) && "Element sizes differ!");
+    assert((header->size <= vector_capacity_bytes(vector)) && "Vector is smaller than hashed range!");
+    assert(((offset + length) * header->element_size <= header->size) && "Dirty range out of hashed range!");
+
+    if (0 == length)
+    {
+        return header->value;
+    }
+
+    digest_job_t job = {
+        .data = vector_data(vector),
+        .size = header->size,
+        .seed = header->seed,
+        .digests = (uint64_t *) vector_data((vector_t *) digest),
+        .first = offset * header->element_size / VECTOR_HASH_CHUNK,
+        .last = ((offset + length) * header->element_size - 1) / VECTOR_HASH_CHUNK + 1,
+    };
+
+    hash_chunks(&job);
+    refold(digest);
+    return header->value;
+}
+
+
+/*                        **
+* === Static Functions === *
+*                         */
+
+static digest_header_t *get_digest_header(const digest_t *const digest)
+{
+    return (digest_header_t *) vector_get_ext_header((const vector_t *) digest);
+}
+
+
+static void *hash_chunks(void *const job)
+{
+    const digest_job_t *const j = job;
+
+    for (size_t chunk = j->first; chunk < j->last; ++chunk)
+    {
+        const size_t begin = chunk * VECTOR_HASH_CHUNK;
+        const size_t size = j->size - begin < VECTOR_HASH_CHUNK ? j->size - begin : VECTOR_HASH_CHUNK;
+        j->digests[chunk] = vector_hash_bytes(j->data + begin, size, j->seed);
+    }
+
+    return NULL;
+}
+
+
+static void refold(digest_t *const digest)
+{
+    digest_header_t *header = get_digest_header(digest);
+
+    header->value = vector_hash_fold((const uint64_t *) vector_data((const vector_t *) digest),
+            digest_chunks(digest), header->size, header->seed);
+}
@@ -0,0 +1,119 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Public interface of the incremental content digest
+*/
+
+#ifndef _DIGEST_H_
+#define _DIGEST_H_
+
+#include "vector.h"
+
+/**
+* @brief   Incremental content digest of a vector range.
+* @details Derived from @ref vector_t, keeps @ref vector_hash_bytes digest
+*          of every @ref VECTOR_HASH_CHUNK bytes of the range,
+*          so after a modification only the chunks overlapping dirty elements are rehashed.
+*          Digest value always equals @ref vector_hash of the same range with the same seed.
+*          Chunks can be hashed by several threads on creation.
+*/
+typedef struct digest_t digest_t;
+
+/**
+* @brief   Digest options.
+* @details Parameters that are passed to a @ref digest_create_ function.
+*/
+typedef struct digest_opts_t
+{
+    alloc_opts_t alloc_opts;  /**< @brief optional allocator */
+    /* required: */
+    const vector_t *vector;   /**< @brief Vector to be hashed. */
+    size_t length;            /**< @brief Amount of elements to be hashed. */
+
+    /* optional: */
+    uint64_t seed;            /**< @brief Seed of the hash function. */
+    size_t threads;           /**< @brief Amount of threads hashing chunks on creation. */
+}
+digest_opts_t;
+
+/**
+* Represents digest default create values.
+*/
+#define DIGEST_DEFAULT_ARGS \
+    .threads = 1
+
+/**
+ * @addtogroup Digest_API Digest API
+ * @brief      Incremental content digest methods. @{ */
+
+/**
+* @brief   Digest constructor.
+* @details Preferable way to invoke constructor.
+*          Provides default values.
+* @warning @ref digest_opts_t::vector "vector" is mandatory!
+* @see digest_create_
+*/
+#define digest_create(...) \
+    digest_create_( \
+        &(digest_opts_t) { \
+            DIGEST_DEFAULT_ARGS,\
+            __VA_ARGS__ \
+        }\
+    )\
+
+/**
+* @brief   Digest constructor, hashes the whole range.
+* @details When more than one thread is requested, chunks are split between
+*          the calling thread and helper threads, if a helper could not be started
+*          its share is hashed by the calling thread.
+*
+* @param[in] opts Options according to which digest will be created.
+* @returns        Fresh new digest or @c NULL if allocation failed.
+*/
+digest_t *digest_create_(const digest_opts_t *const opts);
+
+
+/**
+* @brief   Deallocates digest.
+*
+* @param[in] digest Digest that will be deallocated.
+*/
+void digest_destroy(digest_t *const digest);
+
+
+/**
+* @brief   Reports digest value.
+*
+* @param[in] digest Pointer to a digest instance.
+* @returns          Hash of the range, same as @ref vector_hash.
+*/
+uint64_t digest_value(const digest_t *const digest);
+
+
+/**
+* @brief   Reports amount of independently hashed chunks.
+*
+* @param[in] digest Pointer to a digest instance.
+* @returns          Amount of chunks, at least one.
+*/
+size_t digest_chunks(const digest_t *const digest);
+
+
+/**
+* @brief   Rehashes chunks overlapping a dirty range of elements.
+* @details Chunk digests are then folded again, which is cheap compared to hashing.
+*
+* @param[in] digest Pointer to a digest instance.
+* @param[in] vector Vector with modified contents, same element size and range as on creation.
+* @param[in] offset Offset of the first modified element.
+* @param[in] length Amount of modified elements.
+* @returns          Updated digest value.
+*/
+uint64_t digest_update(digest_t *const digest,
+        const vector_t *const vector,
+        const size_t offset,
+        const size_t length);
+
+/** @} @noop Digest_API */
+
+#endif/*_DIGEST_H_*/
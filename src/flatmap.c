@@ -0,0 +1,493 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Implementation of the sorted flat map
+*/
+
+#include "flatmap.h"
+#include "memswap.h"
+
+#include <assert.h> /** assert */
+#include <string.h> /** memcpy, memmove */
+
+/**
+ * @internal
+ * @brief Map state stored in vector's extension header,
+ *        followed by the unsorted staging area.
+ */
+typedef struct flatmap_header_t
+{
+    size_t size;         /**< @brief Amount of entries in the sorted body. */
+    size_t staged;       /**< @brief Amount of entries in the staging area. */
+    size_t stage_cap;    /**< @brief Capacity of the staging area. */
+    size_t key_size;     /**< @brief Size of the key type. */
+    size_t value_offset; /**< @brief Offset of the value inside of an entry. */
+    size_t value_size;   /**< @brief Size of the value type. */
+    compare_t cmp;       /**< @brief Key ordering. */
+    void *param;         /**< @brief User parameter passed to @ref flatmap_header_t::cmp "cmp". */
+}
+flatmap_header_t;
+
+/*                             *
+* === Forward Declarations === *
+*                             */
+
+/**
+* @brief   Access map state.
+*/
+static flatmap_header_t *get_flatmap_header(const flatmap_t *const map);
+
+/**
+* @brief   Access first entry of the staging area.
+*/
+static char *get_stage(const flatmap_t *const map);
+
+/**
+* @brief   Finds first entry in a sorted span not less than @c key.
+* @param[out] found Set to @c true if entry at returned position equals @c key.
+*/
+static size_t lower_bound(const flatmap_header_t *const header,
+        const char *const entries,
+        const size_t entry_size,
+        const size_t count,
+        const void *const key,
+        bool *const found);
+
+/**
+* @brief   Finds staged entry equal to @c key by linear scan.
+* @returns Position of the entry or @c header->staged if key is not staged.
+*/
+static size_t find_staged(const flatmap_header_t *const header,
+        const char *const stage,
+        const size_t entry_size,
+        const void *const key);
+
+/**
+* @brief   Finds smallest staged entry greater than @c prev, or the smallest one if @c prev is @c NULL.
+* @returns Pointer to the entry or @c NULL if there is none.
+*/
+static const char *next_staged(const flatmap_header_t *const header,
+        const char *const stage,
+        const size_t entry_size,
+        const char *const prev);
+
+/**
+* @brief   Heap sorts the staging area by key.
+*/
+static void sort_stage(const flatmap_header_t *const header, char *const stage, const size_t entry_size);
+
+/**
+* @brief   Restores max heap property below @c root.
+*/
+static void sift_down(const flatmap_header_t *const header,
+        char *const entries,
+        const size_t entry_size,
+        size_t root,
+        const size_t count);
+
+/**
+* @brief   Picks value alignment, the largest power of two dividing value size.
+*/
+static size_t value_alignment(const size_t value_size);
+
+/**
+* @brief   Copies value into an entry, set usage without values copies nothing.
+*/
+static void store_value(const flatmap_header_t *const header, char *const entry, const void *const value);
+
+
+/*                             *
+* === API Implementation   === *
+*                             */
+
+flatmap_t *flatmap_create_(const flatmap_opts_t *const opts)
+{
+    assert(opts && "non-null opts required!");
+    assert(opts->key_size && "'key_size' gt then zero required!");
+    assert(opts->stage_cap && "'stage_cap' gt then zero required!");
+
+    const size_t value_offset = calc_aligned_size(opts->key_size, value_alignment(opts->value_size));
+    const size_t entry_size = calc_aligned_size(value_offset + opts->value_size,
+            value_alignment(opts->value_size) > value_alignment(opts->key_size)
+                ? value_alignment(opts->value_size) : value_alignment(opts->key_size));
+
+    vector_t *vector = vector_create_(&(vector_opts_t) {
+        .alloc_opts = opts->alloc_opts,
+        .ext_header_size = calc_aligned_size(sizeof(flatmap_header_t), sizeof(max_align_t))
+            + opts->stage_cap * entry_size,
+        .element_size = entry_size,
+        .initial_cap = opts->initial_cap,
+    });
+
+    if (!vector)
+    {
+        return NULL;
+    }
+
+    *(flatmap_header_t *) vector_get_ext_header(vector) = (flatmap_header_t) {
+        .stage_cap = opts->stage_cap,
+        .key_size = opts->key_size,
+        .value_offset = value_offset,
+        .value_size = opts->value_size,
+        .cmp = opts->cmp ? opts->cmp : cmp_lex_asc,
+        .param = opts->cmp ? opts->param : (void *) opts->key_size,
+    };
+    return (flatmap_t *) vector;
+}
+
+
+void flatmap_destroy(flatmap_t *const map)
+{
+    assert(map);
+    vector_destroy((vector_t *) map);
+}
+
+
+size_t flatmap_size(const flatmap_t *const map)
+{
+    assert(map);
+    const flatmap_header_t *header = get_flatmap_header(map);
+    return header->size + header->staged;
+}
+
+
+flatmap_status_t flatmap_insert(flatmap_t **const map, const void *const key, const void *const value)
+{
+    assert(map && *map);
+    assert(key);
+    assert(value || !get_flatmap_header(*map)->value_size);
+
+    flatmap_header_t *header = get_flatmap_header(*map);
+    const size_t entry_size = vector_element_size((vector_t *) *map);
+    bool found;
+
+    /* existing keys are updated in place */
+    const size_t body_pos = lower_bound(header, vector_data((vector_t *) *map), entry_size, header->size, key, &found);
+    if (found)
+    {
+        store_value(header, vector_data((vector_t *) *map) + body_pos * entry_size, value);
+        return FLATMAP_SUCCESS;
+    }
+
+    char *stage = get_stage(*map);
+    const size_t pos = find_staged(header, stage, entry_size, key);
+    if (pos < header->staged)
+    {
+        store_value(header, stage + pos * entry_size, value);
+        return FLATMAP_SUCCESS;
+    }
+
+    if (header->staged == header->stage_cap)
+    {
+        flatmap_status_t status = flatmap_flush(map);
+        if (FLATMAP_SUCCESS != status)
+        {
+            return status;
+        }
+
+        header = get_flatmap_header(*map);
+        stage = get_stage(*map);
+    }
+
+    /* staging is unsorted, new keys are appended */
+    char *entry = stage + header->staged * entry_size;
+    memcpy(entry, key, header->key_size);
+    store_value(header, entry, value);
+    ++header->staged;
+    return FLATMAP_SUCCESS;
+}
+
+
+void *flatmap_get(const flatmap_t *const map, const void *const key)
+{
+    assert(map);
+    assert(key);
+
+    const flatmap_header_t *header = get_flatmap_header(map);
+    const size_t entry_size = vector_element_size((const vector_t *) map);
+    bool found;
+
+    char *body = vector_data((const vector_t *) map);
+    size_t pos = lower_bound(header, body, entry_size, header->size, key, &found);
+    if (found)
+    {
+        return body + pos * entry_size + header->value_offset;
+    }
+
+    char *stage = get_stage(map);
+    pos = find_staged(header, stage, entry_size, key);
+    return (pos < header->staged) ? stage + pos * entry_size + header->value_offset : NULL;
+}
+
+
+bool flatmap_remove(flatmap_t *const map, const void *const key)
+{
+    assert(map);
+    assert(key);
+
+    flatmap_header_t *header = get_flatmap_header(map);
+    const size_t entry_size = vector_element_size((vector_t *) map);
+    bool found;
+
+    char *stage = get_stage(map);
+    size_t pos = find_staged(header, stage, entry_size, key);
+    if (pos < header->staged)
+    {
+        /* staging is unsorted, last entry fills the hole */
+        if (--header->staged > pos)
+        {
+            memcpy(stage + pos * entry_size, stage + header->staged * entry_size, entry_size);
+        }
+        return true;
+    }
+
+    pos = lower_bound(header, vector_data((vector_t *) map), entry_size, header->size, key, &found);
+    if (found)
+    {
+        if (--header->size > pos)
+        {
+            vector_shift((vector_t *) map, pos + 1, header->size - pos, -1);
+        }
+        return true;
+    }
+
+    return false;
+}
+
+
+flatmap_status_t flatmap_flush(flatmap_t **const map)
+{
+    assert(map && *map);
+
+    vector_t *vector = (vector_t *) *map;
+    flatmap_header_t *header = vector_get_ext_header(vector);
+    if (0 == header->staged)
+    {
+        return FLATMAP_SUCCESS;
+    }
+
+    const size_t required = header->size + header->staged;
+    const size_t capacity = vector_capacity(vector);
+    if (required > capacity)
+    {
+        /* at least double, keeps amortized merge cost linear */
+        const size_t desired = (required > capacity * 2) ? required : capacity * 2;
+        vector_status_t status = vector_resize(&vector, desired, VECTOR_ALLOC_ERROR);
+        if (VECTOR_SUCCESS != status)
+        {
+            return (flatmap_status_t) status;
+        }
+
+        *map = (flatmap_t *) vector;
+        header = vector_get_ext_header(vector);
+    }
+
+    /* staging is sorted once per merge, then merged backward,
+       staged keys are never present in the body */
+    const size_t entry_size = vector_element_size(vector);
+    char *stage = get_stage(*map);
+    sort_stage(header, stage, entry_size);
+
+    char *body = vector_data(vector);
+    size_t i = header->size;
+    size_t j = header->staged;
+    size_t k = required;
+
+    while (j > 0)
+    {
+        const char *staged = stage + (j - 1) * entry_size;
+        if (i > 0 && header->cmp(body + (i - 1) * entry_size, staged, header->param) > 0)
+        {
+            memcpy(body + --k * entry_size, body + --i * entry_size, entry_size);
+        }
+        else
+        {
+            memcpy(body + --k * entry_size, staged, entry_size);
+            --j;
+        }
+    }
+
+    header->size = required;
+    header->staged = 0;
+    return FLATMAP_SUCCESS;
+}
+
+
+void *flatmap_value(const flatmap_t *const map, const void *const entry)
+{
+    assert(map);
+    assert(entry);
+    return (char *) entry + get_flatmap_header(map)->value_offset;
+}
+
+
+int flatmap_foreach(const flatmap_t *const map, const foreach_t func, void *const param)
+{
+    assert(map);
+    assert(func);
+
+    const flatmap_header_t *header = get_flatmap_header(map);
+    const size_t entry_size = vector_element_size((const vector_t *) map);
+    const char *stage = get_stage(map);
+    const char *body = vector_data((const vector_t *) map);
+    const char *staged = next_staged(header, stage, entry_size, NULL);
+    size_t i = 0;
+
+    while (i < header->size || staged)
+    {
+        const char *entry;
+        if (!staged
+            || (i < header->size && header->cmp(body + i * entry_size, staged, header->param) < 0))
+        {
+            entry = body + i++ * entry_size;
+        }
+        else
+        {
+            /* staging is unsorted and the map is immutable here, select staged entries in order */
+            entry = staged;
+            staged = next_staged(header, stage, entry_size, staged);
+        }
+
+        int status = func(entry, param);
+        if (status) return status;
+    }
+
+    return 0;
+}
+
+
+/*                        **
+* === Static Functions === *
+*                         */
+
+static flatmap_header_t *get_flatmap_header(const flatmap_t *const map)
+{
+    return (flatmap_header_t *) vector_get_ext_header((const vector_t *) map);
+}
+
+
+static char *get_stage(const flatmap_t *const map)
+{
+    return (char *) vector_get_ext_header((const vector_t *) map)
+        + calc_aligned_size(sizeof(flatmap_header_t), sizeof(max_align_t));
+}
+
+
+static size_t lower_bound(const flatmap_header_t *const header,
+        const char *const entries,
+        const size_t entry_size,
+        const size_t count,
+        const void *const key,
+        bool *const found)
+{
+    size_t low = 0, high = count;
+    while (low < high)
+    {
+        const size_t mid = low + (high - low) / 2;
+        if (header->cmp(key, entries + mid * entry_size, header->param) > 0)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    *found = (low < count) && (0 == header->cmp(key, entries + low * entry_size, header->param));
+    return low;
+}
+
+
+static size_t find_staged(const flatmap_header_t *const header,
+        const char *const stage,
+        const size_t entry_size,
+        const void *const key)
+{
+    size_t pos = 0;
+    while (pos < header->staged && 0 != header->cmp(key, stage + pos * entry_size, header->param))
+    {
+        ++pos;
+    }
+    return pos;
+}
+
+
+static const char *next_staged(const flatmap_header_t *const header,
+        const char *const stage,
+        const size_t entry_size,
+        const char *const prev)
+{
+    const char *next = NULL;
+    for (size_t j = 0; j < header->staged; ++j)
+    {
+        const char *entry = stage + j * entry_size;
+        if ((!prev || header->cmp(entry, prev, header->param) > 0)
+            && (!next || header->cmp(entry, next, header->param) < 0))
+        {
+            next = entry;
+        }
+    }
+    return next;
+}
+
+
+static void sort_stage(const flatmap_header_t *const header, char *const stage, const size_t entry_size)
+{
+    for (size_t root = header->staged / 2; root > 0; --root)
+    {
+        sift_down(header, stage, entry_size, root - 1, header->staged);
+    }
+
+    for (size_t count = header->staged; count > 1; --count)
+    {
+        memswap(stage, stage + (count - 1) * entry_size, entry_size);
+        sift_down(header, stage, entry_size, 0, count - 1);
+    }
+}
+
+
+static void sift_down(const flatmap_header_t *const header,
+        char *const entries,
+        const size_t entry_size,
+        size_t root,
+        const size_t count)
+{
+    for (size_t child = 2 * root + 1; child < count; child = 2 * root + 1)
+    {
+        if (child + 1 < count
+            && header->cmp(entries + child * entry_size, entries + (child + 1) * entry_size, header->param) < 0)
+        {
+            ++child;
+        }
+
+        if (header->cmp(entries + root * entry_size, entries + child * entry_size, header->param) >= 0)
+        {
+            return;
+        }
+
+        memswap(entries + root * entry_size, entries + child * entry_size, entry_size);
+        root = child;
+    }
+}
+
+
+static size_t value_alignment(const size_t value_size)
+{
+    size_t alignment = 1;
+    while (alignment < sizeof(max_align_t) && value_size && !(value_size & alignment))
+    {
+        alignment <<= 1;
+    }
+    return alignment;
+}
+
+
+static void store_value(const flatmap_header_t *const header, char *const entry, const void *const value)
+{
+    /* value may be NULL when values are absent */
+    if (header->value_size)
+    {
+        memcpy(entry + header->value_offset, value, header->value_size);
+    }
+}
@@ -0,0 +1,176 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Public interface of the sorted flat map
+*/
+
+#ifndef _FLATMAP_H_
+#define _FLATMAP_H_
+
+#include "vector.h"
+
+/**
+* @brief   Sorted flat map derived from @ref vector_t.
+* @details Entries (key followed by value) are kept sorted by key in vector's buffer.
+*          New keys are first appended to a small unsorted staging area
+*          stored in the extension header. When staging is full, it is sorted
+*          once and merged into the body in one backward pass, so bulk inserts
+*          neither shift the body nor the staging area for every entry.
+*          Lookups binary search the body and scan the staging area.
+*          Functions that can grow the map take a double pointer.
+*/
+typedef struct flatmap_t flatmap_t;
+
+/**
+* @brief   Flat map options.
+* @details Parameters that are passed to a @ref flatmap_create_ function.
+*/
+typedef struct flatmap_opts_t
+{
+    alloc_opts_t alloc_opts;  /**< @brief optional allocator */
+    /* required: */
+    size_t key_size;          /**< @brief Size of the key type. */
+    size_t value_size;        /**< @brief Size of the value type. */
+
+    /* optional: */
+    compare_t cmp;            /**< @brief Key ordering, bytewise @ref cmp_lex_asc if @c NULL. */
+    void *param;              /**< @brief User parameter passed to @ref flatmap_opts_t::cmp "cmp". */
+    size_t initial_cap;       /**< @brief Preallocated entries in the sorted body. */
+    size_t stage_cap;         /**< @brief Entries buffered before merge. */
+}
+flatmap_opts_t;
+
+/**
+* @brief   Status of flat map operations that may fail.
+* @details Extends @ref vector_status_t.
+*/
+typedef enum flatmap_status_t
+{
+    FLATMAP_SUCCESS = VECTOR_SUCCESS,         /**< Success operation status code. */
+    FLATMAP_ALLOC_ERROR = VECTOR_ALLOC_ERROR, /**< Allocation error status code. */
+    FLATMAP_STATUS_LAST = VECTOR_STATUS_LAST  /**< Indicates end of the enum values. */
+}
+flatmap_status_t;
+
+/**
+* Represents flat map default create values.
+*/
+#define FLATMAP_DEFAULT_ARGS \
+    .initial_cap = 16, \
+    .stage_cap = 32
+
+/**
+ * @addtogroup Flatmap_API Flat Map API
+ * @brief      Sorted flat map methods. @{ */
+
+/**
+* @brief   Flat map constructor.
+* @details Preferable way to invoke flat map constructor.
+*          Provides default values.
+* @warning @ref flatmap_opts_t::key_size "key_size" is mandatory!
+* @see flatmap_create_
+*/
+#define flatmap_create(...) \
+    flatmap_create_( \
+        &(flatmap_opts_t) { \
+            FLATMAP_DEFAULT_ARGS,\
+            __VA_ARGS__ \
+        }\
+    )\
+
+/**
+* @brief   Flat map constructor.
+*
+* @param[in] opts Options according to which map will be created.
+* @returns        Fresh new empty map or @c NULL if allocation failed.
+*/
+flatmap_t *flatmap_create_(const flatmap_opts_t *const opts);
+
+
+/**
+* @brief   Deallocates map.
+*
+* @param[in] map Map pointer that will be deallocated.
+*/
+void flatmap_destroy(flatmap_t *const map);
+
+
+/**
+* @brief   Reports amount of stored entries.
+*
+* @param[in] map Pointer to a map instance.
+* @returns       Amount of entries, staged ones included.
+*/
+size_t flatmap_size(const flatmap_t *const map);
+
+
+/**
+* @brief   Inserts entry or overwrites value of an existing key.
+* @details Existing keys are updated in place, new keys are staged.
+*          Full staging area is merged into the body first.
+*
+* @param[in] map   Reference to map pointer.
+* @param[in] key   Key to be copied.
+* @param[in] value Value to be copied.
+* @returns         Operation status.
+*/
+flatmap_status_t flatmap_insert(flatmap_t **const map, const void *const key, const void *const value);
+
+
+/**
+* @brief   Looks up value by key in O(log n + stage_cap).
+*
+* @param[in] map Pointer to a map instance.
+* @param[in] key Key to be found.
+* @returns       Pointer to the value or @c NULL if key is absent.
+*/
+void *flatmap_get(const flatmap_t *const map, const void *const key);
+
+
+/**
+* @brief   Removes entry by key.
+* @details Removal from the body shifts its tail.
+*
+* @param[in] map Pointer to a map instance.
+* @param[in] key Key to be removed.
+* @returns       @c true if entry was removed, @c false if key is absent.
+*/
+bool flatmap_remove(flatmap_t *const map, const void *const key);
+
+
+/**
+* @brief   Merges staged entries into the sorted body.
+*
+* @param[in] map Reference to map pointer.
+* @returns       Operation status.
+*/
+flatmap_status_t flatmap_flush(flatmap_t **const map);
+
+
+/**
+* @brief   Access value of an entry passed to @ref flatmap_foreach callback.
+*
+* @param[in] map   Pointer to a map instance.
+* @param[in] entry Pointer to an entry, starts with the key.
+* @returns         Pointer to the value of the entry.
+*/
+void *flatmap_value(const flatmap_t *const map, const void *const entry);
+
+
+/**
+* @brief   Perform immutable action on each entry in key order.
+* @details Body and staging area are merged on the fly, nothing is modified.
+*          Staged entries are selected in order by scanning the staging area.
+*          Callback receives pointer to an entry, which starts with the key,
+*          see @ref flatmap_value.
+*
+* @param[in] map        Pointer to a map instance.
+* @param[in] func       Action to be performed.
+* @param[in,out] param  User defined parameter, passed to func.
+* @returns              Zero on success, or nonzero value - user defined status code.
+*/
+int flatmap_foreach(const flatmap_t *const map, const foreach_t func, void *const param);
+
+/** @} @noop Flatmap_API */
+
+#endif/*_FLATMAP_H_*/
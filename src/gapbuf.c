@@ -0,0 +1,244 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Implementation of the gap buffer
+*/
+
+#include "gapbuf.h"
+
+#include <assert.h> /** assert */
+#include <string.h> /** memcpy */
+
+/**
+ * @internal
+ * @brief Gap boundaries stored in the vector's extension header.
+ */
+typedef struct gapbuf_header_t
+{
+    size_t gap_start; /**< @brief First index of the gap, cursor position. */
+    size_t gap_end;   /**< @brief First index after the gap. */
+}
+gapbuf_header_t;
+
+/*                             *
+* === Forward Declarations === *
+*                             */
+
+/**
+* @brief   Access gap boundaries.
+*/
+static gapbuf_header_t *get_gapbuf_header(const gapbuf_t *const gapbuf);
+
+
+/*                             *
+* === API Implementation   === *
+*                             */
+
+gapbuf_t *gapbuf_create_(const gapbuf_opts_t *const opts)
+{
+    assert(opts && "non-null opts required!");
+    assert(opts->element_size && "'element_size' gt then zero required!");
+
+    vector_t *vector = vector_create_(&(vector_opts_t) {
+        .alloc_opts = opts->alloc_opts,
+        .ext_header_size = sizeof(gapbuf_header_t),
+        .element_size = opts->element_size,
+        .initial_cap = opts->initial_cap,
+    });
+
+    if (!vector)
+    {
+        return NULL;
+    }
+
+    *(gapbuf_header_t *) vector_get_ext_header(vector) = (gapbuf_header_t) {
+        .gap_start = 0,
+        .gap_end = opts->initial_cap,
+    };
+
+    return (gapbuf_t *) vector;
+}
+
+
+void gapbuf_destroy(gapbuf_t *const gapbuf)
+{
+    assert(gapbuf);
+    vector_destroy((vector_t *) gapbuf);
+}
+
+
+size_t gapbuf_length(const gapbuf_t *const gapbuf)
+{
+    assert(gapbuf);
+
+    const gapbuf_header_t *header = get_gapbuf_header(gapbuf);
+    return vector_capacity((const vector_t *) gapbuf) - (header->gap_end - header->gap_start);
+}
+
+
+size_t gapbuf_cursor(const gapbuf_t *const gapbuf)
+{
+    assert(gapbuf);
+    return get_gapbuf_header(gapbuf)->gap_start;
+}
+
+
+void gapbuf_move(gapbuf_t *const gapbuf, const size_t position)
+{
+    assert(gapbuf);
+    assert((position <= gapbuf_length(gapbuf)) && "Position out of bounds!");
+
+    vector_t *vector = (vector_t *) gapbuf;
+    gapbuf_header_t *header = get_gapbuf_header(gapbuf);
+
+    if (position < header->gap_start)
+    {
+        /* [position, gap_start) goes right behind the gap */
+        const size_t count = header->gap_start - position;
+        vector_move(vector, vector_get(vector, header->gap_end - count), position, count);
+        header->gap_start -= count;
+        header->gap_end -= count;
+    }
+    else if (position > header->gap_start)
+    {
+        /* [gap_end, gap_end + count) goes in front of the gap */
+        const size_t count = position - header->gap_start;
+        vector_move(vector, vector_get(vector, header->gap_start), header->gap_end, count);
+        header->gap_start += count;
+        header->gap_end += count;
+    }
+}
+
+
+gapbuf_status_t gapbuf_insert(gapbuf_t **const gapbuf, const void *const values, const size_t count)
+{
+    assert(gapbuf && *gapbuf);
+    assert(values || !count);
+
+    vector_t *vector = (vector_t *) *gapbuf;
+    gapbuf_header_t *header = get_gapbuf_header(*gapbuf);
+
+    if (header->gap_end - header->gap_start < count)
+    {
+        const size_t capacity = vector_capacity(vector);
+        const size_t tail = capacity - header->gap_end;
+        const size_t required = capacity - (header->gap_end - header->gap_start) + count;
+        const size_t new_capacity = capacity * 2 > required ? capacity * 2 : required;
+
+        if (VECTOR_SUCCESS != vector_resize(&vector, new_capacity, VECTOR_ALLOC_ERROR))
+        {
+            return GAPBUF_ALLOC_ERROR;
+        }
+
+        *gapbuf = (gapbuf_t *) vector;
+        header = get_gapbuf_header(*gapbuf);
+
+        if (tail)
+        {
+            vector_move(vector, vector_get(vector, new_capacity - tail), header->gap_end, tail);
+        }
+        header->gap_end = new_capacity - tail;
+    }
+
+    if (count)
+    {
+        memcpy(vector_get(vector, header->gap_start), values, count * vector_element_size(vector));
+        header->gap_start += count;
+    }
+
+    return GAPBUF_SUCCESS;
+}
+
+
+void gapbuf_erase_before(gapbuf_t *const gapbuf, const size_t count)
+{
+    assert(gapbuf);
+
+    gapbuf_header_t *header = get_gapbuf_header(gapbuf);
+    assert((count <= header->gap_start) && "Erase range out of bounds!");
+
+    header->gap_start -= count;
+}
+
+
+void gapbuf_erase_after(gapbuf_t *const gapbuf, const size_t count)
+{
+    assert(gapbuf);
+
+    gapbuf_header_t *header = get_gapbuf_header(gapbuf);
+    assert((count <= vector_capacity((const vector_t *) gapbuf) - header->gap_end)
+            && "Erase range out of bounds!");
+
+    header->gap_end += count;
+}
+
+
+void *gapbuf_get(const gapbuf_t *const gapbuf, const size_t index)
+{
+    assert(gapbuf);
+    assert((index < gapbuf_length(gapbuf)) && "Index out of bounds!");
+
+    const gapbuf_header_t *header = get_gapbuf_header(gapbuf);
+    const size_t physical = index < header->gap_start
+        ? index
+        : index + (header->gap_end - header->gap_start);
+
+    return vector_get((const vector_t *) gapbuf, physical);
+}
+
+
+void gapbuf_copy(const gapbuf_t *const gapbuf, void *const dest, const size_t offset, const size_t length)
+{
+    assert(gapbuf);
+    assert(dest || !length);
+    assert((offset + length <= gapbuf_length(gapbuf)) && "Range out of bounds!");
+
+    const vector_t *vector = (const vector_t *) gapbuf;
+    const gapbuf_header_t *header = get_gapbuf_header(gapbuf);
+    const size_t gap = header->gap_end - header->gap_start;
+    size_t head = 0;
+
+    if (offset < header->gap_start)
+    {
+        head = header->gap_start - offset < length ? header->gap_start - offset : length;
+        vector_copy(vector, dest, offset, head);
+    }
+
+    if (head < length)
+    {
+        vector_copy(vector, (char *) dest + head * vector_element_size(vector),
+                offset + head + gap, length - head);
+    }
+}
+
+
+int gapbuf_foreach(const gapbuf_t *const gapbuf, const foreach_t func, void *const param)
+{
+    assert(gapbuf);
+    assert(func);
+
+    const vector_t *vector = (const vector_t *) gapbuf;
+    const gapbuf_header_t *header = get_gapbuf_header(gapbuf);
+    const size_t capacity = vector_capacity(vector);
+
+    for (size_t i = 0; i < capacity; ++i)
+    {
+        if (i == header->gap_start) i = header->gap_end;
+        if (i == capacity) break;
+
+        int status = func(vector_get(vector, i), param);
+        if (status) return status;
+    }
+
+    return 0;
+}
+
+
+/*                        **
+* === Static Functions === *
+*                         */
+
+static gapbuf_header_t *get_gapbuf_header(const gapbuf_t *const gapbuf)
+{
+    return (gapbuf_header_t *) vector_get_ext_header((const vector_t *) gapbuf);
+}
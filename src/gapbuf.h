@@ -0,0 +1,178 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Public interface of the gap buffer
+*/
+
+#ifndef _GAPBUF_H_
+#define _GAPBUF_H_
+
+#include "vector.h"
+
+/**
+* @brief   Gap buffer for localized insertions and deletions.
+* @details Derived from @ref vector_t, elements occupy both ends of the capacity
+*          leaving a movable gap in between, the gap starts at the cursor.
+*          Inserting or erasing next to the cursor touches only the gap boundaries,
+*          moving the cursor moves the elements in between with a single @ref vector_move.
+*          Functions that can grow the buffer take a double pointer.
+*/
+typedef struct gapbuf_t gapbuf_t;
+
+/**
+* @brief   Gap buffer options.
+* @details Parameters that are passed to a @ref gapbuf_create_ function.
+*/
+typedef struct gapbuf_opts_t
+{
+    alloc_opts_t alloc_opts;  /**< @brief optional allocator */
+    /* required: */
+    size_t element_size;      /**< @brief Size of the stored element type. */
+
+    /* optional: */
+    size_t initial_cap;       /**< @brief Amount of elements that will be preallocated. */
+}
+gapbuf_opts_t;
+
+/**
+* @brief   Status of gap buffer operations that may fail.
+* @details Extends @ref vector_status_t.
+*/
+typedef enum gapbuf_status_t
+{
+    GAPBUF_SUCCESS = VECTOR_SUCCESS,         /**< Success operation status code. */
+    GAPBUF_ALLOC_ERROR = VECTOR_ALLOC_ERROR, /**< Allocation error status code. */
+    GAPBUF_STATUS_LAST = VECTOR_STATUS_LAST  /**< Indicates end of the enum values. */
+}
+gapbuf_status_t;
+
+/**
+* Represents gap buffer default create values.
+*/
+#define GAPBUF_DEFAULT_ARGS \
+    .initial_cap = 64
+
+/**
+ * @addtogroup Gapbuf_API Gap Buffer API
+ * @brief      Gap buffer methods. @{ */
+
+/**
+* @brief   Gap buffer constructor.
+* @details Preferable way to invoke constructor.
+*          Provides default values.
+* @warning @ref gapbuf_opts_t::element_size "element_size" is mandatory!
+* @see gapbuf_create_
+*/
+#define gapbuf_create(...) \
+    gapbuf_create_( \
+        &(gapbuf_opts_t) { \
+            GAPBUF_DEFAULT_ARGS,\
+            __VA_ARGS__ \
+        }\
+    )\
+
+/**
+* @brief   Gap buffer constructor.
+*
+* @param[in] opts Options according to which buffer will be created.
+* @returns        Fresh new empty buffer with cursor at zero or @c NULL if allocation failed.
+*/
+gapbuf_t *gapbuf_create_(const gapbuf_opts_t *const opts);
+
+
+/**
+* @brief   Deallocates buffer.
+*
+* @param[in] gapbuf Buffer that will be deallocated.
+*/
+void gapbuf_destroy(gapbuf_t *const gapbuf);
+
+
+/**
+* @brief   Reports amount of stored elements.
+*
+* @param[in] gapbuf Pointer to a buffer instance.
+* @returns          Amount of elements on both sides of the gap.
+*/
+size_t gapbuf_length(const gapbuf_t *const gapbuf);
+
+
+/**
+* @brief   Reports cursor position.
+*
+* @param[in] gapbuf Pointer to a buffer instance.
+* @returns          Amount of elements before the gap.
+*/
+size_t gapbuf_cursor(const gapbuf_t *const gapbuf);
+
+
+/**
+* @brief   Moves cursor to a logical @c position.
+* @details Elements between old and new position are relocated across the gap
+*          with a single @ref vector_move.
+*
+* @param[in] gapbuf   Pointer to a buffer instance.
+* @param[in] position New cursor position, not greater than @ref gapbuf_length.
+*/
+void gapbuf_move(gapbuf_t *const gapbuf, const size_t position);
+
+
+/**
+* @brief   Inserts elements at the cursor.
+* @details Cursor advances past inserted elements.
+*          Buffer doubles its capacity when the gap is too small.
+*
+* @param[in] gapbuf Reference to buffer pointer.
+* @param[in] values Pointer to @c count consecutive elements.
+* @param[in] count  Amount of elements to insert.
+* @returns          @ref GAPBUF_SUCCESS or @ref GAPBUF_ALLOC_ERROR, buffer is left intact on failure.
+*/
+gapbuf_status_t gapbuf_insert(gapbuf_t **const gapbuf, const void *const values, const size_t count);
+
+
+/**
+* @brief   Erases elements before the cursor, like backspace.
+*
+* @param[in] gapbuf Pointer to a buffer instance.
+* @param[in] count  Amount of elements to erase, not greater than @ref gapbuf_cursor.
+*/
+void gapbuf_erase_before(gapbuf_t *const gapbuf, const size_t count);
+
+
+/**
+* @brief   Erases elements after the cursor, like delete.
+*
+* @param[in] gapbuf Pointer to a buffer instance.
+* @param[in] count  Amount of elements to erase, not greater than
+*                   @ref gapbuf_length - @ref gapbuf_cursor.
+*/
+void gapbuf_erase_after(gapbuf_t *const gapbuf, const size_t count);
+
+
+/**
+* @brief   Returns pointer for the element at logical @c index.
+* @see vector_get
+*/
+void *gapbuf_get(const gapbuf_t *const gapbuf, const size_t index);
+
+
+/**
+* @brief   Copies logical element range skipping the gap.
+*
+* @param[in]  gapbuf Pointer to a buffer instance.
+* @param[out] dest   Destination for @c length elements.
+* @param[in]  offset Logical begin index.
+* @param[in]  length Amount of elements to copy.
+*/
+void gapbuf_copy(const gapbuf_t *const gapbuf, void *const dest, const size_t offset, const size_t length);
+
+
+/**
+* @brief   Perform immutable action on each element in logical order.
+* @see vector_foreach
+*/
+int gapbuf_foreach(const gapbuf_t *const gapbuf, const foreach_t func, void *const param);
+
+/** @} @noop Gapbuf_API */
+
+#endif/*_GAPBUF_H_*/
@@ -0,0 +1,583 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Implementation of the open addressing hash map
+*/
+
+#include "hashmap.h"
+
+#include <assert.h> /** assert */
+#include <stdint.h> /** uint64_t, uint32_t */
+#include <string.h> /** memcpy, memset */
+
+#if defined(__SSE2__)
+#include <emmintrin.h> /** _mm_cmpeq_epi8, _mm_movemask_epi8 */
+#endif
+
+/**
+ * @internal
+ * @brief Amount of control bytes probed at once.
+ */
+#define GROUP_SIZE 16
+
+/**
+ * @internal
+ * @brief Control byte of a slot that never held an entry, terminates probing.
+ */
+#define CTRL_EMPTY ((signed char) -128)
+
+/**
+ * @internal
+ * @brief Control byte of a slot whose entry was removed.
+ */
+#define CTRL_DELETED ((signed char) -2)
+
+/**
+ * @internal
+ * @brief Map state stored in vector's extension header,
+ *        followed by a scratch entry used while rehashing.
+ */
+typedef struct hashmap_header_t
+{
+    vector_t *ctrl;      /**< @brief Control bytes, first group is cloned past the end for wrap around loads. */
+    size_t mask;         /**< @brief Amount of slots minus one. */
+    size_t size;         /**< @brief Amount of stored entries. */
+    size_t growth_left;  /**< @brief Empty slots that may still be taken before rehash. */
+    size_t key_size;     /**< @brief Size of the key type. */
+    size_t value_offset; /**< @brief Offset of the value inside of an entry. */
+    size_t value_size;   /**< @brief Size of the value type. */
+    hash_t hash;         /**< @brief Key hash. */
+    void *hash_param;    /**< @brief Parameter passed to @ref hashmap_header_t::hash "hash". */
+    compare_t cmp;       /**< @brief Key equality. */
+    void *cmp_param;     /**< @brief Parameter passed to @ref hashmap_header_t::cmp "cmp". */
+}
+hashmap_header_t;
+
+/*                             *
+* === Forward Declarations === *
+*                             */
+
+/**
+* @brief   Access map state.
+*/
+static hashmap_header_t *get_hashmap_header(const hashmap_t *const map);
+
+/**
+* @brief   Access scratch entry.
+*/
+static void *get_scratch(const hashmap_t *const map);
+
+/**
+* @brief   Access control bytes.
+*/
+static signed char *get_ctrl(const hashmap_header_t *const header);
+
+/**
+* @brief   Sets control byte, keeping cloned group in sync.
+*/
+static void set_ctrl(const hashmap_header_t *const header, const size_t index, const signed char value);
+
+/**
+* @brief   Bitmask of group bytes equal to @c value.
+*/
+static uint32_t match_byte(const signed char *const group, const signed char value);
+
+/**
+* @brief   Bitmask of group bytes that are empty or deleted.
+*/
+static uint32_t match_free(const signed char *const group);
+
+/**
+* @brief   Bitmask of group bytes that are empty.
+*/
+static uint32_t match_empty(const signed char *const group);
+
+/**
+* @brief   Index of the lowest set bit.
+*/
+static unsigned lowest_bit(const uint32_t mask);
+
+/**
+* @brief   Finds slot holding @c key.
+* @returns Slot index or @c SIZE_MAX if key is absent.
+*/
+static size_t find_slot(const hashmap_t *const map, const void *const key, const size_t hash);
+
+/**
+* @brief   Finds first empty or deleted slot in probe sequence of @c hash.
+*/
+static size_t find_free_slot(const hashmap_header_t *const header, const size_t hash);
+
+/**
+* @brief   Rehashes all entries in place for a table of @c capacity slots.
+*/
+static hashmap_status_t rehash(hashmap_t **const map, const size_t capacity);
+
+/**
+* @brief   Default hash, mixes key bytes.
+*/
+static size_t hash_bytes(const void *const key, void *const param);
+
+/**
+* @brief   Maximal amount of entries for @c capacity slots.
+*/
+static size_t max_load(const size_t capacity);
+
+/**
+* @brief   Picks value alignment, the largest power of two dividing value size.
+*/
+static size_t value_alignment(const size_t value_size);
+
+
+/*                             *
+* === API Implementation   === *
+*                             */
+
+hashmap_t *hashmap_create_(const hashmap_opts_t *const opts)
+{
+    assert(opts && "non-null opts required!");
+    assert(opts->key_size && "'key_size' gt then zero required!");
+
+    size_t capacity = GROUP_SIZE;
+    while (capacity < opts->initial_cap) capacity <<= 1;
+
+    const size_t value_offset = calc_aligned_size(opts->key_size, value_alignment(opts->value_size));
+    const size_t entry_size = calc_aligned_size(value_offset + opts->value_size,
+            value_alignment(opts->value_size) > value_alignment(opts->key_size)
+                ? value_alignment(opts->value_size) : value_alignment(opts->key_size));
+
+    vector_t *vector = vector_create_(&(vector_opts_t) {
+        .alloc_opts = opts->alloc_opts,
+        .ext_header_size = calc_aligned_size(sizeof(hashmap_header_t), sizeof(max_align_t)) + entry_size,
+        .element_size = entry_size,
+        .initial_cap = capacity,
+    });
+
+    if (!vector)
+    {
+        return NULL;
+    }
+
+    vector_t *ctrl = vector_create(
+        .alloc_opts = vector_alloc_opts(vector),
+        .element_size = sizeof(signed char),
+        .initial_cap = capacity + GROUP_SIZE - 1
+    );
+
+    if (!ctrl)
+    {
+        vector_destroy(vector);
+        return NULL;
+    }
+
+    memset(vector_data(ctrl), CTRL_EMPTY, capacity + GROUP_SIZE - 1);
+
+    *(hashmap_header_t *) vector_get_ext_header(vector) = (hashmap_header_t) {
+        .ctrl = ctrl,
+        .mask = capacity - 1,
+        .growth_left = max_load(capacity),
+        .key_size = opts->key_size,
+        .value_offset = value_offset,
+        .value_size = opts->value_size,
+        .hash = opts->hash ? opts->hash : hash_bytes,
+        .hash_param = opts->hash ? opts->param : (void *) opts->key_size,
+        .cmp = opts->cmp ? opts->cmp : cmp_lex_asc,
+        .cmp_param = opts->cmp ? opts->param : (void *) opts->key_size,
+    };
+    return (hashmap_t *) vector;
+}
+
+
+void hashmap_destroy(hashmap_t *const map)
+{
+    assert(map);
+    vector_destroy(get_hashmap_header(map)->ctrl);
+    vector_destroy((vector_t *) map);
+}
+
+
+size_t hashmap_size(const hashmap_t *const map)
+{
+    assert(map);
+    return get_hashmap_header(map)->size;
+}
+
+
+size_t hashmap_capacity(const hashmap_t *const map)
+{
+    assert(map);
+    return get_hashmap_header(map)->mask + 1;
+}
+
+
+hashmap_status_t hashmap_reserve(hashmap_t **const map, const size_t count)
+{
+    assert(map && *map);
+
+    size_t capacity = hashmap_capacity(*map);
+    if (count <= max_load(capacity))
+    {
+        return HASHMAP_SUCCESS;
+    }
+
+    while (count > max_load(capacity)) capacity <<= 1;
+    return rehash(map, capacity);
+}
+
+
+hashmap_status_t hashmap_insert(hashmap_t **const map, const void *const key, const void *const value)
+{
+    assert(map && *map);
+    assert(key);
+
+    hashmap_header_t *header = get_hashmap_header(*map);
+    assert(value || !header->value_size);
+
+    const size_t hash = header->hash(key, header->hash_param);
+    size_t slot = find_slot(*map, key, hash);
+
+    if (SIZE_MAX == slot)
+    {
+        slot = find_free_slot(header, hash);
+        if (0 == header->growth_left && CTRL_EMPTY == get_ctrl(header)[slot])
+        {
+            /* tombstones are purged in place when the table is sparse enough */
+            const size_t capacity = hashmap_capacity(*map);
+            hashmap_status_t status = rehash(map,
+                    (header->size < max_load(capacity) / 2) ? capacity : capacity * 2);
+            if (HASHMAP_SUCCESS != status)
+            {
+                return status;
+            }
+
+            header = get_hashmap_header(*map);
+            slot = find_free_slot(header, hash);
+        }
+
+        if (CTRL_EMPTY == get_ctrl(header)[slot])
+        {
+            --header->growth_left;
+        }
+
+        set_ctrl(header, slot, (signed char) (hash & 0x7F));
+        memcpy(vector_get((vector_t *) *map, slot), key, header->key_size);
+        ++header->size;
+    }
+
+    /* value may be NULL when values are absent */
+    if (header->value_size)
+    {
+        memcpy((char *) vector_get((vector_t *) *map, slot) + header->value_offset, value, header->value_size);
+    }
+    return HASHMAP_SUCCESS;
+}
+
+
+void *hashmap_get(const hashmap_t *const map, const void *const key)
+{
+    assert(map);
+    assert(key);
+
+    const hashmap_header_t *header = get_hashmap_header(map);
+    const size_t slot = find_slot(map, key, header->hash(key, header->hash_param));
+
+    return (SIZE_MAX == slot) ? NULL
+        : (char *) vector_get((const vector_t *) map, slot) + header->value_offset;
+}
+
+
+bool hashmap_remove(hashmap_t *const map, const void *const key)
+{
+    assert(map);
+    assert(key);
+
+    hashmap_header_t *header = get_hashmap_header(map);
+    const size_t slot = find_slot(map, key, header->hash(key, header->hash_param));
+    if (SIZE_MAX == slot)
+    {
+        return false;
+    }
+
+    /* slot can become empty again if no probe window could have passed it full */
+    const signed char *ctrl = get_ctrl(header);
+    const size_t before = (slot - GROUP_SIZE) & header->mask;
+    const uint32_t empty_after = match_empty(ctrl + slot);
+    const uint32_t empty_before = match_empty(ctrl + before);
+
+    const bool was_never_full = empty_before && empty_after
+        && (unsigned) (__builtin_clz(empty_before << (32 - GROUP_SIZE)) + lowest_bit(empty_after)) < GROUP_SIZE;
+
+    if (was_never_full)
+    {
+        set_ctrl(header, slot, CTRL_EMPTY);
+        ++header->growth_left;
+    }
+    else
+    {
+        set_ctrl(header, slot, CTRL_DELETED);
+    }
+
+    --header->size;
+    return true;
+}
+
+
+void *hashmap_value(const hashmap_t *const map, const void *const entry)
+{
+    assert(map);
+    assert(entry);
+    return (char *) entry + get_hashmap_header(map)->value_offset;
+}
+
+
+int hashmap_foreach(const hashmap_t *const map, const foreach_t func, void *const param)
+{
+    assert(map);
+    assert(func);
+
+    const hashmap_header_t *header = get_hashmap_header(map);
+    const signed char *ctrl = get_ctrl(header);
+
+    for (size_t i = 0; i <= header->mask; ++i)
+    {
+        if (ctrl[i] < 0) continue;
+
+        int status = func(vector_get((const vector_t *) map, i), param);
+        if (status) return status;
+    }
+
+    return 0;
+}
+
+
+/*                        **
+* === Static Functions === *
+*                         */
+
+static hashmap_header_t *get_hashmap_header(const hashmap_t *const map)
+{
+    return (hashmap_header_t *) vector_get_ext_header((const vector_t *) map);
+}
+
+
+static void *get_scratch(const hashmap_t *const map)
+{
+    return (char *) vector_get_ext_header((const vector_t *) map)
+        + calc_aligned_size(sizeof(hashmap_header_t), sizeof(max_align_t));
+}
+
+
+static signed char *get_ctrl(const hashmap_header_t *const header)
+{
+    return (signed char *) vector_data(header->ctrl);
+}
+
+
+static void set_ctrl(const hashmap_header_t *const header, const size_t index, const signed char value)
+{
+    signed char *ctrl = get_ctrl(header);
+    ctrl[index] = value;
+    if (index < GROUP_SIZE - 1)
+    {
+        ctrl[header->mask + 1 + index] = value;
+    }
+}
+
+
+static uint32_t match_byte(const signed char *const group, const signed char value)
+{
+#if defined(__SSE2__)
+    const __m128i bytes = _mm_loadu_si128((const __m128i *) group);
+    return (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(value)));
+#else
+    uint32_t mask = 0;
+    for (unsigned i = 0; i < GROUP_SIZE; ++i)
+    {
+        mask |= (uint32_t) (group[i] == value) << i;
+    }
+    return mask;
+#endif
+}
+
+
+static uint32_t match_free(const signed char *const group)
+{
+#if defined(__SSE2__)
+    /* empty and deleted are the only control bytes with the sign bit set */
+    return (uint32_t) _mm_movemask_epi8(_mm_loadu_si128((const __m128i *) group));
+#else
+    uint32_t mask = 0;
+    for (unsigned i = 0; i < GROUP_SIZE; ++i)
+    {
+        mask |= (uint32_t) (group[i] < 0) << i;
+    }
+    return mask;
+#endif
+}
+
+
+static uint32_t match_empty(const signed char *const group)
+{
+    return match_byte(group, CTRL_EMPTY);
+}
+
+
+static unsigned lowest_bit(const uint32_t mask)
+{
+    return (unsigned) __builtin_ctz(mask);
+}
+
+
+static size_t find_slot(const hashmap_t *const map, const void *const key, const size_t hash)
+{
+    const hashmap_header_t *header = get_hashmap_header(map);
+    const signed char *ctrl = get_ctrl(header);
+    const signed char h2 = (signed char) (hash & 0x7F);
+
+    size_t pos = (hash >> 7) & header->mask;
+    for (size_t step = GROUP_SIZE; ; pos = (pos + step) & header->mask, step += GROUP_SIZE)
+    {
+        for (uint32_t match = match_byte(ctrl + pos, h2); match; match &= match - 1)
+        {
+            const size_t slot = (pos + lowest_bit(match)) & header->mask;
+            if (0 == header->cmp(key, vector_get((const vector_t *) map, slot), header->cmp_param))
+            {
+                return slot;
+            }
+        }
+
+        if (match_empty(ctrl + pos))
+        {
+            return SIZE_MAX;
+        }
+    }
+}
+
+
+static size_t find_free_slot(const hashmap_header_t *const header, const size_t hash)
+{
+    const signed char *ctrl = get_ctrl(header);
+
+    size_t pos = (hash >> 7) & header->mask;
+    for (size_t step = GROUP_SIZE; ; pos = (pos + step) & header->mask, step += GROUP_SIZE)
+    {
+        const uint32_t match = match_free(ctrl + pos);
+        if (match)
+        {
+            return (pos + lowest_bit(match)) & header->mask;
+        }
+    }
+}
+
+
+static hashmap_status_t rehash(hashmap_t **const map, const size_t capacity)
+{
+    vector_t *vector = (vector_t *) *map;
+    hashmap_header_t *header = vector_get_ext_header(vector);
+    const size_t old_capacity = header->mask + 1;
+
+    /* control bytes first, table stays consistent if entries fail to grow */
+    if (capacity > old_capacity)
+    {
+        if (VECTOR_SUCCESS != vector_resize(&header->ctrl, capacity + GROUP_SIZE - 1, VECTOR_ALLOC_ERROR))
+        {
+            return HASHMAP_ALLOC_ERROR;
+        }
+
+        if (VECTOR_SUCCESS != vector_resize(&vector, capacity, VECTOR_ALLOC_ERROR))
+        {
+            return HASHMAP_ALLOC_ERROR;
+        }
+
+        *map = (hashmap_t *) vector;
+        header = vector_get_ext_header(vector);
+    }
+
+    /* full slots are marked deleted (pending), tombstones become empty */
+    signed char *ctrl = get_ctrl(header);
+    for (size_t i = 0; i < old_capacity; ++i)
+    {
+        ctrl[i] = (ctrl[i] >= 0) ? CTRL_DELETED : CTRL_EMPTY;
+    }
+    memset(ctrl + old_capacity, CTRL_EMPTY, capacity - old_capacity);
+
+    header->mask = capacity - 1;
+    memcpy(ctrl + capacity, ctrl, GROUP_SIZE - 1);
+
+    const size_t entry_size = vector_element_size(vector);
+    void *scratch = get_scratch(*map);
+
+    for (size_t i = 0; i < capacity; ++i)
+    {
+        if (CTRL_DELETED != ctrl[i]) continue;
+
+        void *entry = vector_get(vector, i);
+        const size_t hash = header->hash(entry, header->hash_param);
+        const signed char h2 = (signed char) (hash & 0x7F);
+        const size_t start = (hash >> 7) & header->mask;
+        const size_t target = find_free_slot(header, hash);
+
+        /* already in the right probe group */
+        if ((((i - start) & header->mask) / GROUP_SIZE) == (((target - start) & header->mask) / GROUP_SIZE))
+        {
+            set_ctrl(header, i, h2);
+            continue;
+        }
+
+        if (CTRL_EMPTY == ctrl[target])
+        {
+            memcpy(vector_get(vector, target), entry, entry_size);
+            set_ctrl(header, target, h2);
+            set_ctrl(header, i, CTRL_EMPTY);
+        }
+        else
+        {
+            /* target holds another pending entry, swap and process it at i again */
+            memcpy(scratch, vector_get(vector, target), entry_size);
+            memcpy(vector_get(vector, target), entry, entry_size);
+            memcpy(entry, scratch, entry_size);
+            set_ctrl(header, target, h2);
+            --i;
+        }
+    }
+
+    header->growth_left = max_load(capacity) - header->size;
+    return HASHMAP_SUCCESS;
+}
+
+
+static size_t hash_bytes(const void *const key, void *const param)
+{
+    /* FNV-1a followed by a 64-bit finalizer, so that both parts of the hash are well mixed */
+    const unsigned char *bytes = key;
+    uint64_t hash = 0xcbf29ce484222325ULL;
+
+    for (size_t i = 0; i < (size_t) param; ++i)
+    {
+        hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+    }
+
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return (size_t) hash;
+}
+
+
+static size_t max_load(const size_t capacity)
+{
+    return capacity - capacity / 8;
+}
+
+
+static size_t value_alignment(const size_t value_size)
+{
+    size_t alignment = 1;
+    while (alignment < sizeof(max_align_t) && value_size && !(value_size & alignment))
+    {
+        alignment <<= 1;
+    }
+    return alignment;
+}
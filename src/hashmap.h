@@ -0,0 +1,187 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Public interface of the open addressing hash map
+*/
+
+#ifndef _HASHMAP_H_
+#define _HASHMAP_H_
+
+#include "vector.h"
+
+/**
+* @brief   Open addressing hash map derived from @ref vector_t.
+* @details Swiss table layout: entries (key followed by value) live in vector's buffer,
+*          a separate control byte array holds 7 bits of each entry's hash.
+*          Lookups probe groups of 16 control bytes at once (SSE2 where available).
+*          Table grows with @ref vector_resize and rehashes entries in place.
+*          Functions that can grow the map take a double pointer.
+*/
+typedef struct hashmap_t hashmap_t;
+
+/**
+* @brief Hash, maps key to a well distributed value.
+*
+* @param[in] key   Points to a key.
+* @param[in] param Additional parameter from user, if you don't need it, pass @c NULL.
+* @returns         Hash of the key.
+*/
+typedef size_t (*hash_t) (const void *const key, void *const param);
+
+/**
+* @brief   Hash map options.
+* @details Parameters that are passed to a @ref hashmap_create_ function.
+*/
+typedef struct hashmap_opts_t
+{
+    alloc_opts_t alloc_opts;  /**< @brief optional allocator */
+    /* required: */
+    size_t key_size;          /**< @brief Size of the key type. */
+    size_t value_size;        /**< @brief Size of the value type. */
+
+    /* optional: */
+    hash_t hash;              /**< @brief Key hash, bytewise if @c NULL. */
+    compare_t cmp;            /**< @brief Key equality (zero means equal), bytewise @ref cmp_lex_asc if @c NULL. */
+    void *param;              /**< @brief User parameter passed to @ref hashmap_opts_t::hash "hash" and @ref hashmap_opts_t::cmp "cmp". */
+    size_t initial_cap;       /**< @brief Preallocated slots, rounded up to a power of two, at least 16. */
+}
+hashmap_opts_t;
+
+/**
+* @brief   Status of hash map operations that may fail.
+* @details Extends @ref vector_status_t.
+*/
+typedef enum hashmap_status_t
+{
+    HASHMAP_SUCCESS = VECTOR_SUCCESS,         /**< Success operation status code. */
+    HASHMAP_ALLOC_ERROR = VECTOR_ALLOC_ERROR, /**< Allocation error status code. */
+    HASHMAP_STATUS_LAST = VECTOR_STATUS_LAST  /**< Indicates end of the enum values. */
+}
+hashmap_status_t;
+
+/**
+* Represents hash map default create values.
+*/
+#define HASHMAP_DEFAULT_ARGS \
+    .initial_cap = 16
+
+/**
+ * @addtogroup Hashmap_API Hash Map API
+ * @brief      Open addressing hash map methods. @{ */
+
+/**
+* @brief   Hash map constructor.
+* @details Preferable way to invoke hash map constructor.
+*          Provides default values.
+* @warning @ref hashmap_opts_t::key_size "key_size" is mandatory!
+* @see hashmap_create_
+*/
+#define hashmap_create(...) \
+    hashmap_create_( \
+        &(hashmap_opts_t) { \
+            HASHMAP_DEFAULT_ARGS,\
+            __VA_ARGS__ \
+        }\
+    )\
+
+/**
+* @brief   Hash map constructor.
+*
+* @param[in] opts Options according to which map will be created.
+* @returns        Fresh new empty map or @c NULL if allocation failed.
+*/
+hashmap_t *hashmap_create_(const hashmap_opts_t *const opts);
+
+
+/**
+* @brief   Deallocates map.
+*
+* @param[in] map Map pointer that will be deallocated.
+*/
+void hashmap_destroy(hashmap_t *const map);
+
+
+/**
+* @brief   Reports amount of stored entries.
+*
+* @param[in] map Pointer to a map instance.
+* @returns       Amount of entries in the map.
+*/
+size_t hashmap_size(const hashmap_t *const map);
+
+
+/**
+* @brief   Reports amount of slots.
+*
+* @param[in] map Pointer to a map instance.
+* @returns       Amount of slots, 7/8 of them may be occupied before growth.
+*/
+size_t hashmap_capacity(const hashmap_t *const map);
+
+
+/**
+* @brief   Grows map to hold at least @c count entries without rehashing.
+*
+* @param[in] map   Reference to map pointer.
+* @param[in] count Desired amount of entries.
+* @returns         Operation status.
+*/
+hashmap_status_t hashmap_reserve(hashmap_t **const map, const size_t count);
+
+
+/**
+* @brief   Inserts entry or overwrites value of an existing key.
+*
+* @param[in] map   Reference to map pointer.
+* @param[in] key   Key to be copied.
+* @param[in] value Value to be copied.
+* @returns         Operation status.
+*/
+hashmap_status_t hashmap_insert(hashmap_t **const map, const void *const key, const void *const value);
+
+
+/**
+* @brief   Looks up value by key in expected O(1).
+*
+* @param[in] map Pointer to a map instance.
+* @param[in] key Key to be found.
+* @returns       Pointer to the value or @c NULL if key is absent.
+*/
+void *hashmap_get(const hashmap_t *const map, const void *const key);
+
+
+/**
+* @brief   Removes entry by key, slot is marked as deleted.
+*
+* @param[in] map Pointer to a map instance.
+* @param[in] key Key to be removed.
+* @returns       @c true if entry was removed, @c false if key is absent.
+*/
+bool hashmap_remove(hashmap_t *const map, const void *const key);
+
+
+/**
+* @brief   Access value of an entry passed to @ref hashmap_foreach callback.
+*
+* @param[in] map   Pointer to a map instance.
+* @param[in] entry Pointer to an entry, starts with the key.
+* @returns         Pointer to the value of the entry.
+*/
+void *hashmap_value(const hashmap_t *const map, const void *const entry);
+
+
+/**
+* @brief   Perform immutable action on each entry in slot order.
+* @details Callback receives pointer to an entry, which starts with the key,
+*          see @ref hashmap_value.
+*
+* @param[in] map        Pointer to a map instance.
+* @param[in] func       Action to be performed.
+* @param[in,out] param  User defined parameter, passed to func.
+* @returns              Zero on success, or nonzero value - user defined status code.
+*/
+int hashmap_foreach(const hashmap_t *const map, const foreach_t func, void *const param);
+
+/** @} @noop Hashmap_API */
+
+#endif/*_HASHMAP_H_*/
@@ -0,0 +1,339 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Implementation of the binary heap
+*/
+
+#include "heap.h"
+
+#include <assert.h> /** assert */
+#include <string.h> /** memcpy */
+
+/**
+ * @internal
+ * @brief Heap state stored in vector's extension header,
+ *        followed by a scratch element used for hole based sifting.
+ */
+typedef struct heap_header_t
+{
+    size_t size;   /**< @brief Amount of stored elements. */
+    size_t arity;  /**< @brief Children per node. */
+    compare_t cmp; /**< @brief Ordering of elements. */
+    void *param;   /**< @brief User parameter passed to @ref heap_header_t::cmp "cmp". */
+}
+heap_header_t;
+
+/*                             *
+* === Forward Declarations === *
+*                             */
+
+/**
+* @brief   Access heap state.
+*/
+static heap_header_t *get_heap_header(const heap_t *const heap);
+
+/**
+* @brief   Access scratch element, holds value being sifted.
+*/
+static void *get_scratch(const heap_t *const heap);
+
+/**
+* @brief   Grows heap when it is full.
+*/
+static heap_status_t grow_if_full(heap_t **const heap, const size_t required);
+
+/**
+* @brief   Moves hole at @c index up, then places scratch value into it.
+*/
+static void sift_up(heap_t *const heap, size_t index);
+
+/**
+* @brief   Moves hole at @c index down among first @c size elements,
+*          then places scratch value into it.
+*/
+static void sift_down(heap_t *const heap, size_t index, const size_t size);
+
+
+/*                             *
+* === API Implementation   === *
+*                             */
+
+heap_t *heap_create_(const heap_opts_t *const opts)
+{
+    assert(opts && "non-null opts required!");
+    assert(opts->cmp && "non-null 'cmp' required!");
+    assert((opts->arity == 2 || opts->arity == 4) && "'arity' must be 2 or 4!");
+
+    vector_t *vector = vector_create_(&(vector_opts_t) {
+        .alloc_opts = opts->alloc_opts,
+        .ext_header_size = calc_aligned_size(sizeof(heap_header_t), sizeof(max_align_t)) + opts->element_size,
+        .element_size = opts->element_size,
+        .initial_cap = opts->initial_cap,
+    });
+
+    if (!vector)
+    {
+        return NULL;
+    }
+
+    *(heap_header_t *) vector_get_ext_header(vector) = (heap_header_t) {
+        .arity = opts->arity,
+        .cmp = opts->cmp,
+        .param = opts->param,
+    };
+    return (heap_t *) vector;
+}
+
+
+void heap_destroy(heap_t *const heap)
+{
+    assert(heap);
+    vector_destroy((vector_t *) heap);
+}
+
+
+size_t heap_size(const heap_t *const heap)
+{
+    assert(heap);
+    return get_heap_header(heap)->size;
+}
+
+
+size_t heap_capacity(const heap_t *const heap)
+{
+    assert(heap);
+    return vector_capacity((const vector_t *) heap);
+}
+
+
+heap_status_t heap_reserve(heap_t **const heap, const size_t capacity)
+{
+    assert(heap && *heap);
+
+    if (capacity <= heap_capacity(*heap))
+    {
+        return HEAP_SUCCESS;
+    }
+
+    return (heap_status_t) vector_resize((vector_t **) heap, capacity, (vector_status_t) HEAP_ALLOC_ERROR);
+}
+
+
+void *heap_top(const heap_t *const heap)
+{
+    assert(heap);
+    return heap_size(heap) ? vector_get((const vector_t *) heap, 0) : NULL;
+}
+
+
+heap_status_t heap_push(heap_t **const heap, const void *const value)
+{
+    assert(heap && *heap);
+    assert(value);
+
+    heap_status_t status = grow_if_full(heap, 1);
+    if (HEAP_SUCCESS != status)
+    {
+        return status;
+    }
+
+    heap_header_t *header = get_heap_header(*heap);
+    memcpy(get_scratch(*heap), value, vector_element_size((vector_t *) *heap));
+    sift_up(*heap, header->size++);
+    return HEAP_SUCCESS;
+}
+
+
+heap_status_t heap_push_bulk(heap_t **const heap, const void *const values, const size_t count)
+{
+    assert(heap && *heap);
+    assert(values || !count);
+
+    if (0 == count)
+    {
+        return HEAP_SUCCESS;
+    }
+
+    heap_status_t status = grow_if_full(heap, count);
+    if (HEAP_SUCCESS != status)
+    {
+        return status;
+    }
+
+    vector_t *vector = (vector_t *) *heap;
+    heap_header_t *header = get_heap_header(*heap);
+    const size_t element_size = vector_element_size(vector);
+    const size_t size = header->size;
+    const size_t total = size + count;
+
+    /* sifting each new element up costs O(count * log(total)),
+       rebuilding bottom-up costs O(total) */
+    size_t depth = 0;
+    for (size_t n = total; n > 1; n /= header->arity) ++depth;
+
+    if (count * depth < total)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            memcpy(get_scratch(*heap), (const char *) values + i * element_size, element_size);
+            sift_up(*heap, header->size++);
+        }
+        return HEAP_SUCCESS;
+    }
+
+    memcpy(vector_data(vector) + size * element_size, values, count * element_size);
+    header->size = total;
+
+    for (size_t i = (total - 2) / header->arity + 1; i-- > 0;)
+    {
+        memcpy(get_scratch(*heap), vector_get(vector, i), element_size);
+        sift_down(*heap, i, total);
+    }
+    return HEAP_SUCCESS;
+}
+
+
+heap_status_t heap_pop(heap_t *const heap, void *const out)
+{
+    assert(heap);
+
+    vector_t *vector = (vector_t *) heap;
+    heap_header_t *header = get_heap_header(heap);
+    if (0 == header->size)
+    {
+        return HEAP_EMPTY;
+    }
+
+    if (out)
+    {
+        vector_copy(vector, out, 0, 1);
+    }
+
+    if (--header->size)
+    {
+        memcpy(get_scratch(heap), vector_get(vector, header->size), vector_element_size(vector));
+        sift_down(heap, 0, header->size);
+    }
+    return HEAP_SUCCESS;
+}
+
+
+heap_status_t heap_replace_top(heap_t *const heap, const void *const value, void *const out)
+{
+    assert(heap);
+    assert(value);
+
+    vector_t *vector = (vector_t *) heap;
+    heap_header_t *header = get_heap_header(heap);
+    if (0 == header->size)
+    {
+        return HEAP_EMPTY;
+    }
+
+    const size_t element_size = vector_element_size(vector);
+    memcpy(get_scratch(heap), value, element_size);
+    if (out)
+    {
+        vector_copy(vector, out, 0, 1);
+    }
+
+    sift_down(heap, 0, header->size);
+    return HEAP_SUCCESS;
+}
+
+
+/*                        **
+* === Static Functions === *
+*                         */
+
+static heap_header_t *get_heap_header(const heap_t *const heap)
+{
+    return (heap_header_t *) vector_get_ext_header((const vector_t *) heap);
+}
+
+
+static void *get_scratch(const heap_t *const heap)
+{
+    return (char *) vector_get_ext_header((const vector_t *) heap)
+        + calc_aligned_size(sizeof(heap_header_t), sizeof(max_align_t));
+}
+
+
+static heap_status_t grow_if_full(heap_t **const heap, const size_t required)
+{
+    const size_t size = heap_size(*heap);
+    const size_t capacity = heap_capacity(*heap);
+
+    if (size + required <= capacity)
+    {
+        return HEAP_SUCCESS;
+    }
+
+    /* at least double, keeps amortized O(1) push */
+    const size_t desired = size + required;
+    return heap_reserve(heap, (desired > capacity * 2) ? desired : capacity * 2);
+}
+
+
+static void sift_up(heap_t *const heap, size_t index)
+{
+    vector_t *vector = (vector_t *) heap;
+    const heap_header_t *header = get_heap_header(heap);
+    const size_t element_size = vector_element_size(vector);
+    const void *value = get_scratch(heap);
+
+    while (index > 0)
+    {
+        const size_t parent = (index - 1) / header->arity;
+        const void *parent_ptr = vector_get(vector, parent);
+        if (header->cmp(value, parent_ptr, header->param) >= 0)
+        {
+            break;
+        }
+
+        memcpy(vector_get(vector, index), parent_ptr, element_size);
+        index = parent;
+    }
+
+    memcpy(vector_get(vector, index), value, element_size);
+}
+
+
+static void sift_down(heap_t *const heap, size_t index, const size_t size)
+{
+    vector_t *vector = (vector_t *) heap;
+    const heap_header_t *header = get_heap_header(heap);
+    const size_t element_size = vector_element_size(vector);
+    const void *value = get_scratch(heap);
+
+    for (;;)
+    {
+        const size_t first = index * header->arity + 1;
+        if (first >= size)
+        {
+            break;
+        }
+
+        /* pick the lowest child */
+        const size_t last = (first + header->arity < size) ? first + header->arity : size;
+        size_t best = first;
+        for (size_t child = first + 1; child < last; ++child)
+        {
+            if (header->cmp(vector_get(vector, child), vector_get(vector, best), header->param) < 0)
+            {
+                best = child;
+            }
+        }
+
+        const void *best_ptr = vector_get(vector, best);
+        if (header->cmp(best_ptr, value, header->param) >= 0)
+        {
+            break;
+        }
+
+        memcpy(vector_get(vector, index), best_ptr, element_size);
+        index = best;
+    }
+
+    memcpy(vector_get(vector, index), value, element_size);
+}
@@ -0,0 +1,181 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Public interface of the binary heap
+*/
+
+#ifndef _HEAP_H_
+#define _HEAP_H_
+
+#include "vector.h"
+
+/**
+* @brief   Priority queue (d-ary heap) derived from @ref vector_t.
+* @details Elements are stored in vector's buffer in implicit heap layout,
+*          size and ordering are kept in the extension header.
+*          Element that compares lowest by @ref heap_opts_t::cmp "cmp" is on top,
+*          use descending comparator for a max heap.
+*          Sifting moves a hole instead of swapping, one copy per level.
+*          Functions that can grow the heap take a double pointer.
+*/
+typedef struct heap_t heap_t;
+
+/**
+* @brief   Heap options.
+* @details Parameters that are passed to a @ref heap_create_ function.
+*/
+typedef struct heap_opts_t
+{
+    alloc_opts_t alloc_opts;  /**< @brief optional allocator */
+    /* required: */
+    size_t element_size;      /**< @brief Size of the stored element type. */
+    compare_t cmp;            /**< @brief Ordering of elements. */
+
+    /* optional: */
+    void *param;              /**< @brief User parameter passed to @ref heap_opts_t::cmp "cmp". */
+    size_t initial_cap;       /**< @brief Preallocated elements. */
+    size_t arity;             /**< @brief Children per node, 2 or 4 (better cache behavior on large heaps). */
+}
+heap_opts_t;
+
+/**
+* @brief   Status of heap operations that may fail.
+* @details Extends @ref vector_status_t.
+*/
+typedef enum heap_status_t
+{
+    HEAP_SUCCESS = VECTOR_SUCCESS,         /**< Success operation status code. */
+    HEAP_ALLOC_ERROR = VECTOR_ALLOC_ERROR, /**< Allocation error status code. */
+    HEAP_EMPTY = VECTOR_STATUS_LAST,       /**< Nothing to pop from the heap. */
+    HEAP_STATUS_LAST                       /**< Indicates end of the enum values. */
+}
+heap_status_t;
+
+/**
+* Represents heap default create values.
+*/
+#define HEAP_DEFAULT_ARGS \
+    .initial_cap = 16, \
+    .arity = 2
+
+/**
+ * @addtogroup Heap_API Heap API
+ * @brief      Priority queue methods. @{ */
+
+/**
+* @brief   Heap constructor.
+* @details Preferable way to invoke heap constructor.
+*          Provides default values.
+* @warning @ref heap_opts_t::element_size "element_size" and
+*          @ref heap_opts_t::cmp "cmp" are mandatory!
+* @see heap_create_
+*/
+#define heap_create(...) \
+    heap_create_( \
+        &(heap_opts_t) { \
+            HEAP_DEFAULT_ARGS,\
+            __VA_ARGS__ \
+        }\
+    )\
+
+/**
+* @brief   Heap constructor.
+*
+* @param[in] opts Options according to which heap will be created.
+* @returns        Fresh new empty heap or @c NULL if allocation failed.
+*/
+heap_t *heap_create_(const heap_opts_t *const opts);
+
+
+/**
+* @brief   Deallocates heap.
+*
+* @param[in] heap Heap pointer that will be deallocated.
+*/
+void heap_destroy(heap_t *const heap);
+
+
+/**
+* @brief   Reports amount of stored elements.
+*
+* @param[in] heap Pointer to a heap instance.
+* @returns        Amount of elements in the heap.
+*/
+size_t heap_size(const heap_t *const heap);
+
+
+/**
+* @brief   Reports amount of elements heap can store without growing.
+*
+* @param[in] heap Pointer to a heap instance.
+* @returns        Capacity of the heap.
+*/
+size_t heap_capacity(const heap_t *const heap);
+
+
+/**
+* @brief   Grows heap to hold at least @c capacity elements.
+*
+* @param[in] heap     Reference to heap pointer.
+* @param[in] capacity Desired minimal capacity.
+* @returns            Operation status.
+*/
+heap_status_t heap_reserve(heap_t **const heap, const size_t capacity);
+
+
+/**
+* @brief   Access top element.
+*
+* @param[in] heap Pointer to a heap instance.
+* @returns        Pointer to the lowest element or @c NULL if heap is empty.
+*/
+void *heap_top(const heap_t *const heap);
+
+
+/**
+* @brief   Inserts element, growing the heap when full.
+*
+* @param[in] heap  Reference to heap pointer.
+* @param[in] value Value to be copied.
+* @returns         Operation status.
+*/
+heap_status_t heap_push(heap_t **const heap, const void *const value);
+
+
+/**
+* @brief   Inserts contiguous span of elements.
+* @details Grows the heap once. When span is large compared to the heap,
+*          heap property is restored bottom-up in O(n), otherwise elements are sifted up one by one.
+*
+* @param[in] heap   Reference to heap pointer.
+* @param[in] values Contiguous array of @c count elements.
+* @param[in] count  Amount of elements to be inserted.
+* @returns          Operation status.
+*/
+heap_status_t heap_push_bulk(heap_t **const heap, const void *const values, const size_t count);
+
+
+/**
+* @brief   Removes top element.
+*
+* @param[in]  heap Pointer to a heap instance.
+* @param[out] out  Location for removed value, may be @c NULL.
+* @returns         @ref HEAP_EMPTY if nothing to remove, otherwise @ref HEAP_SUCCESS.
+*/
+heap_status_t heap_pop(heap_t *const heap, void *const out);
+
+
+/**
+* @brief   Replaces top element with @c value in a single sift.
+* @details Cheaper than pop followed by push, handy for top-k selection.
+*
+* @param[in]  heap  Pointer to a heap instance.
+* @param[in]  value Value to be copied.
+* @param[out] out   Location for replaced value, may be @c NULL.
+* @returns          @ref HEAP_EMPTY if heap is empty (nothing inserted), otherwise @ref HEAP_SUCCESS.
+*/
+heap_status_t heap_replace_top(heap_t *const heap, const void *const value, void *const out);
+
+/** @} @noop Heap_API */
+
+#endif/*_HEAP_H_*/
@@ -0,0 +1,390 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Implementation of the multi-producer/multi-consumer queue
+*/
+
+#include "mpmc.h"
+
+#include <assert.h>    /** assert */
+#include <pthread.h>   /** pthread_mutex_t, pthread_cond_t */
+#include <sched.h>     /** sched_yield */
+#include <stdatomic.h> /** atomic_size_t, atomic_compare_exchange_weak_explicit */
+#include <stdint.h>    /** intptr_t */
+#include <string.h>    /** memcpy */
+
+/**
+ * @internal
+ * @brief Assumed cache line size, used to separate producer and consumer state.
+ */
+#define CACHE_LINE 64
+
+/**
+ * @internal
+ * @brief Amount of busy attempts before blocking operations start yielding.
+ */
+#define SPIN_LIMIT 64
+
+/**
+ * @internal
+ * @brief Amount of attempts before blocking operations park the thread.
+ */
+#define YIELD_LIMIT (SPIN_LIMIT + 16)
+
+/**
+ * @internal
+ * @brief Queue state stored in vector's extension header.
+ */
+typedef struct mpmc_header_t
+{
+    atomic_size_t enqueue_pos; /**< @brief Next position to be claimed by a producer. */
+    char enqueue_pad[CACHE_LINE - sizeof(atomic_size_t)];
+
+    atomic_size_t dequeue_pos; /**< @brief Next position to be claimed by a consumer. */
+    char dequeue_pad[CACHE_LINE - sizeof(atomic_size_t)];
+
+    atomic_size_t waiters;     /**< @brief Threads parked or about to park, checked after every operation. */
+    pthread_mutex_t lock;      /**< @brief Guards parking, never taken while nobody waits. */
+    pthread_cond_t wakeup;     /**< @brief Signalled when a parked thread may make progress. */
+}
+mpmc_header_t;
+
+/**
+ * @internal
+ * @brief Slot layout, element data follows the sequence number.
+ */
+typedef struct mpmc_slot_t
+{
+    atomic_size_t sequence; /**< @brief Position this slot is ready for. */
+    char data[];
+}
+mpmc_slot_t;
+
+/*                             *
+* === Forward Declarations === *
+*                             */
+
+/**
+* @brief   Access queue state.
+*/
+static mpmc_header_t *get_mpmc_header(const mpmc_t *const queue);
+
+/**
+* @brief   Access slot corresponding to a position.
+*/
+static mpmc_slot_t *get_slot(const mpmc_t *const queue, const size_t pos);
+
+/**
+* @brief   Claims a slot and writes value, does not wake parked threads.
+*/
+static bool try_push(mpmc_t *const queue, const void *const value);
+
+/**
+* @brief   Claims a slot and reads value, does not wake parked threads.
+*/
+static bool try_pop(mpmc_t *const queue, void *const out);
+
+/**
+* @brief   Waits a bit after unsuccessful attempt.
+* @returns @c false once attempts are exhausted and thread should park.
+*/
+static bool backoff(size_t *const attempts);
+
+/**
+* @brief   Parks thread until queue state changes, retrying once under the lock.
+* @returns @c true if retried operation succeeded.
+*/
+static bool park(mpmc_t *const queue, const void *const value, void *const out);
+
+/**
+* @brief   Wakes parked threads after successful operation, if there are any.
+*/
+static void notify(mpmc_t *const queue);
+
+
+/*                             *
+* === API Implementation   === *
+*                             */
+
+mpmc_t *mpmc_create_(const mpmc_opts_t *const opts)
+{
+    assert(opts && "non-null opts required!");
+    assert(opts->element_size && "'element_size' gt then zero required!");
+
+    size_t capacity = 2;
+    while (capacity < opts->capacity) capacity <<= 1;
+
+    /* pad extension header so slots start on a cache line boundary of the region */
+    const size_t ext_header_size = calc_aligned_size(opts->alloc_opts.size + sizeof(mpmc_header_t), CACHE_LINE)
+        - opts->alloc_opts.size;
+
+    vector_t *vector = vector_create_(&(vector_opts_t) {
+        .alloc_opts = opts->alloc_opts,
+        .ext_header_size = ext_header_size,
+        .element_size = calc_aligned_size(sizeof(mpmc_slot_t) + opts->element_size, sizeof(atomic_size_t)),
+        .initial_cap = capacity,
+    });
+
+    if (!vector)
+    {
+        return NULL;
+    }
+
+    mpmc_header_t *header = vector_get_ext_header(vector);
+    atomic_init(&header->enqueue_pos, 0);
+    atomic_init(&header->dequeue_pos, 0);
+    atomic_init(&header->waiters, 0);
+
+    if (0 != pthread_mutex_init(&header->lock, NULL))
+    {
+        vector_destroy(vector);
+        return NULL;
+    }
+
+    if (0 != pthread_cond_init(&header->wakeup, NULL))
+    {
+        pthread_mutex_destroy(&header->lock);
+        vector_destroy(vector);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < capacity; ++i)
+    {
+        atomic_init(&((mpmc_slot_t *) vector_get(vector, i))->sequence, i);
+    }
+
+    return (mpmc_t *) vector;
+}
+
+
+void mpmc_destroy(mpmc_t *const queue)
+{
+    assert(queue);
+
+    mpmc_header_t *header = get_mpmc_header(queue);
+    pthread_cond_destroy(&header->wakeup);
+    pthread_mutex_destroy(&header->lock);
+    vector_destroy((vector_t *) queue);
+}
+
+
+size_t mpmc_capacity(const mpmc_t *const queue)
+{
+    assert(queue);
+    return vector_capacity((const vector_t *) queue);
+}
+
+
+bool mpmc_try_push(mpmc_t *const queue, const void *const value)
+{
+    assert(queue);
+    assert(value);
+
+    if (!try_push(queue, value))
+    {
+        return false;
+    }
+
+    notify(queue);
+    return true;
+}
+
+
+bool mpmc_try_pop(mpmc_t *const queue, void *const out)
+{
+    assert(queue);
+    assert(out);
+
+    if (!try_pop(queue, out))
+    {
+        return false;
+    }
+
+    notify(queue);
+    return true;
+}
+
+
+void mpmc_push(mpmc_t *const queue, const void *const value)
+{
+    assert(queue);
+    assert(value);
+
+    size_t attempts = 0;
+    while (!try_push(queue, value))
+    {
+        if (!backoff(&attempts) && park(queue, value, NULL))
+        {
+            break;
+        }
+    }
+
+    notify(queue);
+}
+
+
+void mpmc_pop(mpmc_t *const queue, void *const out)
+{
+    assert(queue);
+    assert(out);
+
+    size_t attempts = 0;
+    while (!try_pop(queue, out))
+    {
+        if (!backoff(&attempts) && park(queue, NULL, out))
+        {
+            break;
+        }
+    }
+
+    notify(queue);
+}
+
+
+/*                        **
+* === Static Functions === *
+*                         */
+
+static mpmc_header_t *get_mpmc_header(const mpmc_t *const queue)
+{
+    return (mpmc_header_t *) vector_get_ext_header((const vector_t *) queue);
+}
+
+
+static mpmc_slot_t *get_slot(const mpmc_t *const queue, const size_t pos)
+{
+    const vector_t *vector = (const vector_t *) queue;
+    return (mpmc_slot_t *) vector_get(vector, pos & (vector_capacity(vector) - 1));
+}
+
+
+static bool try_push(mpmc_t *const queue, const void *const value)
+{
+    mpmc_header_t *header = get_mpmc_header(queue);
+    const size_t element_size = vector_element_size((const vector_t *) queue) - sizeof(mpmc_slot_t);
+    size_t pos = atomic_load_explicit(&header->enqueue_pos, memory_order_relaxed);
+    mpmc_slot_t *slot;
+
+    for (;;)
+    {
+        slot = get_slot(queue, pos);
+        const size_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        const intptr_t diff = (intptr_t) sequence - (intptr_t) pos;
+
+        if (0 == diff)
+        {
+            if (atomic_compare_exchange_weak_explicit(&header->enqueue_pos, &pos, pos + 1,
+                        memory_order_relaxed, memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            return false; /* full */
+        }
+        else
+        {
+            pos = atomic_load_explicit(&header->enqueue_pos, memory_order_relaxed);
+        }
+    }
+
+    memcpy(slot->data, value, element_size);
+    atomic_store_explicit(&slot->sequence, pos + 1, memory_order_release);
+    return true;
+}
+
+
+static bool try_pop(mpmc_t *const queue, void *const out)
+{
+    mpmc_header_t *header = get_mpmc_header(queue);
+    const vector_t *vector = (const vector_t *) queue;
+    const size_t element_size = vector_element_size(vector) - sizeof(mpmc_slot_t);
+    size_t pos = atomic_load_explicit(&header->dequeue_pos, memory_order_relaxed);
+    mpmc_slot_t *slot;
+
+    for (;;)
+    {
+        slot = get_slot(queue, pos);
+        const size_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        const intptr_t diff = (intptr_t) sequence - (intptr_t) (pos + 1);
+
+        if (0 == diff)
+        {
+            if (atomic_compare_exchange_weak_explicit(&header->dequeue_pos, &pos, pos + 1,
+                        memory_order_relaxed, memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            return false; /* empty */
+        }
+        else
+        {
+            pos = atomic_load_explicit(&header->dequeue_pos, memory_order_relaxed);
+        }
+    }
+
+    memcpy(out, slot->data, element_size);
+    atomic_store_explicit(&slot->sequence, pos + vector_capacity(vector), memory_order_release);
+    return true;
+}
+
+
+static bool backoff(size_t *const attempts)
+{
+    if (++*attempts < SPIN_LIMIT)
+    {
+        return true;
+    }
+
+    if (*attempts < YIELD_LIMIT)
+    {
+        sched_yield();
+        return true;
+    }
+
+    return false;
+}
+
+
+static bool park(mpmc_t *const queue, const void *const value, void *const out)
+{
+    mpmc_header_t *header = get_mpmc_header(queue);
+
+    pthread_mutex_lock(&header->lock);
+    atomic_fetch_add_explicit(&header->waiters, 1, memory_order_relaxed);
+
+    /* pairs with the fence in notify: either notifier sees the waiter,
+     * or the retry below sees the notifier's operation */
+    atomic_thread_fence(memory_order_seq_cst);
+
+    const bool done = value ? try_push(queue, value) : try_pop(queue, out);
+    if (!done)
+    {
+        pthread_cond_wait(&header->wakeup, &header->lock);
+    }
+
+    atomic_fetch_sub_explicit(&header->waiters, 1, memory_order_relaxed);
+    pthread_mutex_unlock(&header->lock);
+    return done;
+}
+
+
+static void notify(mpmc_t *const queue)
+{
+    mpmc_header_t *header = get_mpmc_header(queue);
+
+    atomic_thread_fence(memory_order_seq_cst);
+    if (0 == atomic_load_explicit(&header->waiters, memory_order_relaxed))
+    {
+        return;
+    }
+
+    /* waiter holds the lock until it is inside pthread_cond_wait */
+    pthread_mutex_lock(&header->lock);
+    pthread_cond_broadcast(&header->wakeup);
+    pthread_mutex_unlock(&header->lock);
+}
@@ -0,0 +1,138 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Public interface of the multi-producer/multi-consumer queue
+*/
+
+#ifndef _MPMC_H_
+#define _MPMC_H_
+
+#include "vector.h"
+
+/**
+* @brief   Lock-free bounded multi-producer/multi-consumer queue.
+* @details Dmitry Vyukov's bounded queue: every slot of the underlying
+*          @ref vector_t carries a sequence number telling producers and consumers
+*          whether it is ready to be written or read, so each operation
+*          costs a single CAS on the shared position counter.
+*          Enqueue and dequeue positions live in the extension header
+*          on separate cache lines.
+*          Blocking operations park on a condition variable when waiting gets long,
+*          completed operations touch it only while somebody is parked.
+*/
+typedef struct mpmc_t mpmc_t;
+
+/**
+* @brief   Queue options.
+* @details Parameters that are passed to a @ref mpmc_create_ function.
+*/
+typedef struct mpmc_opts_t
+{
+    alloc_opts_t alloc_opts;  /**< @brief optional allocator */
+    /* required: */
+    size_t element_size;      /**< @brief Size of the record type. */
+
+    /* optional: */
+    size_t capacity;          /**< @brief Fixed capacity, rounded up to a power of two (at least 2). */
+}
+mpmc_opts_t;
+
+/**
+* Represents queue default create values.
+*/
+#define MPMC_DEFAULT_ARGS \
+    .capacity = 1024
+
+/**
+ * @addtogroup MPMC_API MPMC Queue API
+ * @brief      Multi-producer/multi-consumer queue methods. @{ */
+
+/**
+* @brief   Queue constructor.
+* @details Preferable way to invoke queue constructor.
+*          Provides default values.
+* @warning @ref mpmc_opts_t::element_size "element_size" is mandatory!
+* @see mpmc_create_
+*/
+#define mpmc_create(...) \
+    mpmc_create_( \
+        &(mpmc_opts_t) { \
+            MPMC_DEFAULT_ARGS,\
+            __VA_ARGS__ \
+        }\
+    )\
+
+/**
+* @brief   Queue constructor.
+* @warning Not thread safe, publish queue to other threads after creation.
+*
+* @param[in] opts Options according to which queue will be created.
+* @returns        Fresh new empty queue or @c NULL if allocation failed.
+*/
+mpmc_t *mpmc_create_(const mpmc_opts_t *const opts);
+
+
+/**
+* @brief   Deallocates queue.
+* @warning All producers and consumers must be done with the queue.
+*
+* @param[in] queue Queue pointer that will be deallocated.
+*/
+void mpmc_destroy(mpmc_t *const queue);
+
+
+/**
+* @brief   Reports fixed capacity of the queue.
+*
+* @param[in] queue Pointer to a queue instance.
+* @returns         Capacity, always a power of two.
+*/
+size_t mpmc_capacity(const mpmc_t *const queue);
+
+
+/**
+* @brief   Pushes element if there is a free slot.
+*
+* @param[in] queue Pointer to a queue instance.
+* @param[in] value Value to be copied.
+* @returns         @c false if queue is full.
+*/
+bool mpmc_try_push(mpmc_t *const queue, const void *const value);
+
+
+/**
+* @brief   Pops element if there is one.
+*
+* @param[in]  queue Pointer to a queue instance.
+* @param[out] out   Location for popped value.
+* @returns          @c false if queue is empty.
+*/
+bool mpmc_try_pop(mpmc_t *const queue, void *const out);
+
+
+/**
+* @brief   Pushes element, waiting for a free slot.
+* @details Spins for a short while, yields processor for a few more attempts,
+*          then parks the thread on a condition variable until another thread
+*          completes an operation on the queue.
+*
+* @param[in] queue Pointer to a queue instance.
+* @param[in] value Value to be copied.
+*/
+void mpmc_push(mpmc_t *const queue, const void *const value);
+
+
+/**
+* @brief   Pops element, waiting for one to arrive.
+* @details Spins for a short while, yields processor for a few more attempts,
+*          then parks the thread on a condition variable until another thread
+*          completes an operation on the queue.
+*
+* @param[in]  queue Pointer to a queue instance.
+* @param[out] out   Location for popped value.
+*/
+void mpmc_pop(mpmc_t *const queue, void *const out);
+
+/** @} @noop MPMC_API */
+
+#endif/*_MPMC_H_*/
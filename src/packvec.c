@@ -0,0 +1,420 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Implementation of the compressed integer vector
+*/
+
+#include "packvec.h"
+
+#include <assert.h> /** assert */
+#include <string.h> /** memcpy */
+
+#if defined(__AVX2__)
+#include <immintrin.h> /** _mm256_i64gather_epi64, _mm256_srlv_epi64 */
+#endif
+
+/**
+ * @internal
+ * @brief Bits per packed word.
+ */
+#define WORD_BITS 64
+
+/**
+ * @internal
+ * @brief Encoded block descriptor.
+ */
+typedef struct block_t
+{
+    uint64_t base;  /**< @brief Block minimum (FOR) or first value (delta). */
+    size_t offset;  /**< @brief First packed word of the block. */
+    size_t width;   /**< @brief Bits per packed value. */
+}
+block_t;
+
+/**
+ * @internal
+ * @brief Compressed vector state stored in vector's extension header,
+ *        followed by the block index.
+ */
+typedef struct packvec_header_t
+{
+    size_t length;               /**< @brief Amount of values. */
+    size_t blocks;               /**< @brief Amount of blocks. */
+    packvec_encoding_t encoding; /**< @brief Block encoding. */
+}
+packvec_header_t;
+
+/*                             *
+* === Forward Declarations === *
+*                             */
+
+/**
+* @brief   Access compressed vector state.
+*/
+static packvec_header_t *get_packvec_header(const packvec_t *const packvec);
+
+/**
+* @brief   Access block descriptor.
+*/
+static block_t *get_block(const packvec_t *const packvec, const size_t block);
+
+/**
+* @brief   Reads source element as unsigned integer.
+*/
+static uint64_t load_value(const vector_t *const source, const size_t index);
+
+/**
+* @brief   Prepares block values for packing.
+* @returns Values to be packed through @c out and block base.
+*/
+static uint64_t encode_block(const vector_t *const source,
+        const size_t begin,
+        const size_t count,
+        const packvec_encoding_t encoding,
+        uint64_t *const out);
+
+/**
+* @brief   Minimal bit width holding @c value.
+*/
+static size_t bit_width(const uint64_t value);
+
+/**
+* @brief   Packs @ref PACKVEC_BLOCK values of @c width bits into zeroed words.
+*/
+static void pack(uint64_t *const words, const uint64_t *const values, const size_t width);
+
+/**
+* @brief   Extracts single packed value.
+*/
+static uint64_t unpack_one(const uint64_t *const words, const size_t index, const size_t width);
+
+/**
+* @brief   Unpacks @ref PACKVEC_BLOCK values of @c width bits.
+*/
+static void unpack(const uint64_t *const words, const size_t width, uint64_t *const out);
+
+
+/*                             *
+* === API Implementation   === *
+*                             */
+
+packvec_t *packvec_create_(const packvec_opts_t *const opts)
+{
+    assert(opts && "non-null opts required!");
+    assert(opts->source && "non-null 'source' required!");
+    assert((opts->length <= vector_capacity(opts->source)) && "Length out of source bounds!");
+
+    const size_t element_size = vector_element_size(opts->source);
+    assert((element_size == 1 || element_size == 2 || element_size == 4 || element_size == 8)
+            && "Unsupported source element size!");
+    (void) element_size;
+
+    const size_t blocks = (opts->length + PACKVEC_BLOCK - 1) / PACKVEC_BLOCK;
+    uint64_t values[PACKVEC_BLOCK];
+
+    /* first pass sizes packed words, so that everything is allocated at once */
+    size_t words = 0;
+    for (size_t b = 0; b < blocks; ++b)
+    {
+        const size_t begin = b * PACKVEC_BLOCK;
+        const size_t count = (opts->length - begin < PACKVEC_BLOCK) ? opts->length - begin : PACKVEC_BLOCK;
+        encode_block(opts->source, begin, count, opts->encoding, values);
+
+        uint64_t max = 0;
+        for (size_t i = 0; i < PACKVEC_BLOCK; ++i) max |= values[i];
+        words += bit_width(max) * PACKVEC_BLOCK / WORD_BITS;
+    }
+
+    /* pad extension header so packed words start on a word boundary of the region */
+    const size_t ext_header_size = calc_aligned_size(opts->alloc_opts.size
+            + calc_aligned_size(sizeof(packvec_header_t), sizeof(block_t)) + blocks * sizeof(block_t), sizeof(uint64_t))
+        - opts->alloc_opts.size;
+
+    /* extra word lets unpacking read the word after any value */
+    vector_t *vector = vector_create_(&(vector_opts_t) {
+        .alloc_opts = opts->alloc_opts,
+        .ext_header_size = ext_header_size,
+        .element_size = sizeof(uint64_t),
+        .initial_cap = words + 1,
+        .zero_init = true,
+    });
+
+    if (!vector)
+    {
+        return NULL;
+    }
+
+    packvec_t *packvec = (packvec_t *) vector;
+    *get_packvec_header(packvec) = (packvec_header_t) {
+        .length = opts->length,
+        .blocks = blocks,
+        .encoding = opts->encoding,
+    };
+
+    uint64_t *data = (uint64_t *) vector_data(vector);
+    size_t offset = 0;
+
+    for (size_t b = 0; b < blocks; ++b)
+    {
+        const size_t begin = b * PACKVEC_BLOCK;
+        const size_t count = (opts->length - begin < PACKVEC_BLOCK) ? opts->length - begin : PACKVEC_BLOCK;
+        const uint64_t base = encode_block(opts->source, begin, count, opts->encoding, values);
+
+        uint64_t max = 0;
+        for (size_t i = 0; i < PACKVEC_BLOCK; ++i) max |= values[i];
+        const size_t width = bit_width(max);
+
+        *get_block(packvec, b) = (block_t) {.base = base, .offset = offset, .width = width};
+        pack(data + offset, values, width);
+        offset += width * PACKVEC_BLOCK / WORD_BITS;
+    }
+
+    return packvec;
+}
+
+
+void packvec_destroy(packvec_t *const packvec)
+{
+    assert(packvec);
+    vector_destroy((vector_t *) packvec);
+}
+
+
+size_t packvec_length(const packvec_t *const packvec)
+{
+    assert(packvec);
+    return get_packvec_header(packvec)->length;
+}
+
+
+size_t packvec_blocks(const packvec_t *const packvec)
+{
+    assert(packvec);
+    return get_packvec_header(packvec)->blocks;
+}
+
+
+size_t packvec_memory(const packvec_t *const packvec)
+{
+    assert(packvec);
+    const vector_t *vector = (const vector_t *) packvec;
+    return vector_capacity(vector) * sizeof(uint64_t) + packvec_blocks(packvec) * sizeof(block_t);
+}
+
+
+uint64_t packvec_get(const packvec_t *const packvec, const size_t index)
+{
+    assert(packvec);
+    assert((index < packvec_length(packvec)) && "Index out of bounds!");
+
+    const block_t *block = get_block(packvec, index / PACKVEC_BLOCK);
+    const uint64_t *words = (const uint64_t *) vector_data((const vector_t *) packvec) + block->offset;
+    const size_t position = index % PACKVEC_BLOCK;
+
+    if (PACKVEC_FOR == get_packvec_header(packvec)->encoding)
+    {
+        return block->base + unpack_one(words, position, block->width);
+    }
+
+    uint64_t value = block->base;
+    for (size_t i = 1; i <= position; ++i)
+    {
+        value += unpack_one(words, i, block->width);
+    }
+    return value;
+}
+
+
+size_t packvec_decode(const packvec_t *const packvec, const size_t block, uint64_t *const out)
+{
+    assert(packvec);
+    assert(out);
+
+    const packvec_header_t *header = get_packvec_header(packvec);
+    assert((block < header->blocks) && "Block out of bounds!");
+
+    const block_t *desc = get_block(packvec, block);
+    unpack((const uint64_t *) vector_data((const vector_t *) packvec) + desc->offset, desc->width, out);
+
+    if (PACKVEC_FOR == header->encoding)
+    {
+        for (size_t i = 0; i < PACKVEC_BLOCK; ++i) out[i] += desc->base;
+    }
+    else
+    {
+        uint64_t acc = desc->base;
+        for (size_t i = 0; i < PACKVEC_BLOCK; ++i) out[i] = (acc += out[i]);
+    }
+
+    const size_t begin = block * PACKVEC_BLOCK;
+    return (header->length - begin < PACKVEC_BLOCK) ? header->length - begin : PACKVEC_BLOCK;
+}
+
+
+int packvec_foreach(const packvec_t *const packvec, const foreach_t func, void *const param)
+{
+    assert(packvec);
+    assert(func);
+
+    uint64_t values[PACKVEC_BLOCK];
+    for (size_t b = 0; b < packvec_blocks(packvec); ++b)
+    {
+        const size_t count = packvec_decode(packvec, b, values);
+        for (size_t i = 0; i < count; ++i)
+        {
+            int status = func(&values[i], param);
+            if (status) return status;
+        }
+    }
+
+    return 0;
+}
+
+
+/*                        **
+* === Static Functions === *
+*                         */
+
+static packvec_header_t *get_packvec_header(const packvec_t *const packvec)
+{
+    return (packvec_header_t *) vector_get_ext_header((const vector_t *) packvec);
+}
+
+
+static block_t *get_block(const packvec_t *const packvec, const size_t block)
+{
+    return (block_t *) ((char *) vector_get_ext_header((const vector_t *) packvec)
+        + calc_aligned_size(sizeof(packvec_header_t), sizeof(block_t))) + block;
+}
+
+
+static uint64_t load_value(const vector_t *const source, const size_t index)
+{
+    const void *element = vector_get(source, index);
+    switch (vector_element_size(source))
+    {
+        case 1: return *(const uint8_t *) element;
+        case 2: { uint16_t v; memcpy(&v, element, sizeof(v)); return v; }
+        case 4: { uint32_t v; memcpy(&v, element, sizeof(v)); return v; }
+        default: { uint64_t v; memcpy(&v, element, sizeof(v)); return v; }
+    }
+}
+
+
+static uint64_t encode_block(const vector_t *const source,
+        const size_t begin,
+        const size_t count,
+        const packvec_encoding_t encoding,
+        uint64_t *const out)
+{
+    /* padding values encode to zero */
+    memset(out, 0, PACKVEC_BLOCK * sizeof(uint64_t));
+
+    if (PACKVEC_FOR == encoding)
+    {
+        uint64_t min = UINT64_MAX;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const uint64_t value = load_value(source, begin + i);
+            if (value < min) min = value;
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            out[i] = load_value(source, begin + i) - min;
+        }
+        return min;
+    }
+
+    const uint64_t first = load_value(source, begin);
+    uint64_t prev = first;
+    for (size_t i = 1; i < count; ++i)
+    {
+        const uint64_t value = load_value(source, begin + i);
+        out[i] = value - prev;
+        prev = value;
+    }
+    return first;
+}
+
+
+static size_t bit_width(const uint64_t value)
+{
+    return value ? (size_t) (WORD_BITS - __builtin_clzll(value)) : 0;
+}
+
+
+static void pack(uint64_t *const words, const uint64_t *const values, const size_t width)
+{
+    if (0 == width)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < PACKVEC_BLOCK; ++i)
+    {
+        const size_t bit = i * width;
+        const size_t word = bit / WORD_BITS;
+        const size_t shift = bit % WORD_BITS;
+
+        words[word] |= values[i] << shift;
+        if (shift + width > WORD_BITS)
+        {
+            words[word + 1] |= values[i] >> (WORD_BITS - shift);
+        }
+    }
+}
+
+
+static uint64_t unpack_one(const uint64_t *const words, const size_t index, const size_t width)
+{
+    if (0 == width)
+    {
+        return 0;
+    }
+
+    const size_t bit = index * width;
+    const size_t word = bit / WORD_BITS;
+    const size_t shift = bit % WORD_BITS;
+    const uint64_t mask = (WORD_BITS == width) ? UINT64_MAX : ((uint64_t)1 << width) - 1;
+
+    /* double shift avoids shifting by 64 when value does not cross words */
+    const uint64_t value = (words[word] >> shift) | ((words[word + 1] << 1) << (WORD_BITS - 1 - shift));
+    return value & mask;
+}
+
+
+static void unpack(const uint64_t *const words, const size_t width, uint64_t *const out)
+{
+    if (0 == width)
+    {
+        memset(out, 0, PACKVEC_BLOCK * sizeof(uint64_t));
+        return;
+    }
+
+#if defined(__AVX2__)
+    const __m256i mask = _mm256_set1_epi64x((WORD_BITS == width) ? -1LL : (long long) (((uint64_t)1 << width) - 1));
+    const __m256i step = _mm256_set1_epi64x((long long) (4 * width));
+    const __m256i low_bits = _mm256_set1_epi64x(WORD_BITS - 1);
+    const __m256i one = _mm256_set1_epi64x(1);
+    __m256i bits = _mm256_setr_epi64x(0, (long long) width, (long long) (2 * width), (long long) (3 * width));
+
+    for (size_t i = 0; i < PACKVEC_BLOCK; i += 4)
+    {
+        const __m256i index = _mm256_srli_epi64(bits, 6);
+        const __m256i shift = _mm256_and_si256(bits, low_bits);
+        const __m256i lo = _mm256_i64gather_epi64((const long long *) words, index, 8);
+        const __m256i hi = _mm256_i64gather_epi64((const long long *) words + 1, index, 8);
+
+        const __m256i value = _mm256_or_si256(_mm256_srlv_epi64(lo, shift),
+                _mm256_sllv_epi64(_mm256_sllv_epi64(hi, one), _mm256_sub_epi64(low_bits, shift)));
+
+        _mm256_storeu_si256((__m256i *) (out + i), _mm256_and_si256(value, mask));
+        bits = _mm256_add_epi64(bits, step);
+    }
+#else
+    for (size_t i = 0; i < PACKVEC_BLOCK; ++i)
+    {
+        out[i] = unpack_one(words, i, width);
+    }
+#endif
+}
@@ -0,0 +1,152 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Public interface of the compressed integer vector
+*/
+
+#ifndef _PACKVEC_H_
+#define _PACKVEC_H_
+
+#include <stdint.h> /* uint64_t */
+
+#include "vector.h"
+
+/**
+* @brief Amount of values encoded together.
+*/
+#define PACKVEC_BLOCK 128
+
+/**
+* @brief   Read-only compressed vector of unsigned integers.
+* @details Values are split into blocks of @ref PACKVEC_BLOCK,
+*          each block is frame-of-reference or delta encoded and bit-packed
+*          with the minimal width. Packed words are elements of a @ref vector_t,
+*          block index (base, width, offset) lives in its extension header.
+*          Blocks are unpacked with AVX2 where available.
+*/
+typedef struct packvec_t packvec_t;
+
+/**
+* @brief Block encoding.
+*/
+typedef enum packvec_encoding_t
+{
+    PACKVEC_FOR,   /**< Offsets from the block minimum, O(1) random access. */
+    PACKVEC_DELTA, /**< Differences between neighbours, best for sorted values. */
+}
+packvec_encoding_t;
+
+/**
+* @brief   Compressed vector options.
+* @details Parameters that are passed to a @ref packvec_create_ function.
+*/
+typedef struct packvec_opts_t
+{
+    alloc_opts_t alloc_opts;     /**< @brief optional allocator */
+    /* required: */
+    const vector_t *source;      /**< @brief Vector of unsigned integers, elements of 1, 2, 4 or 8 bytes. */
+    size_t length;               /**< @brief Amount of source elements to be encoded. */
+
+    /* optional: */
+    packvec_encoding_t encoding; /**< @brief Block encoding. */
+}
+packvec_opts_t;
+
+/**
+ * @addtogroup Packvec_API Compressed Vector API
+ * @brief      Compressed integer vector methods. @{ */
+
+/**
+* @brief   Compressed vector constructor.
+* @details Preferable way to invoke constructor.
+* @warning @ref packvec_opts_t::source "source" is mandatory!
+* @see packvec_create_
+*/
+#define packvec_create(...) \
+    packvec_create_( \
+        &(packvec_opts_t) { \
+            __VA_ARGS__ \
+        }\
+    )\
+
+/**
+* @brief   Encodes source vector.
+*
+* @param[in] opts Options according to which vector will be encoded.
+* @returns        Compressed vector or @c NULL if allocation failed.
+*/
+packvec_t *packvec_create_(const packvec_opts_t *const opts);
+
+
+/**
+* @brief   Deallocates compressed vector.
+*
+* @param[in] packvec Vector that will be deallocated.
+*/
+void packvec_destroy(packvec_t *const packvec);
+
+
+/**
+* @brief   Reports amount of encoded values.
+*
+* @param[in] packvec Pointer to a compressed vector instance.
+* @returns           Amount of values.
+*/
+size_t packvec_length(const packvec_t *const packvec);
+
+
+/**
+* @brief   Reports amount of blocks.
+*
+* @param[in] packvec Pointer to a compressed vector instance.
+* @returns           Amount of blocks, the last one may be partial.
+*/
+size_t packvec_blocks(const packvec_t *const packvec);
+
+
+/**
+* @brief   Reports memory taken by packed words and block index.
+*
+* @param[in] packvec Pointer to a compressed vector instance.
+* @returns           Size in bytes.
+*/
+size_t packvec_memory(const packvec_t *const packvec);
+
+
+/**
+* @brief   Decodes single value.
+* @details O(1) for @ref PACKVEC_FOR, delta encoded blocks are summed up to @c index.
+*
+* @param[in] packvec Pointer to a compressed vector instance.
+* @param[in] index   Position of the value.
+* @returns           Decoded value.
+*/
+uint64_t packvec_get(const packvec_t *const packvec, const size_t index);
+
+
+/**
+* @brief   Decodes whole block into caller's buffer.
+*
+* @param[in]  packvec Pointer to a compressed vector instance.
+* @param[in]  block   Block index.
+* @param[out] out     Buffer for @ref PACKVEC_BLOCK values.
+* @returns            Amount of valid values in the block.
+*/
+size_t packvec_decode(const packvec_t *const packvec, const size_t block, uint64_t *const out);
+
+
+/**
+* @brief   Perform immutable action on each value.
+* @details Values are decoded block by block into a local buffer,
+*          callback receives pointer to @c uint64_t.
+*
+* @param[in] packvec    Pointer to a compressed vector instance.
+* @param[in] func       Action to be performed.
+* @param[in,out] param  User defined parameter, passed to func.
+* @returns              Zero on success, or nonzero value - user defined status code.
+*/
+int packvec_foreach(const packvec_t *const packvec, const foreach_t func, void *const param);
+
+/** @} @noop Packvec_API */
+
+#endif/*_PACKVEC_H_*/
@@ -0,0 +1,336 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Implementation of the read-mostly RCU vector wrapper
+*/
+
+#include "rcu.h"
+
+#include <assert.h>    /** assert */
+#include <sched.h>     /** sched_yield */
+#include <stdatomic.h> /** atomic_size_t, atomic_exchange_explicit */
+#include <stdint.h>    /** SIZE_MAX */
+
+/**
+ * @internal
+ * @brief Assumed cache line size, every reader slot occupies its own line.
+ */
+#define CACHE_LINE 64
+
+/**
+ * @internal
+ * @brief Reader slot epoch value meaning reader is outside of critical section.
+ */
+#define QUIESCENT 0
+
+/**
+ * @internal
+ * @brief Wrapper state stored in vector's extension header.
+ */
+typedef struct rcu_header_t
+{
+    _Atomic(vector_t *) current; /**< @brief Published version. */
+    atomic_size_t epoch;         /**< @brief Global epoch, advanced on every publication. */
+    char read_pad[CACHE_LINE - sizeof(atomic_size_t) - sizeof(vector_t *)];
+
+    atomic_flag writer;          /**< @brief Serializes writers. */
+    vector_t *retired;           /**< @brief Versions waiting for readers to leave. */
+    size_t retired_count;        /**< @brief Amount of pending versions. */
+}
+rcu_header_t;
+
+/**
+ * @internal
+ * @brief Version replaced at certain epoch.
+ */
+typedef struct retired_t
+{
+    vector_t *vector; /**< @brief Replaced version. */
+    size_t epoch;     /**< @brief Epoch at which version was replaced. */
+}
+retired_t;
+
+/**
+ * @internal
+ * @brief Reader slot, padded to a cache line to avoid false sharing.
+ */
+typedef struct reader_t
+{
+    atomic_size_t epoch; /**< @brief Epoch observed on entry or @ref QUIESCENT. */
+    char pad[CACHE_LINE - sizeof(atomic_size_t)];
+}
+reader_t;
+
+/*                             *
+* === Forward Declarations === *
+*                             */
+
+/**
+* @brief   Access wrapper state.
+*/
+static rcu_header_t *get_rcu_header(const rcu_t *const rcu);
+
+/**
+* @brief   Access reader slot.
+*/
+static reader_t *get_reader(const rcu_t *const rcu, const size_t reader);
+
+/**
+* @brief   Spins until writer lock is acquired.
+*/
+static void writer_lock(rcu_header_t *const header);
+
+/**
+* @brief   Releases writer lock.
+*/
+static void writer_unlock(rcu_header_t *const header);
+
+/**
+* @brief   Finds oldest epoch still observed by readers.
+* @returns Minimal active epoch or @c SIZE_MAX when all readers are quiescent.
+*/
+static size_t oldest_reader_epoch(const rcu_t *const rcu);
+
+/**
+* @brief   Destroys retired versions older than every active reader.
+* @warning Must be called with writer lock held.
+*/
+static void reclaim_locked(rcu_t *const rcu);
+
+
+/*                             *
+* === API Implementation   === *
+*                             */
+
+rcu_t *rcu_create_(const rcu_opts_t *const opts)
+{
+    assert(opts && "non-null opts required!");
+    assert(opts->vector && "non-null 'vector' required!");
+    assert(opts->readers && "'readers' gt then zero required!");
+
+    vector_t *slots = vector_create_(&(vector_opts_t) {
+        .alloc_opts = opts->alloc_opts,
+        .ext_header_size = sizeof(rcu_header_t),
+        .element_size = sizeof(reader_t),
+        .initial_cap = opts->readers,
+    });
+
+    if (!slots)
+    {
+        return NULL;
+    }
+
+    rcu_header_t *header = vector_get_ext_header(slots);
+    atomic_init(&header->current, opts->vector);
+    atomic_init(&header->epoch, QUIESCENT + 1);
+    atomic_flag_clear(&header->writer);
+    header->retired = NULL;
+    header->retired_count = 0;
+
+    for (size_t i = 0; i < opts->readers; ++i)
+    {
+        atomic_init(&((reader_t *) vector_get(slots, i))->epoch, QUIESCENT);
+    }
+
+    return (rcu_t *) slots;
+}
+
+
+void rcu_destroy(rcu_t *const rcu)
+{
+    assert(rcu);
+
+    rcu_header_t *header = get_rcu_header(rcu);
+    if (header->retired)
+    {
+        for (size_t i = 0; i < header->retired_count; ++i)
+        {
+            vector_destroy(((retired_t *) vector_get(header->retired, i))->vector);
+        }
+        vector_destroy(header->retired);
+    }
+
+    vector_destroy(atomic_load_explicit(&header->current, memory_order_relaxed));
+    vector_destroy((vector_t *) rcu);
+}
+
+
+size_t rcu_readers(const rcu_t *const rcu)
+{
+    assert(rcu);
+    return vector_capacity((const vector_t *) rcu);
+}
+
+
+const vector_t *rcu_read_lock(rcu_t *const rcu, const size_t reader)
+{
+    assert(rcu);
+    assert((reader < rcu_readers(rcu)) && "Reader slot out of range!");
+
+    rcu_header_t *header = get_rcu_header(rcu);
+    reader_t *slot = get_reader(rcu, reader);
+    assert((atomic_load_explicit(&slot->epoch, memory_order_relaxed) == QUIESCENT)
+            && "Nested read side critical section!");
+
+    /* writers publish the version before advancing the epoch, acquiring the epoch
+       guarantees the version loaded below is not older than the announced epoch */
+    const size_t epoch = atomic_load_explicit(&header->epoch, memory_order_acquire);
+
+    /* announce epoch before loading the version, writers observe either
+       the announcement or the already published successor */
+    atomic_store_explicit(&slot->epoch, epoch, memory_order_seq_cst);
+
+    return atomic_load_explicit(&header->current, memory_order_seq_cst);
+}
+
+
+void rcu_read_unlock(rcu_t *const rcu, const size_t reader)
+{
+    assert(rcu);
+    assert((reader < rcu_readers(rcu)) && "Reader slot out of range!");
+
+    atomic_store_explicit(&get_reader(rcu, reader)->epoch, QUIESCENT, memory_order_release);
+}
+
+
+rcu_status_t rcu_update(rcu_t *const rcu, const rcu_update_t update, void *const param)
+{
+    assert(rcu);
+    assert(update);
+
+    rcu_header_t *header = get_rcu_header(rcu);
+    writer_lock(header);
+
+    /* make room for the retired version up front, publication must not fail */
+    if (!header->retired || header->retired_count == vector_capacity(header->retired))
+    {
+        const size_t capacity = header->retired ? vector_capacity(header->retired) * 2 : 4;
+        vector_status_t status = VECTOR_SUCCESS;
+
+        if (header->retired)
+        {
+            status = vector_resize(&header->retired, capacity, VECTOR_ALLOC_ERROR);
+        }
+        else
+        {
+            header->retired = vector_create(
+                .alloc_opts = vector_alloc_opts((vector_t *) rcu),
+                .element_size = sizeof(retired_t),
+                .initial_cap = capacity
+            );
+            if (!header->retired) status = VECTOR_ALLOC_ERROR;
+        }
+
+        if (VECTOR_SUCCESS != status)
+        {
+            writer_unlock(header);
+            return RCU_ALLOC_ERROR;
+        }
+    }
+
+    vector_t *copy = vector_clone(atomic_load_explicit(&header->current, memory_order_relaxed));
+    if (!copy)
+    {
+        writer_unlock(header);
+        return RCU_ALLOC_ERROR;
+    }
+
+    if (update(&copy, param))
+    {
+        vector_destroy(copy);
+        writer_unlock(header);
+        return RCU_ABORTED;
+    }
+
+    vector_t *old = atomic_exchange_explicit(&header->current, copy, memory_order_seq_cst);
+    const size_t epoch = atomic_fetch_add_explicit(&header->epoch, 1, memory_order_seq_cst);
+
+    vector_set(header->retired, header->retired_count++, &(retired_t){.vector = old, .epoch = epoch});
+    reclaim_locked(rcu);
+
+    writer_unlock(header);
+    return RCU_SUCCESS;
+}
+
+
+size_t rcu_reclaim(rcu_t *const rcu)
+{
+    assert(rcu);
+
+    rcu_header_t *header = get_rcu_header(rcu);
+    writer_lock(header);
+    reclaim_locked(rcu);
+    const size_t pending = header->retired_count;
+    writer_unlock(header);
+
+    return pending;
+}
+
+
+/*                        **
+* === Static Functions === *
+*                         */
+
+static rcu_header_t *get_rcu_header(const rcu_t *const rcu)
+{
+    return (rcu_header_t *) vector_get_ext_header((const vector_t *) rcu);
+}
+
+
+static reader_t *get_reader(const rcu_t *const rcu, const size_t reader)
+{
+    return (reader_t *) vector_get((const vector_t *) rcu, reader);
+}
+
+
+static void writer_lock(rcu_header_t *const header)
+{
+    while (atomic_flag_test_and_set_explicit(&header->writer, memory_order_acquire))
+    {
+        sched_yield();
+    }
+}
+
+
+static void writer_unlock(rcu_header_t *const header)
+{
+    atomic_flag_clear_explicit(&header->writer, memory_order_release);
+}
+
+
+static size_t oldest_reader_epoch(const rcu_t *const rcu)
+{
+    size_t oldest = SIZE_MAX;
+    for (size_t i = 0; i < rcu_readers(rcu); ++i)
+    {
+        const size_t epoch = atomic_load_explicit(&get_reader(rcu, i)->epoch, memory_order_seq_cst);
+        if (QUIESCENT != epoch && epoch < oldest)
+        {
+            oldest = epoch;
+        }
+    }
+    return oldest;
+}
+
+
+static void reclaim_locked(rcu_t *const rcu)
+{
+    rcu_header_t *header = get_rcu_header(rcu);
+    const size_t oldest = oldest_reader_epoch(rcu);
+
+    /* version replaced at epoch E may be held by readers that entered at epoch <= E */
+    size_t kept = 0;
+    for (size_t i = 0; i < header->retired_count; ++i)
+    {
+        retired_t *entry = vector_get(header->retired, i);
+        if (entry->epoch < oldest)
+        {
+            vector_destroy(entry->vector);
+        }
+        else if (kept++ != i)
+        {
+            vector_set(header->retired, kept - 1, entry);
+        }
+    }
+    header->retired_count = kept;
+}
@@ -0,0 +1,158 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Public interface of the read-mostly RCU vector wrapper
+*/
+
+#ifndef _RCU_H_
+#define _RCU_H_
+
+#include "vector.h"
+
+/**
+* @brief   Read-mostly wrapper around a @ref vector_t.
+* @details Readers get the current version of the vector without waiting.
+*          Writers clone the current version, modify the copy and publish it atomically.
+*          Replaced versions are retired and passed to @ref vector_destroy
+*          only after every reader that could observe them has left (epoch based reclamation).
+*          Each reader thread owns a dedicated reader slot.
+*/
+typedef struct rcu_t rcu_t;
+
+/**
+* @brief   Wrapper options.
+* @details Parameters that are passed to a @ref rcu_create_ function.
+*/
+typedef struct rcu_opts_t
+{
+    alloc_opts_t alloc_opts; /**< @brief optional allocator for the wrapper state */
+    /* required: */
+    vector_t *vector;        /**< @brief Initial version, ownership is transferred to the wrapper. */
+
+    /* optional: */
+    size_t readers;          /**< @brief Amount of reader slots. */
+}
+rcu_opts_t;
+
+/**
+* @brief   Status of wrapper operations that may fail.
+* @details Extends @ref vector_status_t.
+*/
+typedef enum rcu_status_t
+{
+    RCU_SUCCESS = VECTOR_SUCCESS,          /**< Success operation status code. */
+    RCU_ALLOC_ERROR = VECTOR_ALLOC_ERROR,  /**< Copy or bookkeeping allocation failed. */
+    RCU_ABORTED = VECTOR_STATUS_LAST,      /**< Update callback rejected the copy, nothing published. */
+    RCU_STATUS_LAST                        /**< Indicates end of the enum values. */
+}
+rcu_status_t;
+
+/**
+* @brief   Callback that modifies private copy of the vector.
+* @details Copy may be resized, pointer is updated in place.
+*
+* @param[in,out] copy  Private copy of the current version.
+* @param[in,out] param User defined parameter.
+* @returns             Zero to publish the copy, nonzero to discard it.
+*/
+typedef int (*rcu_update_t) (vector_t **const copy, void *const param);
+
+/**
+* Represents wrapper default create values.
+*/
+#define RCU_DEFAULT_ARGS \
+    .readers = 64
+
+/**
+ * @addtogroup RCU_API RCU Vector API
+ * @brief      Read-mostly vector wrapper methods. @{ */
+
+/**
+* @brief   Wrapper constructor.
+* @details Preferable way to invoke constructor.
+*          Provides default values.
+* @warning @ref rcu_opts_t::vector "vector" is mandatory!
+* @see rcu_create_
+*/
+#define rcu_create(...) \
+    rcu_create_( \
+        &(rcu_opts_t) { \
+            RCU_DEFAULT_ARGS,\
+            __VA_ARGS__ \
+        }\
+    )\
+
+/**
+* @brief   Wrapper constructor.
+* @warning Not thread safe, publish wrapper to other threads after creation.
+*
+* @param[in] opts Options according to which wrapper will be created.
+* @returns        Fresh new wrapper or @c NULL if allocation failed,
+*                 initial vector is not taken over in that case.
+*/
+rcu_t *rcu_create_(const rcu_opts_t *const opts);
+
+
+/**
+* @brief   Deallocates wrapper, current and all retired versions.
+* @warning All threads must be done with the wrapper.
+*
+* @param[in] rcu Wrapper that will be deallocated.
+*/
+void rcu_destroy(rcu_t *const rcu);
+
+
+/**
+* @brief   Reports amount of reader slots.
+*
+* @param[in] rcu Pointer to a wrapper instance.
+* @returns       Amount of reader slots.
+*/
+size_t rcu_readers(const rcu_t *const rcu);
+
+
+/**
+* @brief   Enters read side critical section, wait-free.
+* @details Returned version stays valid until @ref rcu_read_unlock with the same slot.
+*          Sections must not be nested within the same slot.
+*
+* @param[in] rcu    Pointer to a wrapper instance.
+* @param[in] reader Reader slot owned by calling thread.
+* @returns          Current version of the vector.
+*/
+const vector_t *rcu_read_lock(rcu_t *const rcu, const size_t reader);
+
+
+/**
+* @brief   Leaves read side critical section, wait-free.
+*
+* @param[in] rcu    Pointer to a wrapper instance.
+* @param[in] reader Reader slot owned by calling thread.
+*/
+void rcu_read_unlock(rcu_t *const rcu, const size_t reader);
+
+
+/**
+* @brief   Publishes modified copy of the current version.
+* @details Writers are serialized. Replaced version is retired
+*          and versions no longer visible to readers are reclaimed.
+*
+* @param[in] rcu        Pointer to a wrapper instance.
+* @param[in] update     Callback that modifies private copy.
+* @param[in,out] param  User defined parameter, passed to update.
+* @returns              Operation status.
+*/
+rcu_status_t rcu_update(rcu_t *const rcu, const rcu_update_t update, void *const param);
+
+
+/**
+* @brief   Destroys retired versions that no reader can observe anymore.
+*
+* @param[in] rcu Pointer to a wrapper instance.
+* @returns       Amount of retired versions still pending.
+*/
+size_t rcu_reclaim(rcu_t *const rcu);
+
+/** @} @noop RCU_API */
+
+#endif/*_RCU_H_*/
@@ -0,0 +1,303 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Implementation of the ring buffer
+*/
+
+#include "ring.h"
+
+#include <assert.h> /** assert */
+#include <string.h> /** memcpy */
+
+/**
+ * @internal
+ * @brief Ring state stored in vector's extension header.
+ */
+typedef struct ring_header_t
+{
+    size_t head; /**< @brief Index of the front element. */
+    size_t size; /**< @brief Amount of stored elements. */
+}
+ring_header_t;
+
+/*                             *
+* === Forward Declarations === *
+*                             */
+
+/**
+* @brief   Access ring state.
+*/
+static ring_header_t *get_ring_header(const ring_t *const ring);
+
+/**
+* @brief   Rounds @c value up to the nearest power of two (at least 1).
+*/
+static size_t round_pow2(const size_t value);
+
+/**
+* @brief   Grows ring when it is full.
+*/
+static ring_status_t grow_if_full(ring_t **const ring, const size_t required);
+
+
+/*                             *
+* === API Implementation   === *
+*                             */
+
+ring_t *ring_create_(const ring_opts_t *const opts)
+{
+    assert(opts && "non-null opts required!");
+
+    vector_t *vector = vector_create_(&(vector_opts_t) {
+        .alloc_opts = opts->alloc_opts,
+        .ext_header_size = sizeof(ring_header_t),
+        .element_size = opts->element_size,
+        .initial_cap = round_pow2(opts->initial_cap),
+    });
+
+    if (!vector)
+    {
+        return NULL;
+    }
+
+    *(ring_header_t *) vector_get_ext_header(vector) = (ring_header_t) {0};
+    return (ring_t *) vector;
+}
+
+
+void ring_destroy(ring_t *const ring)
+{
+    assert(ring);
+    vector_destroy((vector_t *) ring);
+}
+
+
+size_t ring_size(const ring_t *const ring)
+{
+    assert(ring);
+    return get_ring_header(ring)->size;
+}
+
+
+size_t ring_capacity(const ring_t *const ring)
+{
+    assert(ring);
+    return vector_capacity((const vector_t *) ring);
+}
+
+
+ring_status_t ring_reserve(ring_t **const ring, const size_t capacity)
+{
+    assert(ring && *ring);
+
+    vector_t *vector = (vector_t *) *ring;
+    const size_t old_cap = vector_capacity(vector);
+    const size_t new_cap = round_pow2(capacity);
+
+    if (new_cap <= old_cap)
+    {
+        return RING_SUCCESS;
+    }
+
+    ring_status_t status = (ring_status_t) vector_resize(&vector, new_cap, (vector_status_t) RING_ALLOC_ERROR);
+    if (RING_SUCCESS != status)
+    {
+        return status;
+    }
+
+    /* unwrap: move the shorter contiguous part into grown region */
+    ring_header_t *header = vector_get_ext_header(vector);
+    if (header->head + header->size > old_cap)
+    {
+        const size_t front = old_cap - header->head;
+        const size_t wrapped = header->size - front;
+
+        if (wrapped <= front && old_cap + wrapped <= new_cap)
+        {
+            vector_copy(vector, vector_get(vector, old_cap), 0, wrapped);
+        }
+        else
+        {
+            const size_t new_head = new_cap - front;
+            vector_move(vector, vector_get(vector, new_head), header->head, front);
+            header->head = new_head;
+        }
+    }
+
+    *ring = (ring_t *) vector;
+    return RING_SUCCESS;
+}
+
+
+void *ring_get(const ring_t *const ring, const size_t index)
+{
+    assert(ring);
+    const ring_header_t *header = get_ring_header(ring);
+    assert((index < header->size) && "Index out of ring bounds!");
+
+    const vector_t *vector = (const vector_t *) ring;
+    return vector_get(vector, (header->head + index) & (vector_capacity(vector) - 1));
+}
+
+
+ring_status_t ring_push_back(ring_t **const ring, const void *const value)
+{
+    assert(ring && *ring);
+    assert(value);
+
+    ring_status_t status = grow_if_full(ring, 1);
+    if (RING_SUCCESS != status)
+    {
+        return status;
+    }
+
+    vector_t *vector = (vector_t *) *ring;
+    ring_header_t *header = vector_get_ext_header(vector);
+    vector_set(vector, (header->head + header->size) & (vector_capacity(vector) - 1), value);
+    ++header->size;
+    return RING_SUCCESS;
+}
+
+
+ring_status_t ring_push_front(ring_t **const ring, const void *const value)
+{
+    assert(ring && *ring);
+    assert(value);
+
+    ring_status_t status = grow_if_full(ring, 1);
+    if (RING_SUCCESS != status)
+    {
+        return status;
+    }
+
+    vector_t *vector = (vector_t *) *ring;
+    ring_header_t *header = vector_get_ext_header(vector);
+    header->head = (header->head - 1) & (vector_capacity(vector) - 1);
+    vector_set(vector, header->head, value);
+    ++header->size;
+    return RING_SUCCESS;
+}
+
+
+ring_status_t ring_pop_front(ring_t *const ring, void *const out)
+{
+    assert(ring);
+
+    vector_t *vector = (vector_t *) ring;
+    ring_header_t *header = vector_get_ext_header(vector);
+    if (0 == header->size)
+    {
+        return RING_EMPTY;
+    }
+
+    if (out)
+    {
+        vector_copy(vector, out, header->head, 1);
+    }
+    header->head = (header->head + 1) & (vector_capacity(vector) - 1);
+    --header->size;
+    return RING_SUCCESS;
+}
+
+
+ring_status_t ring_pop_back(ring_t *const ring, void *const out)
+{
+    assert(ring);
+
+    vector_t *vector = (vector_t *) ring;
+    ring_header_t *header = vector_get_ext_header(vector);
+    if (0 == header->size)
+    {
+        return RING_EMPTY;
+    }
+
+    --header->size;
+    if (out)
+    {
+        vector_copy(vector, out, (header->head + header->size) & (vector_capacity(vector) - 1), 1);
+    }
+    return RING_SUCCESS;
+}
+
+
+ring_status_t ring_enqueue(ring_t **const ring, const void *const values, const size_t count)
+{
+    assert(ring && *ring);
+    assert(values || !count);
+
+    ring_status_t status = grow_if_full(ring, count);
+    if (RING_SUCCESS != status)
+    {
+        return status;
+    }
+
+    vector_t *vector = (vector_t *) *ring;
+    ring_header_t *header = vector_get_ext_header(vector);
+    const size_t capacity = vector_capacity(vector);
+    const size_t element_size = vector_element_size(vector);
+
+    const size_t tail = (header->head + header->size) & (capacity - 1);
+    const size_t first = (count < capacity - tail) ? count : capacity - tail;
+
+    memcpy(vector_data(vector) + tail * element_size, values, first * element_size);
+    memcpy(vector_data(vector), (const char *) values + first * element_size, (count - first) * element_size);
+
+    header->size += count;
+    return RING_SUCCESS;
+}
+
+
+size_t ring_dequeue(ring_t *const ring, void *const out, const size_t count)
+{
+    assert(ring);
+
+    vector_t *vector = (vector_t *) ring;
+    ring_header_t *header = vector_get_ext_header(vector);
+    const size_t capacity = vector_capacity(vector);
+    const size_t amount = (count < header->size) ? count : header->size;
+
+    if (out)
+    {
+        const size_t first = (amount < capacity - header->head) ? amount : capacity - header->head;
+        vector_copy(vector, out, header->head, first);
+        vector_copy(vector, (char *) out + first * vector_element_size(vector), 0, amount - first);
+    }
+
+    header->head = (header->head + amount) & (capacity - 1);
+    header->size -= amount;
+    return amount;
+}
+
+
+/*                        **
+* === Static Functions === *
+*                         */
+
+static ring_header_t *get_ring_header(const ring_t *const ring)
+{
+    return (ring_header_t *) vector_get_ext_header((const vector_t *) ring);
+}
+
+
+static size_t round_pow2(const size_t value)
+{
+    size_t pow2 = 1;
+    while (pow2 < value) pow2 <<= 1;
+    return pow2;
+}
+
+
+static ring_status_t grow_if_full(ring_t **const ring, const size_t required)
+{
+    const size_t size = ring_size(*ring);
+    const size_t capacity = ring_capacity(*ring);
+
+    if (size + required <= capacity)
+    {
+        return RING_SUCCESS;
+    }
+
+    /* at least double, keeps amortized O(1) push */
+    const size_t desired = size + required;
+    return ring_reserve(ring, (desired > capacity * 2) ? desired : capacity * 2);
+}
@@ -0,0 +1,198 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Public interface of the ring buffer
+*/
+
+#ifndef _RING_H_
+#define _RING_H_
+
+#include "vector.h"
+
+/**
+* @brief   Ring buffer (double ended queue) derived from @ref vector_t.
+* @details Elements are stored in vector's buffer with power of two capacity,
+*          head index and size are kept in the extension header.
+*          Push and pop at both ends are O(1).
+*          Functions that can grow the ring take a double pointer.
+*/
+typedef struct ring_t ring_t;
+
+/**
+* @brief   Ring options.
+* @details Parameters that are passed to a @ref ring_create_ function.
+*/
+typedef struct ring_opts_t
+{
+    alloc_opts_t alloc_opts;  /**< @brief optional allocator */
+    /* required: */
+    size_t element_size;      /**< @brief Size of the stored element type. */
+
+    /* optional: */
+    size_t initial_cap;       /**< @brief Preallocated elements, rounded up to a power of two. */
+}
+ring_opts_t;
+
+/**
+* @brief   Status of ring operations that may fail.
+* @details Extends @ref vector_status_t.
+*/
+typedef enum ring_status_t
+{
+    RING_SUCCESS = VECTOR_SUCCESS,         /**< Success operation status code. */
+    RING_ALLOC_ERROR = VECTOR_ALLOC_ERROR, /**< Allocation error status code. */
+    RING_EMPTY = VECTOR_STATUS_LAST,       /**< Nothing to pop from the ring. */
+    RING_STATUS_LAST                       /**< Indicates end of the enum values. */
+}
+ring_status_t;
+
+/**
+* Represents ring default create values.
+*/
+#define RING_DEFAULT_ARGS \
+    .initial_cap = 16
+
+/**
+ * @addtogroup Ring_API Ring API
+ * @brief      Ring buffer methods. @{ */
+
+/**
+* @brief   Ring constructor.
+* @details Preferable way to invoke ring constructor.
+*          Provides default values.
+* @warning @ref ring_opts_t::element_size "element_size" is mandatory!
+* @see ring_create_
+*/
+#define ring_create(...) \
+    ring_create_( \
+        &(ring_opts_t) { \
+            RING_DEFAULT_ARGS,\
+            __VA_ARGS__ \
+        }\
+    )\
+
+/**
+* @brief   Ring constructor.
+*
+* @param[in] opts Options according to which ring will be created.
+* @returns        Fresh new empty ring or @c NULL if allocation failed.
+*/
+ring_t *ring_create_(const ring_opts_t *const opts);
+
+
+/**
+* @brief   Deallocates ring.
+*
+* @param[in] ring Ring pointer that will be deallocated.
+*/
+void ring_destroy(ring_t *const ring);
+
+
+/**
+* @brief   Reports amount of stored elements.
+*
+* @param[in] ring Pointer to a ring instance.
+* @returns        Amount of elements in the ring.
+*/
+size_t ring_size(const ring_t *const ring);
+
+
+/**
+* @brief   Reports amount of elements ring can store without growing.
+*
+* @param[in] ring Pointer to a ring instance.
+* @returns        Capacity of the ring, always a power of two.
+*/
+size_t ring_capacity(const ring_t *const ring);
+
+
+/**
+* @brief   Grows ring to hold at least @c capacity elements.
+* @details Capacity is rounded up to a power of two.
+*          Wrapped around elements are unwrapped into the grown region,
+*          the shorter of two contiguous parts is moved.
+*
+* @param[in] ring     Reference to ring pointer.
+* @param[in] capacity Desired minimal capacity.
+* @returns            Operation status.
+*/
+ring_status_t ring_reserve(ring_t **const ring, const size_t capacity);
+
+
+/**
+* @brief   Access element at @c index counting from the front.
+*
+* @param[in] ring  Pointer to a ring instance.
+* @param[in] index Position from the front, less than @ref ring_size.
+* @returns         Pointer to the element.
+*/
+void *ring_get(const ring_t *const ring, const size_t index);
+
+
+/**
+* @brief   Appends element to the back, growing the ring when full.
+*
+* @param[in] ring  Reference to ring pointer.
+* @param[in] value Value to be copied.
+* @returns         Operation status.
+*/
+ring_status_t ring_push_back(ring_t **const ring, const void *const value);
+
+
+/**
+* @brief   Prepends element to the front, growing the ring when full.
+*
+* @param[in] ring  Reference to ring pointer.
+* @param[in] value Value to be copied.
+* @returns         Operation status.
+*/
+ring_status_t ring_push_front(ring_t **const ring, const void *const value);
+
+
+/**
+* @brief   Removes element from the front.
+*
+* @param[in]  ring Pointer to a ring instance.
+* @param[out] out  Location for removed value, may be @c NULL.
+* @returns         @ref RING_EMPTY if nothing to remove, otherwise @ref RING_SUCCESS.
+*/
+ring_status_t ring_pop_front(ring_t *const ring, void *const out);
+
+
+/**
+* @brief   Removes element from the back.
+*
+* @param[in]  ring Pointer to a ring instance.
+* @param[out] out  Location for removed value, may be @c NULL.
+* @returns         @ref RING_EMPTY if nothing to remove, otherwise @ref RING_SUCCESS.
+*/
+ring_status_t ring_pop_back(ring_t *const ring, void *const out);
+
+
+/**
+* @brief   Appends contiguous span of elements to the back.
+* @details Grows the ring once if needed, then copies the span
+*          with at most two copies.
+*
+* @param[in] ring   Reference to ring pointer.
+* @param[in] values Contiguous array of @c count elements.
+* @param[in] count  Amount of elements to be enqueued.
+* @returns          Operation status.
+*/
+ring_status_t ring_enqueue(ring_t **const ring, const void *const values, const size_t count);
+
+
+/**
+* @brief   Removes up to @c count elements from the front into contiguous span.
+* @details Copies elements with at most two copies.
+*
+* @param[in]  ring  Pointer to a ring instance.
+* @param[out] out   Destination array for @c count elements, may be @c NULL to discard.
+* @param[in]  count Maximal amount of elements to be dequeued.
+* @returns          Amount of elements dequeued.
+*/
+size_t ring_dequeue(ring_t *const ring, void *const out, const size_t count);
+
+/** @} @noop Ring_API */
+
+#endif/*_RING_H_*/
@@ -0,0 +1,341 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Implementation of the selection algorithms
+*/
+
+#include "selection.h"
+
+#include <assert.h> /** assert */
+
+/**
+* @brief   Ranges not longer than this are finished with insertion sort.
+*/
+#define INSERTION_THRESHOLD 16
+
+/**
+ * @internal
+ * @brief Bundles what every comparison needs.
+ */
+typedef struct order_t
+{
+    vector_t *vector;
+    compare_t cmp;
+    void *param;
+}
+order_t;
+
+/*                             *
+* === Forward Declarations === *
+*                             */
+
+/**
+* @brief   Tells whether element at @c a goes before element at @c b.
+*/
+static bool less(const order_t *const order, const size_t a, const size_t b);
+
+/**
+* @brief   Swaps two elements, tolerates equal indices.
+*/
+static void swap(const order_t *const order, const size_t a, const size_t b);
+
+/**
+* @brief   Restores max-heap property below @c node of a heap rooted at @c base.
+*/
+static void sift_down(const order_t *const order, const size_t base, const size_t size, size_t node);
+
+/**
+* @brief   Sorts @c k least elements of @c [low, high) to the front of the range.
+*/
+static void partial_sort(const order_t *const order, const size_t low, const size_t high, const size_t k);
+
+/**
+* @brief   Sorts @c [low, high) by insertion.
+*/
+static void insertion_sort(const order_t *const order, const size_t low, const size_t high);
+
+/**
+* @brief   Moves median of first, middle and last elements to @c low.
+*/
+static void median_to_front(const order_t *const order, const size_t low, const size_t high);
+
+/**
+* @brief   Partitions @c [low, high) around element at @c low.
+* @details Both scans stop on equal elements, which keeps ranges balanced on duplicates.
+* @returns Final position of the pivot.
+*/
+static size_t partition(const order_t *const order, const size_t low, const size_t high);
+
+
+/*                             *
+* === API Implementation   === *
+*                             */
+
+void vector_nth_element(vector_t *const vector,
+        const size_t limit,
+        const size_t nth,
+        const compare_t cmp,
+        void *const param)
+{
+    assert(vector);
+    assert(cmp);
+    assert((limit <= vector_capacity(vector)) && "Limit out of bounds!");
+    assert((nth < limit) && "Nth out of limit!");
+
+    const order_t order = {.vector = vector, .cmp = cmp, .param = param};
+    size_t low = 0, high = limit;
+    size_t depth = 2 * (size_t)(63 - __builtin_clzll((unsigned long long) limit));
+
+    while (high - low > INSERTION_THRESHOLD)
+    {
+        if (0 == depth--)
+        {
+            partial_sort(&order, low, high, nth - low + 1);
+            return;
+        }
+
+        median_to_front(&order, low, high);
+        const size_t pivot = partition(&order, low, high);
+
+        if (nth == pivot) return;
+        if (nth < pivot) high = pivot;
+        else low = pivot + 1;
+    }
+
+    insertion_sort(&order, low, high);
+}
+
+
+void vector_partial_sort(vector_t *const vector,
+        const size_t limit,
+        const size_t k,
+        const compare_t cmp,
+        void *const param)
+{
+    assert(vector);
+    assert(cmp);
+    assert((limit <= vector_capacity(vector)) && "Limit out of bounds!");
+    assert((k <= limit) && "K out of limit!");
+
+    const order_t order = {.vector = vector, .cmp = cmp, .param = param};
+    partial_sort(&order, 0, limit, k);
+}
+
+
+vector_status_t topk_init_(topk_t *const topk, const topk_opts_t *const opts)
+{
+    assert(topk);
+    assert(opts && "non-null opts required!");
+    assert(opts->element_size && "'element_size' gt then zero required!");
+    assert(opts->k && "'k' gt then zero required!");
+    assert(opts->cmp && "'cmp' required!");
+
+    *topk = (topk_t) {
+        .heap = heap_create_(&(heap_opts_t) {
+            .alloc_opts = opts->alloc_opts,
+            .element_size = opts->element_size,
+            .cmp = opts->cmp,
+            .param = opts->param,
+            .initial_cap = opts->k,
+            .arity = 2,
+        }),
+        .k = opts->k,
+        .cmp = opts->cmp,
+        .param = opts->param,
+    };
+
+    return topk->heap ? VECTOR_SUCCESS : VECTOR_ALLOC_ERROR;
+}
+
+
+void topk_deinit(topk_t *const topk)
+{
+    assert(topk);
+
+    if (topk->heap) heap_destroy(topk->heap);
+    topk->heap = NULL;
+}
+
+
+size_t topk_size(const topk_t *const topk)
+{
+    assert(topk && topk->heap);
+    return heap_size(topk->heap);
+}
+
+
+const void *topk_threshold(const topk_t *const topk)
+{
+    assert(topk && topk->heap);
+    return heap_top(topk->heap);
+}
+
+
+void topk_push(topk_t *const topk, const void *const value)
+{
+    assert(topk && topk->heap);
+    assert(value);
+
+    if (heap_size(topk->heap) < topk->k)
+    {
+        /* capacity is preallocated, can't fail */
+        heap_status_t status = heap_push(&topk->heap, value);
+        assert(HEAP_SUCCESS == status);
+        (void) status;
+    }
+    else if (topk->cmp(value, heap_top(topk->heap), topk->param) > 0)
+    {
+        heap_replace_top(topk->heap, value, NULL);
+    }
+}
+
+
+int topk_collect(const void *const element, void *const topk)
+{
+    topk_push((topk_t *) topk, element);
+    return 0;
+}
+
+
+size_t topk_extract(topk_t *const topk, void *const out)
+{
+    assert(topk && topk->heap);
+    assert(out);
+
+    /* heap yields weakest first, fill from the back */
+    const size_t element_size = vector_element_size((const vector_t *) topk->heap);
+    const size_t size = heap_size(topk->heap);
+
+    for (size_t i = size; i > 0; --i)
+    {
+        heap_pop(topk->heap, (char *) out + (i - 1) * element_size);
+    }
+
+    return size;
+}
+
+
+/*                        **
+* === Static Functions === *
+*                         */
+
+static bool less(const order_t *const order, const size_t a, const size_t b)
+{
+    return order->cmp(vector_get(order->vector, a), vector_get(order->vector, b), order->param) < 0;
+}
+
+
+static void swap(const order_t *const order, const size_t a, const size_t b)
+{
+    if (a != b) vector_swap(order->vector, a, b);
+}
+
+
+static void sift_down(const order_t *const order, const size_t base, const size_t size, size_t node)
+{
+    for (size_t child = 2 * node + 1; child < size; child = 2 * node + 1)
+    {
+        if (child + 1 < size && less(order, base + child, base + child + 1))
+        {
+            ++child;
+        }
+
+        if (!less(order, base + node, base + child))
+        {
+            return;
+        }
+
+        swap(order, base + node, base + child);
+        node = child;
+    }
+}
+
+
+static void partial_sort(const order_t *const order, const size_t low, const size_t high, const size_t k)
+{
+    if (k < 2)
+    {
+        /* single least element needs no heap */
+        if (k == 1)
+        {
+            size_t least = low;
+            for (size_t i = low + 1; i < high; ++i)
+            {
+                if (less(order, i, least)) least = i;
+            }
+            swap(order, low, least);
+        }
+        return;
+    }
+
+    /* max-heap of k least elements seen so far */
+    for (size_t node = k / 2; node > 0; --node)
+    {
+        sift_down(order, low, k, node - 1);
+    }
+
+    for (size_t i = low + k; i < high; ++i)
+    {
+        if (less(order, i, low))
+        {
+            swap(order, i, low);
+            sift_down(order, low, k, 0);
+        }
+    }
+
+    for (size_t end = k - 1; end > 0; --end)
+    {
+        swap(order, low, low + end);
+        sift_down(order, low, end, 0);
+    }
+}
+
+
+static void insertion_sort(const order_t *const order, const size_t low, const size_t high)
+{
+    for (size_t i = low + 1; i < high; ++i)
+    {
+        for (size_t j = i; j > low && less(order, j, j - 1); --j)
+        {
+            swap(order, j, j - 1);
+        }
+    }
+}
+
+
+static void median_to_front(const order_t *const order, const size_t low, const size_t high)
+{
+    const size_t mid = low + (high - low) / 2;
+    const size_t last = high - 1;
+
+    /* order low+1, mid, last, then pivot is the middle one */
+    swap(order, low + 1, mid);
+    if (less(order, last, low + 1)) swap(order, last, low + 1);
+    if (less(order, last, low)) swap(order, last, low);
+    if (less(order, low, low + 1)) swap(order, low, low + 1);
+}
+
+
+static size_t partition(const order_t *const order, const size_t low, const size_t high)
+{
+    size_t i = low, j = high;
+
+    for (;;)
+    {
+        while (less(order, ++i, low))
+        {
+            if (i == high - 1) break;
+        }
+
+        while (less(order, low, --j))
+        {
+            if (j == low) break;
+        }
+
+        if (i >= j) break;
+        swap(order, i, j);
+    }
+
+    swap(order, low, j);
+    return j;
+}
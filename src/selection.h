@@ -0,0 +1,174 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Public interface of the selection algorithms
+*/
+
+#ifndef _SELECTION_H_
+#define _SELECTION_H_
+
+#include "vector.h"
+#include "heap.h"
+
+/**
+* @brief   Streaming top-k selector.
+* @details Retains @c k greatest elements seen so far in a bounded min-heap,
+*          so the weakest retained element is compared first.
+*          Structure is public, so it can be placed on the stack,
+*          storage is allocated once on initialization.
+*/
+typedef struct topk_t
+{
+    heap_t *heap;      /**< @brief Retained elements, weakest on top. */
+    size_t k;          /**< @brief Amount of elements to retain. */
+    compare_t cmp;     /**< @brief Ordering of elements. */
+    void *param;       /**< @brief User parameter passed to @ref topk_t::cmp "cmp". */
+}
+topk_t;
+
+/**
+* @brief   Top-k selector options.
+* @details Parameters that are passed to a @ref topk_init_ function.
+*/
+typedef struct topk_opts_t
+{
+    alloc_opts_t alloc_opts;  /**< @brief optional allocator */
+    /* required: */
+    size_t element_size;      /**< @brief Size of the stored element type. */
+    size_t k;                 /**< @brief Amount of elements to retain. */
+    compare_t cmp;            /**< @brief Ordering of elements, greatest are retained. */
+
+    /* optional: */
+    void *param;              /**< @brief User parameter passed to @ref topk_opts_t::cmp "cmp". */
+}
+topk_opts_t;
+
+/**
+ * @addtogroup Selection_API Selection API
+ * @brief      Order statistics without sorting whole vector. @{ */
+
+/**
+* @brief   Partially orders vector around its @c nth element.
+* @details Element at @c nth becomes the one that would be there if
+*          the first @c limit elements were sorted ascending according to @c cmp,
+*          no element before it is greater and no element after it is less.
+*          Introselect: quickselect with median of three pivot,
+*          falls back to heap selection when partitioning degrades, O(n) on average.
+*
+* @param[in] vector Pointer to a vector instance.
+* @param[in] limit  Amount of elements to be considered.
+* @param[in] nth    Index of the element to be placed, less than @c limit.
+* @param[in] cmp    Ordering of elements.
+* @param[in] param  User defined parameter, passed to @c cmp.
+*/
+void vector_nth_element(vector_t *const vector,
+        const size_t limit,
+        const size_t nth,
+        const compare_t cmp,
+        void *const param);
+
+
+/**
+* @brief   Sorts @c k least elements to the front of the vector.
+* @details Heap selection followed by heap sort of the selected part,
+*          O(n log k). Order of the rest is unspecified.
+*
+* @param[in] vector Pointer to a vector instance.
+* @param[in] limit  Amount of elements to be considered.
+* @param[in] k      Amount of elements to be sorted, not greater than @c limit.
+* @param[in] cmp    Ordering of elements.
+* @param[in] param  User defined parameter, passed to @c cmp.
+*/
+void vector_partial_sort(vector_t *const vector,
+        const size_t limit,
+        const size_t k,
+        const compare_t cmp,
+        void *const param);
+
+
+/**
+* @brief   Top-k selector initializer.
+* @details Preferable way to invoke initializer.
+* @warning @ref topk_opts_t::element_size "element_size",
+*          @ref topk_opts_t::k "k" and @ref topk_opts_t::cmp "cmp" are mandatory!
+* @see topk_init_
+*/
+#define topk_init(topk, ...) \
+    topk_init_(topk, \
+        &(topk_opts_t) { \
+            __VA_ARGS__ \
+        }\
+    )\
+
+/**
+* @brief   Top-k selector initializer.
+*
+* @param[out] topk Selector to be initialized.
+* @param[in]  opts Options according to which selector will be initialized.
+* @returns         @ref VECTOR_ALLOC_ERROR if storage could not be allocated,
+*                  otherwise @ref VECTOR_SUCCESS.
+*/
+vector_status_t topk_init_(topk_t *const topk, const topk_opts_t *const opts);
+
+
+/**
+* @brief   Releases selector storage.
+*
+* @param[in] topk Pointer to a selector instance.
+*/
+void topk_deinit(topk_t *const topk);
+
+
+/**
+* @brief   Reports amount of retained elements.
+*
+* @param[in] topk Pointer to a selector instance.
+* @returns        Amount of elements, never greater than @ref topk_t::k "k".
+*/
+size_t topk_size(const topk_t *const topk);
+
+
+/**
+* @brief   Access weakest retained element.
+* @details Once selector is full, only greater elements are admitted.
+*
+* @param[in] topk Pointer to a selector instance.
+* @returns        Pointer to the element or @c NULL if nothing retained.
+*/
+const void *topk_threshold(const topk_t *const topk);
+
+
+/**
+* @brief   Offers element to the selector.
+* @details Never allocates, O(log k) when element is admitted, O(1) otherwise.
+*
+* @param[in] topk  Pointer to a selector instance.
+* @param[in] value Value to be copied when admitted.
+*/
+void topk_push(topk_t *const topk, const void *const value);
+
+
+/**
+* @brief   Adapter for @ref vector_foreach and similar traversals.
+* @details Offers @c element to the selector passed as @c param.
+*
+* @param[in] element Offered element.
+* @param[in] topk    Pointer to a selector instance.
+* @returns           Always zero, traversal goes on.
+*/
+int topk_collect(const void *const element, void *const topk);
+
+
+/**
+* @brief   Moves retained elements out, greatest first.
+* @details Selector is empty afterwards and can be reused.
+*
+* @param[in]  topk Pointer to a selector instance.
+* @param[out] out  Location for up to @ref topk_t::k "k" elements.
+* @returns         Amount of elements written.
+*/
+size_t topk_extract(topk_t *const topk, void *const out);
+
+/** @} @noop Selection_API */
+
+#endif/*_SELECTION_H_*/
@@ -0,0 +1,612 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Implementation of the sorted set operations
+*/
+
+#include "setops.h"
+
+#include <assert.h> /** assert */
+#include <stdint.h> /** uint32_t */
+#include <string.h> /** memcpy, memmove */
+
+#if defined(__SSE2__)
+#include <emmintrin.h> /** _mm_cmpeq_epi32, _mm_shuffle_epi32 */
+#endif
+
+/**
+* @brief   Size ratio from which shorter side is galloped for in the longer one.
+*/
+#define GALLOP_RATIO 32
+
+/**
+ * @internal
+ * @brief Loser tree over @c count sources.
+ * @details Node @c 0 holds the overall winner, internal nodes @c [1, count)
+ *          hold losers of their matches, leaves are implied at @c [count, 2 * count).
+ */
+typedef struct loser_tree_t
+{
+    const vector_t *const *sources;
+    const size_t *lengths;
+    size_t count;
+    compare_t cmp;
+    void *param;
+    size_t *position; /**< @brief Current index in each source. */
+    size_t *tree;     /**< @brief @c count nodes. */
+}
+loser_tree_t;
+
+/*                             *
+* === Forward Declarations === *
+*                             */
+
+/**
+* @brief   Makes sure destination can hold @c capacity elements.
+*/
+static vector_status_t reserve(vector_t **const dest, const size_t capacity);
+
+/**
+* @brief   Loads element of a vector buffer, which may be misaligned.
+*/
+static uint32_t load_u32(const char *const data, const size_t index);
+
+/**
+* @brief   Stores element into a vector buffer, which may be misaligned.
+*/
+static void store_u32(char *const data, const size_t index, const uint32_t value);
+
+/**
+* @brief   Runs k-way merge, optionally skipping repeated elements.
+*/
+static vector_status_t merge(vector_t **const dest,
+        size_t *const length,
+        const vector_t *const *const sources,
+        const size_t *const lengths,
+        const size_t count,
+        const compare_t cmp,
+        void *const param,
+        const bool distinct);
+
+/**
+* @brief   Tells whether head of source @c a goes before head of source @c b.
+* @details Exhausted sources go last, ties are broken by source order.
+*/
+static bool tree_less(const loser_tree_t *const lt, const size_t a, const size_t b);
+
+/**
+* @brief   Plays initial matches, @c winners is a scratch of @c 2 * count entries.
+*/
+static void tree_build(loser_tree_t *const lt, size_t *const winners);
+
+/**
+* @brief   Replays matches on the path from leaf @c source to the root.
+*/
+static void tree_replay(loser_tree_t *const lt, const size_t source);
+
+/**
+* @brief   Finds first index in @c [low, length) with element not less than @c value.
+* @details Exponential probe followed by binary search.
+*/
+static size_t gallop(const char *const data,
+        const size_t element_size,
+        size_t low,
+        const size_t length,
+        const void *const value,
+        const compare_t cmp,
+        void *const param);
+
+/**
+* @brief   Filters @c a by membership in @c b, @c out may alias @c a.
+* @details When @c keep is @c true computes intersection, otherwise difference.
+* @returns Amount of elements written to @c out.
+*/
+static size_t filter_pair(char *const out,
+        const char *const a,
+        const size_t a_length,
+        const char *const b,
+        const size_t b_length,
+        const size_t element_size,
+        const compare_t cmp,
+        void *const param,
+        const bool keep);
+
+
+/*                             *
+* === API Implementation   === *
+*                             */
+
+vector_status_t setops_merge(vector_t **const dest,
+        size_t *const length,
+        const vector_t *const *const sources,
+        const size_t *const lengths,
+        const size_t count,
+        const compare_t cmp,
+        void *const param)
+{
+    return merge(dest, length, sources, lengths, count, cmp, param, false);
+}
+
+
+vector_status_t setops_union(vector_t **const dest,
+        size_t *const length,
+        const vector_t *const *const sources,
+        const size_t *const lengths,
+        const size_t count,
+        const compare_t cmp,
+        void *const param)
+{
+    return merge(dest, length, sources, lengths, count, cmp, param, true);
+}
+
+
+vector_status_t setops_intersect(vector_t **const dest,
+        size_t *const length,
+        const vector_t *const *const sources,
+        const size_t *const lengths,
+        const size_t count,
+        const compare_t cmp,
+        void *const param)
+{
+    assert(dest && *dest);
+    assert(length);
+    assert(count && sources && lengths);
+    assert(cmp);
+
+    /* block merge is linear, skewed inputs are left to galloping */
+    if (cmp == cmp_u32_asc && count == 2
+        && lengths[0] <= lengths[1] * GALLOP_RATIO && lengths[1] <= lengths[0] * GALLOP_RATIO)
+    {
+        return setops_intersect_u32(dest, length, sources[0], lengths[0], sources[1], lengths[1]);
+    }
+
+    size_t shortest = 0;
+    for (size_t s = 1; s < count; ++s)
+    {
+        if (lengths[s] < lengths[shortest]) shortest = s;
+    }
+
+    const size_t element_size = vector_element_size(*dest);
+    vector_status_t status = reserve(dest, lengths[shortest]);
+    if (VECTOR_SUCCESS != status)
+    {
+        return status;
+    }
+
+    size_t result = lengths[shortest];
+    if (result)
+    {
+        vector_copy(sources[shortest], vector_data(*dest), 0, result);
+    }
+
+    for (size_t s = 0; s < count && result; ++s)
+    {
+        if (s == shortest) continue;
+
+        assert((vector_element_size(sources[s]) == element_size) && "Element sizes differ!");
+        result = filter_pair(vector_data(*dest), vector_data(*dest), result,
+                vector_data(sources[s]), lengths[s], element_size, cmp, param, true);
+    }
+
+    *length = result;
+    return VECTOR_SUCCESS;
+}
+
+
+vector_status_t setops_difference(vector_t **const dest,
+        size_t *const length,
+        const vector_t *const *const sources,
+        const size_t *const lengths,
+        const size_t count,
+        const compare_t cmp,
+        void *const param)
+{
+    assert(dest && *dest);
+    assert(length);
+    assert(count && sources && lengths);
+    assert(cmp);
+
+    const size_t element_size = vector_element_size(*dest);
+    vector_status_t status = reserve(dest, lengths[0]);
+    if (VECTOR_SUCCESS != status)
+    {
+        return status;
+    }
+
+    size_t result = lengths[0];
+    if (result)
+    {
+        vector_copy(sources[0], vector_data(*dest), 0, result);
+    }
+
+    for (size_t s = 1; s < count && result; ++s)
+    {
+        assert((vector_element_size(sources[s]) == element_size) && "Element sizes differ!");
+        result = filter_pair(vector_data(*dest), vector_data(*dest), result,
+                vector_data(sources[s]), lengths[s], element_size, cmp, param, false);
+    }
+
+    *length = result;
+    return VECTOR_SUCCESS;
+}
+
+
+vector_status_t setops_intersect_u32(vector_t **const dest,
+        size_t *const length,
+        const vector_t *const a,
+        const size_t a_length,
+        const vector_t *const b,
+        const size_t b_length)
+{
+    assert(dest && *dest);
+    assert(length);
+    assert(a && b);
+    assert((vector_element_size(*dest) == sizeof(uint32_t)) && "Vector of uint32_t expected!");
+    assert((vector_element_size(a) == sizeof(uint32_t)) && "Vector of uint32_t expected!");
+    assert((vector_element_size(b) == sizeof(uint32_t)) && "Vector of uint32_t expected!");
+    assert((a_length <= vector_capacity(a)) && (b_length <= vector_capacity(b)));
+
+    vector_status_t status = reserve(dest, a_length < b_length ? a_length : b_length);
+    if (VECTOR_SUCCESS != status)
+    {
+        return status;
+    }
+
+    /* element buffers follow arbitrary allocator regions, elements are accessed with memcpy */
+    const char *x = vector_data(a);
+    const char *y = vector_data(b);
+    char *out = vector_data(*dest);
+    size_t i = 0, j = 0, k = 0;
+
+#if defined(__SSE2__)
+    while (i + 4 <= a_length && j + 4 <= b_length)
+    {
+        /* all-pairs equality of two blocks: compare against every rotation of the other one */
+        const __m128i va = _mm_loadu_si128((const __m128i *) (x + i * sizeof(uint32_t)));
+        const __m128i vb = _mm_loadu_si128((const __m128i *) (y + j * sizeof(uint32_t)));
+        __m128i eq = _mm_cmpeq_epi32(va, vb);
+        eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1))));
+        eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2))));
+        eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3))));
+
+        for (int mask = _mm_movemask_ps(_mm_castsi128_ps(eq)); mask; mask &= mask - 1)
+        {
+            store_u32(out, k++, load_u32(x, i + __builtin_ctz(mask)));
+        }
+
+        const uint32_t a_max = load_u32(x, i + 3);
+        const uint32_t b_max = load_u32(y, j + 3);
+        if (a_max <= b_max) i += 4;
+        if (b_max <= a_max) j += 4;
+    }
+#endif
+
+    while (i < a_length && j < b_length)
+    {
+        const uint32_t x_i = load_u32(x, i);
+        const uint32_t y_j = load_u32(y, j);
+        if (x_i < y_j) ++i;
+        else if (y_j < x_i) ++j;
+        else
+        {
+            store_u32(out, k++, x_i);
+            ++i;
+            ++j;
+        }
+    }
+
+    *length = k;
+    return VECTOR_SUCCESS;
+}
+
+
+/*                        **
+* === Static Functions === *
+*                         */
+
+static vector_status_t reserve(vector_t **const dest, const size_t capacity)
+{
+    if (vector_capacity(*dest) >= capacity)
+    {
+        return VECTOR_SUCCESS;
+    }
+
+    return vector_resize(dest, capacity, VECTOR_ALLOC_ERROR);
+}
+
+
+static uint32_t load_u32(const char *const data, const size_t index)
+{
+    uint32_t value;
+    memcpy(&value, data + index * sizeof(uint32_t), sizeof(uint32_t));
+    return value;
+}
+
+
+static void store_u32(char *const data, const size_t index, const uint32_t value)
+{
+    memcpy(data + index * sizeof(uint32_t), &value, sizeof(uint32_t));
+}
+
+
+static vector_status_t merge(vector_t **const dest,
+        size_t *const length,
+        const vector_t *const *const sources,
+        const size_t *const lengths,
+        const size_t count,
+        const compare_t cmp,
+        void *const param,
+        const bool distinct)
+{
+    assert(dest && *dest);
+    assert(length);
+    assert(count && sources && lengths);
+    assert(cmp);
+
+    const size_t element_size = vector_element_size(*dest);
+    size_t total = 0;
+
+    for (size_t s = 0; s < count; ++s)
+    {
+        assert(sources[s] != *dest && "Destination must not be a source!");
+        assert((vector_element_size(sources[s]) == element_size) && "Element sizes differ!");
+        assert((lengths[s] <= vector_capacity(sources[s])) && "Length out of source bounds!");
+        total += lengths[s];
+    }
+
+    /* position, tree and winners */
+    vector_t *scratch = vector_create_(&(vector_opts_t) {
+        .alloc_opts = vector_alloc_opts(*dest),
+        .element_size = sizeof(size_t),
+        .initial_cap = 4 * count,
+    });
+
+    if (!scratch)
+    {
+        return VECTOR_ALLOC_ERROR;
+    }
+
+    vector_status_t status = reserve(dest, total);
+    if (VECTOR_SUCCESS != status)
+    {
+        vector_destroy(scratch);
+        return status;
+    }
+
+    size_t *nodes = (size_t *) vector_data(scratch);
+    loser_tree_t lt = {
+        .sources = sources,
+        .lengths = lengths,
+        .count = count,
+        .cmp = cmp,
+        .param = param,
+        .position = nodes,
+        .tree = nodes + count,
+    };
+
+    memset(lt.position, 0, count * sizeof(size_t));
+    tree_build(&lt, nodes + 2 * count);
+
+    char *out = vector_data(*dest);
+    size_t result = 0;
+
+    for (size_t n = 0; n < total; ++n)
+    {
+        const size_t winner = lt.tree[0];
+        const char *element = vector_get(sources[winner], lt.position[winner]);
+
+        if (!distinct || !result || 0 != cmp(element, out + (result - 1) * element_size, param))
+        {
+            memcpy(out + result * element_size, element, element_size);
+            ++result;
+        }
+
+        ++lt.position[winner];
+        tree_replay(&lt, winner);
+    }
+
+    vector_destroy(scratch);
+    *length = result;
+    return VECTOR_SUCCESS;
+}
+
+
+static bool tree_less(const loser_tree_t *const lt, const size_t a, const size_t b)
+{
+    const bool a_done = lt->position[a] >= lt->lengths[a];
+    const bool b_done = lt->position[b] >= lt->lengths[b];
+
+    if (a_done || b_done)
+    {
+        return !a_done || (b_done && a < b);
+    }
+
+    const ssize_t order = lt->cmp(vector_get(lt->sources[a], lt->position[a]),
+            vector_get(lt->sources[b], lt->position[b]), lt->param);
+
+    return order < 0 || (0 == order && a < b);
+}
+
+
+static void tree_build(loser_tree_t *const lt, size_t *const winners)
+{
+    const size_t count = lt->count;
+
+    for (size_t s = 0; s < count; ++s)
+    {
+        winners[count + s] = s;
+    }
+
+    for (size_t node = count - 1; node > 0; --node)
+    {
+        const size_t left = winners[2 * node];
+        const size_t right = winners[2 * node + 1];
+
+        if (tree_less(lt, right, left))
+        {
+            winners[node] = right;
+            lt->tree[node] = left;
+        }
+        else
+        {
+            winners[node] = left;
+            lt->tree[node] = right;
+        }
+    }
+
+    lt->tree[0] = winners[1];
+}
+
+
+static void tree_replay(loser_tree_t *const lt, const size_t source)
+{
+    size_t winner = source;
+
+    for (size_t node = (source + lt->count) / 2; node > 0; node /= 2)
+    {
+        if (tree_less(lt, lt->tree[node], winner))
+        {
+            const size_t loser = winner;
+            winner = lt->tree[node];
+            lt->tree[node] = loser;
+        }
+    }
+
+    lt->tree[0] = winner;
+}
+
+
+static size_t gallop(const char *const data,
+        const size_t element_size,
+        size_t low,
+        const size_t length,
+        const void *const value,
+        const compare_t cmp,
+        void *const param)
+{
+    if (low >= length || cmp(value, data + low * element_size, param) <= 0)
+    {
+        return low;
+    }
+
+    /* invariant: element at `low` is less than value */
+    size_t step = 1;
+    size_t high = low + 1;
+
+    while (high < length && cmp(value, data + high * element_size, param) > 0)
+    {
+        low = high;
+        step *= 2;
+        high = low + step;
+    }
+
+    if (high > length) high = length;
+    ++low;
+
+    while (low < high)
+    {
+        const size_t mid = low + (high - low) / 2;
+        if (cmp(value, data + mid * element_size, param) > 0)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    return low;
+}
+
+
+static size_t filter_pair(char *const out,
+        const char *const a,
+        const size_t a_length,
+        const char *const b,
+        const size_t b_length,
+        const size_t element_size,
+        const compare_t cmp,
+        void *const param,
+        const bool keep)
+{
+    size_t written = 0;
+    size_t i = 0, j = 0;
+
+    /* out may alias a, writes never overtake reads */
+#define EMIT(index) \
+    do { \
+        if (written != (index)) \
+            memmove(out + written * element_size, a + (index) * element_size, element_size); \
+        ++written; \
+    } while (0)
+
+    if (b_length > a_length * GALLOP_RATIO)
+    {
+        /* few elements of `a`, probe for each of them in `b` */
+        for (; i < a_length; ++i)
+        {
+            const char *value = a + i * element_size;
+            j = gallop(b, element_size, j, b_length, value, cmp, param);
+            const bool found = j < b_length && 0 == cmp(value, b + j * element_size, param);
+            if (found == keep) EMIT(i);
+        }
+    }
+    else if (a_length > b_length * GALLOP_RATIO)
+    {
+        /* few elements of `b`, skip runs of `a` between them */
+        for (; j < b_length; ++j)
+        {
+            const char *value = b + j * element_size;
+            const size_t next = gallop(a, element_size, i, a_length, value, cmp, param);
+
+            if (!keep)
+            {
+                for (; i < next; ++i) EMIT(i);
+            }
+
+            i = next;
+            if (i < a_length && 0 == cmp(a + i * element_size, value, param))
+            {
+                if (keep) EMIT(i);
+                ++i;
+            }
+        }
+
+        if (!keep)
+        {
+            for (; i < a_length; ++i) EMIT(i);
+        }
+    }
+    else
+    {
+        while (i < a_length && j < b_length)
+        {
+            const ssize_t order = cmp(a + i * element_size, b + j * element_size, param);
+            if (order < 0)
+            {
+                if (!keep) EMIT(i);
+                ++i;
+            }
+            else if (order > 0)
+            {
+                ++j;
+            }
+            else
+            {
+                if (keep) EMIT(i);
+                ++i;
+                ++j;
+            }
+        }
+
+        if (!keep)
+        {
+            for (; i < a_length; ++i) EMIT(i);
+        }
+    }
+
+#undef EMIT
+
+    return written;
+}
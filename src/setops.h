@@ -0,0 +1,118 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Public interface of the sorted set operations
+*/
+
+#ifndef _SETOPS_H_
+#define _SETOPS_H_
+
+#include "vector.h"
+
+/**
+ * @addtogroup Setops_API Sorted Set Operations API
+ * @brief      Merge, union, intersection and difference of sorted vectors.
+ * @details    Sources are vectors sorted ascending according to @c cmp,
+ *             each one is accompanied by a length of its sorted prefix.
+ *             Result is written from the beginning of the @c dest vector,
+ *             which is grown with @ref vector_resize when too small,
+ *             its length is reported through the @c length out-parameter.
+ *             Destination must not be one of the sources.
+ *             Set operations expect sources without duplicates,
+ *             equal elements are taken from the earliest source.
+ *             Functions return @ref VECTOR_SUCCESS or @ref VECTOR_ALLOC_ERROR,
+ *             in the latter case @c dest is left intact. @{ */
+
+/**
+* @brief   Merges @c count sorted vectors into one sorted vector.
+* @details K-way merge driven by a loser tree, O(n log k) comparisons.
+*          Duplicates are preserved, merge is stable in order of sources.
+*
+* @param[in]  dest    Reference to destination vector pointer.
+* @param[out] length  Amount of elements written to @c dest.
+* @param[in]  sources Array of @c count source vectors.
+* @param[in]  lengths Array of @c count source lengths.
+* @param[in]  count   Amount of sources.
+* @param[in]  cmp     Ordering of the elements.
+* @param[in]  param   User defined parameter, passed to @c cmp.
+* @returns            Status of the operation.
+*/
+vector_status_t setops_merge(vector_t **const dest,
+        size_t *const length,
+        const vector_t *const *const sources,
+        const size_t *const lengths,
+        const size_t count,
+        const compare_t cmp,
+        void *const param);
+
+
+/**
+* @brief   Builds union of @c count sorted sets.
+* @details Same as @ref setops_merge, equal elements are emitted once.
+* @see setops_merge
+*/
+vector_status_t setops_union(vector_t **const dest,
+        size_t *const length,
+        const vector_t *const *const sources,
+        const size_t *const lengths,
+        const size_t count,
+        const compare_t cmp,
+        void *const param);
+
+
+/**
+* @brief   Builds intersection of @c count sorted sets.
+* @details Starts with the shortest source and narrows it by the rest in place.
+*          Linear merge is used for comparable sizes, for skewed sizes
+*          elements of the shorter side are galloped for in the longer one.
+*          Two sources of comparable sizes ordered by @ref cmp_u32_asc
+*          are handed to @ref setops_intersect_u32.
+* @see setops_merge
+*/
+vector_status_t setops_intersect(vector_t **const dest,
+        size_t *const length,
+        const vector_t *const *const sources,
+        const size_t *const lengths,
+        const size_t count,
+        const compare_t cmp,
+        void *const param);
+
+
+/**
+* @brief   Builds difference of the first sorted set and the rest of them.
+* @details Same strategy as @ref setops_intersect, elements
+*          of the first source found in any other one are dropped.
+* @see setops_merge
+*/
+vector_status_t setops_difference(vector_t **const dest,
+        size_t *const length,
+        const vector_t *const *const sources,
+        const size_t *const lengths,
+        const size_t count,
+        const compare_t cmp,
+        void *const param);
+
+
+/**
+* @brief   Builds intersection of two sorted sets of @c uint32_t.
+* @details Elements are native unsigned 32-bit integers ordered by @ref cmp_u32_asc.
+*          Compares blocks of four keys against each other with SSE2 when available.
+*
+* @param[in]  dest     Reference to destination vector pointer.
+* @param[out] length   Amount of elements written to @c dest.
+* @param[in]  a        First source vector.
+* @param[in]  a_length Length of the first source.
+* @param[in]  b        Second source vector.
+* @param[in]  b_length Length of the second source.
+* @returns             Status of the operation.
+*/
+vector_status_t setops_intersect_u32(vector_t **const dest,
+        size_t *const length,
+        const vector_t *const a,
+        const size_t a_length,
+        const vector_t *const b,
+        const size_t b_length);
+
+/** @} @noop Setops_API */
+
+#endif/*_SETOPS_H_*/
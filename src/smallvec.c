@@ -0,0 +1,35 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Implementation of the small vector
+*/
+
+#include "smallvec.h"
+
+#include <assert.h> /** assert */
+
+
+/*                             *
+* === API Implementation   === *
+*                             */
+
+vector_t *smallvec_create_(const smallvec_opts_t *const opts)
+{
+    assert(opts && "non-null opts required!");
+    assert(opts->element_size && "'element_size' gt then zero required!");
+    assert(opts->storage && "non-null 'storage' required!");
+
+    vector_t *vector = vector_create_inline_(opts->storage, opts->storage_size, &(vector_opts_t) {
+        .alloc_opts = opts->alloc_opts,
+        .ext_header_size = opts->ext_header_size,
+        .element_size = opts->element_size,
+    });
+
+    if (opts->initial_cap > vector_capacity(vector)
+            && VECTOR_SUCCESS != vector_resize(&vector, opts->initial_cap, VECTOR_ALLOC_ERROR))
+    {
+        return NULL;
+    }
+
+    return vector;
+}
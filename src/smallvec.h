@@ -0,0 +1,90 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Public interface of the small vector
+* @details Small vector is a plain @ref vector_t placed into inline storage,
+*          which may live on the stack or inside of a parent struct.
+*          Elements stay there until the vector is resized beyond it,
+*          then the whole vector spills onto the heap.
+*          Existing @c vector_* call sites, including @ref vector_resize
+*          and @ref vector_destroy, work unchanged.
+* @see vector_create_inline_
+*/
+
+#ifndef _SMALLVEC_H_
+#define _SMALLVEC_H_
+
+#include "vector.h"
+
+/**
+* @brief   Small vector options.
+* @details Parameters that are passed to a @ref smallvec_create_ function.
+*/
+typedef struct smallvec_opts_t
+{
+    alloc_opts_t alloc_opts;  /**< @brief optional allocator, used once vector spills */
+    size_t ext_header_size;   /**< @brief @copybrief vector_t::ext_header_size */
+    /* required: */
+    size_t element_size;      /**< @brief Size of the stored element type. */
+    void *storage;            /**< @brief Inline storage, aligned for @c max_align_t. */
+    size_t storage_size;      /**< @brief Size of inline storage in bytes. @see SMALLVEC_STORAGE_SIZE */
+
+    /* optional: */
+    size_t initial_cap;       /**< @brief Initial capacity, spills immediately if beyond inline storage. */
+}
+smallvec_opts_t;
+
+/**
+* @brief   Size of inline storage holding @c count elements.
+* @details Allocator and extension header sizes must be added when present.
+*/
+#define SMALLVEC_STORAGE_SIZE(element_size, count) VECTOR_INLINE_SIZE(element_size, count)
+
+/**
+* @brief   Declares small vector along with its inline storage in the current scope.
+*
+* @param name  Name of the @ref vector_t pointer variable.
+* @param type  Element type.
+* @param count Amount of inline elements.
+*/
+#define smallvec_declare(name, type, count) \
+    _Alignas(max_align_t) char name##_storage[SMALLVEC_STORAGE_SIZE(sizeof(type), count)]; \
+    vector_t *name = smallvec_create( \
+        .element_size = sizeof(type), \
+        .storage = name##_storage, \
+        .storage_size = sizeof(name##_storage) \
+    )
+
+/**
+ * @addtogroup Smallvec_API Small Vector API
+ * @brief      Small vector methods. @{ */
+
+/**
+* @brief   Small vector constructor.
+* @details Preferable way to invoke constructor.
+*          Capacity defaults to whatever fits into inline storage.
+* @warning @ref smallvec_opts_t::element_size "element_size",
+*          @ref smallvec_opts_t::storage "storage" and
+*          @ref smallvec_opts_t::storage_size "storage_size" are mandatory!
+* @see smallvec_create_
+*/
+#define smallvec_create(...) \
+    smallvec_create_( \
+        &(smallvec_opts_t) { \
+            __VA_ARGS__ \
+        }\
+    )\
+
+/**
+* @brief   Small vector constructor.
+* @details Release with @ref vector_destroy, which frees memory only if vector has spilled.
+*
+* @param[in] opts Options according to which small vector will be created.
+* @returns        Vector placed into inline storage, spilled vector if @c initial_cap
+*                 is beyond inline storage, or @c NULL if that spill failed.
+*/
+vector_t *smallvec_create_(const smallvec_opts_t *const opts);
+
+/** @} @noop Smallvec_API */
+
+#endif/*_SMALLVEC_H_*/
@@ -0,0 +1,440 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Implementation of the sparse vector
+*/
+
+#include "sparsevec.h"
+
+#include <assert.h> /** assert */
+#include <string.h> /** memcmp, memcpy, memmove */
+
+#if defined(__AVX2__)
+#include <immintrin.h> /** _mm256_i64gather_pd, _mm256_i64gather_ps */
+#endif
+
+/**
+ * @internal
+ * @brief Sparse vector state stored in value vector's extension header,
+ *        followed by the shared zero element.
+ */
+typedef struct sparsevec_header_t
+{
+    vector_t *indices; /**< @brief Ascending positions of non-zero entries. */
+    size_t nonzero;    /**< @brief Amount of non-zero entries. */
+    size_t length;     /**< @brief Logical (dense) amount of elements. */
+}
+sparsevec_header_t;
+
+/*                             *
+* === Forward Declarations === *
+*                             */
+
+/**
+* @brief   Access sparse vector state.
+*/
+static sparsevec_header_t *get_sparsevec_header(const sparsevec_t *const sparsevec);
+
+/**
+* @brief   Access shared zero element.
+*/
+static const void *get_zero(const sparsevec_t *const sparsevec);
+
+/**
+* @brief   Tells whether all bytes of an element are zero.
+*/
+static bool is_zero(const sparsevec_t *const sparsevec, const void *const value);
+
+/**
+* @brief   Finds first entry with position not less than @c index.
+*/
+static size_t lower_bound(const sparsevec_header_t *const header, const size_t index);
+
+/**
+* @brief   Allocates sparse vector for @c capacity non-zero entries.
+*/
+static sparsevec_t *create(const alloc_opts_t alloc_opts,
+        const size_t element_size,
+        const size_t length,
+        const size_t capacity);
+
+
+/*                             *
+* === API Implementation   === *
+*                             */
+
+sparsevec_t *sparsevec_create_(const sparsevec_opts_t *const opts)
+{
+    assert(opts && "non-null opts required!");
+    assert(opts->element_size && "'element_size' gt then zero required!");
+
+    return create(opts->alloc_opts, opts->element_size, opts->length, opts->initial_cap);
+}
+
+
+sparsevec_t *sparsevec_from_dense(const vector_t *const dense, const size_t length)
+{
+    assert(dense);
+    assert((length <= vector_capacity(dense)) && "Length out of dense vector bounds!");
+
+    const size_t element_size = vector_element_size(dense);
+    const char *data = vector_data(dense);
+    size_t nonzero = 0;
+
+    for (size_t i = 0; i < length; ++i)
+    {
+        const char *element = data + i * element_size;
+        /* zero iff first byte is zero and every byte equals its successor */
+        nonzero += (element[0] || memcmp(element, element + 1, element_size - 1));
+    }
+
+    sparsevec_t *sparsevec = create(vector_alloc_opts(dense), element_size, length, nonzero);
+    if (!sparsevec)
+    {
+        return NULL;
+    }
+
+    sparsevec_header_t *header = get_sparsevec_header(sparsevec);
+    size_t *indices = (size_t *) vector_data(header->indices);
+    char *values = vector_data((vector_t *) sparsevec);
+
+    for (size_t i = 0; i < length; ++i)
+    {
+        const char *element = data + i * element_size;
+        if (!is_zero(sparsevec, element))
+        {
+            indices[header->nonzero] = i;
+            memcpy(values + header->nonzero * element_size, element, element_size);
+            ++header->nonzero;
+        }
+    }
+
+    return sparsevec;
+}
+
+
+void sparsevec_to_dense(const sparsevec_t *const sparsevec, vector_t *const dense)
+{
+    assert(sparsevec);
+    assert(dense);
+
+    const sparsevec_header_t *header = get_sparsevec_header(sparsevec);
+    const size_t element_size = vector_element_size((const vector_t *) sparsevec);
+    assert((vector_element_size(dense) == element_size) && "Element sizes differ!");
+    assert((header->length <= vector_capacity(dense)) && "Dense vector is too small!");
+
+    if (header->length)
+    {
+        vector_zero_range(dense, 0, header->length);
+    }
+
+    const size_t *indices = (const size_t *) vector_data(header->indices);
+    const char *values = vector_data((const vector_t *) sparsevec);
+    char *data = vector_data(dense);
+
+    for (size_t k = 0; k < header->nonzero; ++k)
+    {
+        memcpy(data + indices[k] * element_size, values + k * element_size, element_size);
+    }
+}
+
+
+void sparsevec_destroy(sparsevec_t *const sparsevec)
+{
+    assert(sparsevec);
+
+    sparsevec_header_t *header = get_sparsevec_header(sparsevec);
+    if (header->indices) vector_destroy(header->indices);
+    vector_destroy((vector_t *) sparsevec);
+}
+
+
+size_t sparsevec_length(const sparsevec_t *const sparsevec)
+{
+    assert(sparsevec);
+    return get_sparsevec_header(sparsevec)->length;
+}
+
+
+size_t sparsevec_nonzero(const sparsevec_t *const sparsevec)
+{
+    assert(sparsevec);
+    return get_sparsevec_header(sparsevec)->nonzero;
+}
+
+
+const size_t *sparsevec_indices(const sparsevec_t *const sparsevec)
+{
+    assert(sparsevec);
+    return (const size_t *) vector_data(get_sparsevec_header(sparsevec)->indices);
+}
+
+
+const void *sparsevec_get(const sparsevec_t *const sparsevec, const size_t index)
+{
+    assert(sparsevec);
+
+    const sparsevec_header_t *header = get_sparsevec_header(sparsevec);
+    assert((index < header->length) && "Index out of bounds!");
+
+    const size_t k = lower_bound(header, index);
+    if (k < header->nonzero && sparsevec_indices(sparsevec)[k] == index)
+    {
+        return vector_get((const vector_t *) sparsevec, k);
+    }
+
+    return get_zero(sparsevec);
+}
+
+
+sparsevec_status_t sparsevec_set(sparsevec_t **const sparsevec, const size_t index, const void *const value)
+{
+    assert(sparsevec && *sparsevec);
+    assert(value);
+
+    vector_t *values = (vector_t *) *sparsevec;
+    sparsevec_header_t *header = vector_get_ext_header(values);
+    assert((index < header->length) && "Index out of bounds!");
+
+    const size_t k = lower_bound(header, index);
+    const bool present = k < header->nonzero && ((size_t *) vector_data(header->indices))[k] == index;
+
+    if (is_zero(*sparsevec, value))
+    {
+        if (present)
+        {
+            const size_t tail = header->nonzero - k - 1;
+            if (tail)
+            {
+                vector_shift(values, k + 1, tail, -1);
+                vector_shift(header->indices, k + 1, tail, -1);
+            }
+            --header->nonzero;
+        }
+        return SPARSEVEC_SUCCESS;
+    }
+
+    if (present)
+    {
+        vector_set(values, k, value);
+        return SPARSEVEC_SUCCESS;
+    }
+
+    if (header->nonzero == vector_capacity(values))
+    {
+        const size_t capacity = header->nonzero ? header->nonzero * 2 : 1;
+
+        /* indices first, values vector owns the header and may move */
+        if (vector_capacity(header->indices) < capacity
+            && VECTOR_SUCCESS != vector_resize(&header->indices, capacity, VECTOR_ALLOC_ERROR))
+        {
+            return SPARSEVEC_ALLOC_ERROR;
+        }
+
+        if (VECTOR_SUCCESS != vector_resize(&values, capacity, VECTOR_ALLOC_ERROR))
+        {
+            return SPARSEVEC_ALLOC_ERROR;
+        }
+
+        *sparsevec = (sparsevec_t *) values;
+        header = vector_get_ext_header(values);
+    }
+
+    const size_t tail = header->nonzero - k;
+    if (tail)
+    {
+        vector_shift(values, k, tail, 1);
+        vector_shift(header->indices, k, tail, 1);
+    }
+
+    vector_set(values, k, value);
+    vector_set(header->indices, k, &index);
+    ++header->nonzero;
+    return SPARSEVEC_SUCCESS;
+}
+
+
+int sparsevec_foreach(const sparsevec_t *const sparsevec, const foreach_t func, void *const param)
+{
+    assert(sparsevec);
+    assert(func);
+
+    const size_t nonzero = sparsevec_nonzero(sparsevec);
+    return nonzero ? vector_foreach((const vector_t *) sparsevec, nonzero, func, param) : 0;
+}
+
+
+int sparsevec_aggregate(const sparsevec_t *const sparsevec,
+        const aggregate_t func,
+        void *const acc,
+        void *const param)
+{
+    assert(sparsevec);
+    assert(func);
+
+    const size_t nonzero = sparsevec_nonzero(sparsevec);
+    return nonzero ? vector_aggregate((const vector_t *) sparsevec, nonzero, func, acc, param) : 0;
+}
+
+
+float sparsevec_dot_float(const sparsevec_t *const sparsevec, const vector_t *const dense)
+{
+    assert(sparsevec);
+    assert(dense);
+    assert((vector_element_size((const vector_t *) sparsevec) == sizeof(float)) && "Sparse vector of float expected!");
+    assert((vector_element_size(dense) == sizeof(float)) && "Dense vector of float expected!");
+    assert((sparsevec_length(sparsevec) <= vector_capacity(dense)) && "Dense vector is too small!");
+
+    const size_t nonzero = sparsevec_nonzero(sparsevec);
+    const size_t *indices = sparsevec_indices(sparsevec);
+    /* element buffers follow arbitrary allocator regions, elements are loaded with memcpy */
+    const char *values = vector_data((const vector_t *) sparsevec);
+    const char *data = vector_data(dense);
+    size_t k = 0;
+    float sum = 0.0f;
+
+#if defined(__AVX2__)
+    __m128 acc = _mm_setzero_ps();
+    for (; k + 4 <= nonzero; k += 4)
+    {
+        const __m256i index = _mm256_loadu_si256((const __m256i *) (indices + k));
+        const __m128 gathered = _mm256_i64gather_ps((const float *) data, index, sizeof(float));
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps((const float *) (values + k * sizeof(float))), gathered));
+    }
+
+    float lanes[4];
+    _mm_storeu_ps(lanes, acc);
+    sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#endif
+
+    for (; k < nonzero; ++k)
+    {
+        float value, element;
+        memcpy(&value, values + k * sizeof(float), sizeof(float));
+        memcpy(&element, data + indices[k] * sizeof(float), sizeof(float));
+        sum += value * element;
+    }
+    return sum;
+}
+
+
+double sparsevec_dot_double(const sparsevec_t *const sparsevec, const vector_t *const dense)
+{
+    assert(sparsevec);
+    assert(dense);
+    assert((vector_element_size((const vector_t *) sparsevec) == sizeof(double)) && "Sparse vector of double expected!");
+    assert((vector_element_size(dense) == sizeof(double)) && "Dense vector of double expected!");
+    assert((sparsevec_length(sparsevec) <= vector_capacity(dense)) && "Dense vector is too small!");
+
+    const size_t nonzero = sparsevec_nonzero(sparsevec);
+    const size_t *indices = sparsevec_indices(sparsevec);
+    /* element buffers follow arbitrary allocator regions, elements are loaded with memcpy */
+    const char *values = vector_data((const vector_t *) sparsevec);
+    const char *data = vector_data(dense);
+    size_t k = 0;
+    double sum = 0.0;
+
+#if defined(__AVX2__)
+    __m256d acc = _mm256_setzero_pd();
+    for (; k + 4 <= nonzero; k += 4)
+    {
+        const __m256i index = _mm256_loadu_si256((const __m256i *) (indices + k));
+        const __m256d gathered = _mm256_i64gather_pd((const double *) data, index, sizeof(double));
+        acc = _mm256_add_pd(acc, _mm256_mul_pd(_mm256_loadu_pd((const double *) (values + k * sizeof(double))), gathered));
+    }
+
+    double lanes[4];
+    _mm256_storeu_pd(lanes, acc);
+    sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#endif
+
+    for (; k < nonzero; ++k)
+    {
+        double value, element;
+        memcpy(&value, values + k * sizeof(double), sizeof(double));
+        memcpy(&element, data + indices[k] * sizeof(double), sizeof(double));
+        sum += value * element;
+    }
+    return sum;
+}
+
+
+/*                        **
+* === Static Functions === *
+*                         */
+
+static sparsevec_header_t *get_sparsevec_header(const sparsevec_t *const sparsevec)
+{
+    return (sparsevec_header_t *) vector_get_ext_header((const vector_t *) sparsevec);
+}
+
+
+static const void *get_zero(const sparsevec_t *const sparsevec)
+{
+    return (const char *) vector_get_ext_header((const vector_t *) sparsevec)
+        + calc_aligned_size(sizeof(sparsevec_header_t), sizeof(max_align_t));
+}
+
+
+static bool is_zero(const sparsevec_t *const sparsevec, const void *const value)
+{
+    return 0 == memcmp(value, get_zero(sparsevec), vector_element_size((const vector_t *) sparsevec));
+}
+
+
+static size_t lower_bound(const sparsevec_header_t *const header, const size_t index)
+{
+    const size_t *indices = (const size_t *) vector_data(header->indices);
+    size_t low = 0, high = header->nonzero;
+
+    while (low < high)
+    {
+        const size_t mid = low + (high - low) / 2;
+        if (indices[mid] < index)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+
+static sparsevec_t *create(const alloc_opts_t alloc_opts,
+        const size_t element_size,
+        const size_t length,
+        const size_t capacity)
+{
+    vector_t *values = vector_create_(&(vector_opts_t) {
+        .alloc_opts = alloc_opts,
+        .ext_header_size = calc_aligned_size(sizeof(sparsevec_header_t), sizeof(max_align_t)) + element_size,
+        .element_size = element_size,
+        .initial_cap = capacity,
+    });
+
+    if (!values)
+    {
+        return NULL;
+    }
+
+    sparsevec_header_t *header = vector_get_ext_header(values);
+    *header = (sparsevec_header_t) {.length = length};
+    memset((char *) header + calc_aligned_size(sizeof(sparsevec_header_t), sizeof(max_align_t)), 0, element_size);
+
+    header->indices = vector_create_(&(vector_opts_t) {
+        .alloc_opts = vector_alloc_opts(values),
+        .element_size = sizeof(size_t),
+        .initial_cap = capacity,
+    });
+
+    if (!header->indices)
+    {
+        vector_destroy(values);
+        return NULL;
+    }
+
+    return (sparsevec_t *) values;
+}
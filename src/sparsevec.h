@@ -0,0 +1,204 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Public interface of the sparse vector
+*/
+
+#ifndef _SPARSEVEC_H_
+#define _SPARSEVEC_H_
+
+#include "vector.h"
+
+/**
+* @brief   Sparse vector for mostly zero data.
+* @details Only non-zero elements are stored, their values are elements of a @ref vector_t,
+*          their ascending positions are kept in a separate index @ref vector_t.
+*          Element is zero when all of its bytes are zero.
+*          Absent elements read as a shared zero element.
+*          Functions that can grow the vector take a double pointer.
+*/
+typedef struct sparsevec_t sparsevec_t;
+
+/**
+* @brief   Sparse vector options.
+* @details Parameters that are passed to a @ref sparsevec_create_ function.
+*/
+typedef struct sparsevec_opts_t
+{
+    alloc_opts_t alloc_opts;  /**< @brief optional allocator */
+    /* required: */
+    size_t element_size;      /**< @brief Size of the stored element type. */
+    size_t length;            /**< @brief Logical (dense) amount of elements. */
+
+    /* optional: */
+    size_t initial_cap;       /**< @brief Preallocated non-zero entries. */
+}
+sparsevec_opts_t;
+
+/**
+* @brief   Status of sparse vector operations that may fail.
+* @details Extends @ref vector_status_t.
+*/
+typedef enum sparsevec_status_t
+{
+    SPARSEVEC_SUCCESS = VECTOR_SUCCESS,         /**< Success operation status code. */
+    SPARSEVEC_ALLOC_ERROR = VECTOR_ALLOC_ERROR, /**< Allocation error status code. */
+    SPARSEVEC_STATUS_LAST = VECTOR_STATUS_LAST  /**< Indicates end of the enum values. */
+}
+sparsevec_status_t;
+
+/**
+* Represents sparse vector default create values.
+*/
+#define SPARSEVEC_DEFAULT_ARGS \
+    .initial_cap = 16
+
+/**
+ * @addtogroup Sparsevec_API Sparse Vector API
+ * @brief      Sparse vector methods. @{ */
+
+/**
+* @brief   Sparse vector constructor.
+* @details Preferable way to invoke constructor.
+*          Provides default values.
+* @warning @ref sparsevec_opts_t::element_size "element_size" is mandatory!
+* @see sparsevec_create_
+*/
+#define sparsevec_create(...) \
+    sparsevec_create_( \
+        &(sparsevec_opts_t) { \
+            SPARSEVEC_DEFAULT_ARGS,\
+            __VA_ARGS__ \
+        }\
+    )\
+
+/**
+* @brief   Sparse vector constructor.
+*
+* @param[in] opts Options according to which vector will be created.
+* @returns        Fresh new vector with all elements zero or @c NULL if allocation failed.
+*/
+sparsevec_t *sparsevec_create_(const sparsevec_opts_t *const opts);
+
+
+/**
+* @brief   Converts dense vector into a sparse one.
+* @details Non-zero elements are counted first, storage is allocated once.
+*
+* @param[in] dense  Source vector, its allocator is used.
+* @param[in] length Amount of leading elements to be converted.
+* @returns          Sparse vector or @c NULL if allocation failed.
+*/
+sparsevec_t *sparsevec_from_dense(const vector_t *const dense, const size_t length);
+
+
+/**
+* @brief   Expands sparse vector into a dense one.
+* @details Zero fills leading @ref sparsevec_length elements of @c dense,
+*          then scatters non-zero entries.
+*
+* @param[in]  sparsevec Pointer to a sparse vector instance.
+* @param[out] dense     Vector of the same element size with enough capacity.
+*/
+void sparsevec_to_dense(const sparsevec_t *const sparsevec, vector_t *const dense);
+
+
+/**
+* @brief   Deallocates sparse vector.
+*
+* @param[in] sparsevec Vector that will be deallocated.
+*/
+void sparsevec_destroy(sparsevec_t *const sparsevec);
+
+
+/**
+* @brief   Reports logical amount of elements.
+*
+* @param[in] sparsevec Pointer to a sparse vector instance.
+* @returns             Dense length.
+*/
+size_t sparsevec_length(const sparsevec_t *const sparsevec);
+
+
+/**
+* @brief   Reports amount of stored non-zero elements.
+*
+* @param[in] sparsevec Pointer to a sparse vector instance.
+* @returns             Amount of non-zero entries.
+*/
+size_t sparsevec_nonzero(const sparsevec_t *const sparsevec);
+
+
+/**
+* @brief   Access ascending positions of non-zero entries.
+*
+* @param[in] sparsevec Pointer to a sparse vector instance.
+* @returns             Array of @ref sparsevec_nonzero positions, parallel to values.
+*/
+const size_t *sparsevec_indices(const sparsevec_t *const sparsevec);
+
+
+/**
+* @brief   Returns element at @c index.
+*
+* @param[in] sparsevec Pointer to a sparse vector instance.
+* @param[in] index     Dense position.
+* @returns             Pointer to stored value or to the shared zero element.
+*/
+const void *sparsevec_get(const sparsevec_t *const sparsevec, const size_t index);
+
+
+/**
+* @brief   Sets element at @c index.
+* @details Zero value removes the entry, non-zero value inserts or overwrites it.
+*          Insertion and removal shift following entries.
+*
+* @param[in] sparsevec Reference to sparse vector pointer.
+* @param[in] index     Dense position.
+* @param[in] value     Value to be stored.
+* @returns             Operation status.
+*/
+sparsevec_status_t sparsevec_set(sparsevec_t **const sparsevec, const size_t index, const void *const value);
+
+
+/**
+* @brief   Perform immutable action on each non-zero element.
+* @see vector_foreach
+*/
+int sparsevec_foreach(const sparsevec_t *const sparsevec, const foreach_t func, void *const param);
+
+
+/**
+* @brief   Perform immutable accamulating action on each non-zero element.
+* @see vector_aggregate
+*/
+int sparsevec_aggregate(const sparsevec_t *const sparsevec,
+        const aggregate_t func,
+        void *const acc,
+        void *const param);
+
+
+/**
+* @brief   Dot product with a dense vector of @c float.
+* @details Dense elements are gathered with AVX2 where available.
+*
+* @param[in] sparsevec Sparse vector of @c float.
+* @param[in] dense     Dense vector of @c float, at least @ref sparsevec_length elements.
+* @returns             Sum of products.
+*/
+float sparsevec_dot_float(const sparsevec_t *const sparsevec, const vector_t *const dense);
+
+
+/**
+* @brief   Dot product with a dense vector of @c double.
+* @details Dense elements are gathered with AVX2 where available.
+*
+* @param[in] sparsevec Sparse vector of @c double.
+* @param[in] dense     Dense vector of @c double, at least @ref sparsevec_length elements.
+* @returns             Sum of products.
+*/
+double sparsevec_dot_double(const sparsevec_t *const sparsevec, const vector_t *const dense);
+
+/** @} @noop Sparsevec_API */
+
+#endif/*_SPARSEVEC_H_*/
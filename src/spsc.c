@@ -0,0 +1,210 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Implementation of the single-producer/single-consumer queue
+*/
+
+#include "spsc.h"
+
+#include <assert.h>    /** assert */
+#include <stdatomic.h> /** atomic_size_t, atomic_load_explicit, atomic_store_explicit */
+#include <string.h>    /** memcpy */
+
+/**
+ * @internal
+ * @brief Assumed cache line size, used to separate producer and consumer state.
+ */
+#define CACHE_LINE 64
+
+/**
+ * @internal
+ * @brief Queue state stored in vector's extension header.
+ * @details Counters grow monotonically and are masked on access.
+ *          Consumer and producer state occupy separate cache lines,
+ *          trailing padding keeps producer state off the first element's line.
+ */
+typedef struct spsc_header_t
+{
+    atomic_size_t head;  /**< @brief Next element to pop, written by consumer. */
+    size_t cached_tail;  /**< @brief Consumer's copy of @ref spsc_header_t::tail. */
+    char consumer_pad[CACHE_LINE - sizeof(atomic_size_t) - sizeof(size_t)];
+
+    atomic_size_t tail;  /**< @brief Next slot to push, written by producer. */
+    size_t cached_head;  /**< @brief Producer's copy of @ref spsc_header_t::head. */
+    char producer_pad[CACHE_LINE - sizeof(atomic_size_t) - sizeof(size_t)];
+}
+spsc_header_t;
+
+/*                             *
+* === Forward Declarations === *
+*                             */
+
+/**
+* @brief   Access queue state.
+*/
+static spsc_header_t *get_spsc_header(const spsc_t *const queue);
+
+/**
+* @brief   Copies @c count elements into ring slots starting at counter @c pos.
+*/
+static void copy_in(vector_t *const vector, const size_t pos, const char *const src, const size_t count);
+
+/**
+* @brief   Copies @c count elements from ring slots starting at counter @c pos.
+*/
+static void copy_out(const vector_t *const vector, const size_t pos, char *const dest, const size_t count);
+
+
+/*                             *
+* === API Implementation   === *
+*                             */
+
+spsc_t *spsc_create_(const spsc_opts_t *const opts)
+{
+    assert(opts && "non-null opts required!");
+    assert(opts->capacity && "non-zero capacity required!");
+
+    size_t capacity = 1;
+    while (capacity < opts->capacity) capacity <<= 1;
+
+    vector_t *vector = vector_create_(&(vector_opts_t) {
+        .alloc_opts = opts->alloc_opts,
+        .ext_header_size = sizeof(spsc_header_t),
+        .element_size = opts->element_size,
+        .initial_cap = capacity,
+    });
+
+    if (!vector)
+    {
+        return NULL;
+    }
+
+    spsc_header_t *header = vector_get_ext_header(vector);
+    atomic_init(&header->head, 0);
+    atomic_init(&header->tail, 0);
+    header->cached_head = 0;
+    header->cached_tail = 0;
+
+    return (spsc_t *) vector;
+}
+
+
+void spsc_destroy(spsc_t *const queue)
+{
+    assert(queue);
+    vector_destroy((vector_t *) queue);
+}
+
+
+size_t spsc_capacity(const spsc_t *const queue)
+{
+    assert(queue);
+    return vector_capacity((const vector_t *) queue);
+}
+
+
+size_t spsc_size(const spsc_t *const queue)
+{
+    assert(queue);
+    spsc_header_t *header = get_spsc_header(queue);
+    const size_t head = atomic_load_explicit(&header->head, memory_order_acquire);
+    const size_t tail = atomic_load_explicit(&header->tail, memory_order_acquire);
+    return tail - head;
+}
+
+
+bool spsc_try_push(spsc_t *const queue, const void *const value)
+{
+    return 1 == spsc_publish(queue, value, 1);
+}
+
+
+bool spsc_try_pop(spsc_t *const queue, void *const out)
+{
+    return 1 == spsc_consume(queue, out, 1);
+}
+
+
+size_t spsc_publish(spsc_t *const queue, const void *const values, const size_t count)
+{
+    assert(queue);
+    assert(values || !count);
+
+    vector_t *vector = (vector_t *) queue;
+    spsc_header_t *header = get_spsc_header(queue);
+    const size_t capacity = vector_capacity(vector);
+    const size_t tail = atomic_load_explicit(&header->tail, memory_order_relaxed);
+
+    size_t free_slots = capacity - (tail - header->cached_head);
+    if (free_slots < count)
+    {
+        header->cached_head = atomic_load_explicit(&header->head, memory_order_acquire);
+        free_slots = capacity - (tail - header->cached_head);
+    }
+
+    const size_t amount = (count < free_slots) ? count : free_slots;
+    if (0 == amount) return 0;
+
+    copy_in(vector, tail, values, amount);
+    atomic_store_explicit(&header->tail, tail + amount, memory_order_release);
+    return amount;
+}
+
+
+size_t spsc_consume(spsc_t *const queue, void *const out, const size_t count)
+{
+    assert(queue);
+    assert(out || !count);
+
+    vector_t *vector = (vector_t *) queue;
+    spsc_header_t *header = get_spsc_header(queue);
+    const size_t head = atomic_load_explicit(&header->head, memory_order_relaxed);
+
+    size_t available = header->cached_tail - head;
+    if (available < count)
+    {
+        header->cached_tail = atomic_load_explicit(&header->tail, memory_order_acquire);
+        available = header->cached_tail - head;
+    }
+
+    const size_t amount = (count < available) ? count : available;
+    if (0 == amount) return 0;
+
+    copy_out(vector, head, out, amount);
+    atomic_store_explicit(&header->head, head + amount, memory_order_release);
+    return amount;
+}
+
+
+/*                        **
+* === Static Functions === *
+*                         */
+
+static spsc_header_t *get_spsc_header(const spsc_t *const queue)
+{
+    return (spsc_header_t *) vector_get_ext_header((const vector_t *) queue);
+}
+
+
+static void copy_in(vector_t *const vector, const size_t pos, const char *const src, const size_t count)
+{
+    const size_t capacity = vector_capacity(vector);
+    const size_t element_size = vector_element_size(vector);
+    const size_t index = pos & (capacity - 1);
+    const size_t first = (count < capacity - index) ? count : capacity - index;
+
+    memcpy(vector_data(vector) + index * element_size, src, first * element_size);
+    memcpy(vector_data(vector), src + first * element_size, (count - first) * element_size);
+}
+
+
+static void copy_out(const vector_t *const vector, const size_t pos, char *const dest, const size_t count)
+{
+    const size_t capacity = vector_capacity(vector);
+    const size_t element_size = vector_element_size(vector);
+    const size_t index = pos & (capacity - 1);
+    const size_t first = (count < capacity - index) ? count : capacity - index;
+
+    memcpy(dest, vector_data(vector) + index * element_size, first * element_size);
+    memcpy(dest + first * element_size, vector_data(vector), (count - first) * element_size);
+}
@@ -0,0 +1,148 @@
+/**
+* @file
+* @author Evgeni Semenov
+* @brief Public interface of the single-producer/single-consumer queue
+*/
+
+#ifndef _SPSC_H_
+#define _SPSC_H_
+
+#include "vector.h"
+
+/**
+* @brief   Lock-free single-producer/single-consumer bounded queue.
+* @details Elements are stored in contiguous buffer of a @ref vector_t
+*          with power of two capacity. Head and tail counters live
+*          in the extension header on separate cache lines,
+*          each side also caches the opposite counter to avoid
+*          touching the shared line on every operation.
+*          Exactly one thread may push and exactly one thread may pop concurrently.
+*/
+typedef struct spsc_t spsc_t;
+
+/**
+* @brief   Queue options.
+* @details Parameters that are passed to a @ref spsc_create_ function.
+*/
+typedef struct spsc_opts_t
+{
+    alloc_opts_t alloc_opts;  /**< @brief optional allocator */
+    /* required: */
+    size_t element_size;      /**< @brief Size of the record type. */
+
+    /* optional: */
+    size_t capacity;          /**< @brief Fixed capacity, rounded up to a power of two. */
+}
+spsc_opts_t;
+
+/**
+* Represents queue default create values.
+*/
+#define SPSC_DEFAULT_ARGS \
+    .capacity = 1024
+
+/**
+ * @addtogroup SPSC_API SPSC Queue API
+ * @brief      Single-producer/single-consumer queue methods. @{ */
+
+/**
+* @brief   Queue constructor.
+* @details Preferable way to invoke queue constructor.
+*          Provides default values.
+* @warning @ref spsc_opts_t::element_size "element_size" is mandatory!
+* @see spsc_create_
+*/
+#define spsc_create(...) \
+    spsc_create_( \
+        &(spsc_opts_t) { \
+            SPSC_DEFAULT_ARGS,\
+            __VA_ARGS__ \
+        }\
+    )\
+
+/**
+* @brief   Queue constructor.
+* @warning Not thread safe, publish queue to other threads after creation.
+*
+* @param[in] opts Options according to which queue will be created.
+* @returns        Fresh new empty queue or @c NULL if allocation failed.
+*/
+spsc_t *spsc_create_(const spsc_opts_t *const opts);
+
+
+/**
+* @brief   Deallocates queue.
+* @warning Both producer and consumer must be done with the queue.
+*
+* @param[in] queue Queue pointer that will be deallocated.
+*/
+void spsc_destroy(spsc_t *const queue);
+
+
+/**
+* @brief   Reports fixed capacity of the queue.
+*
+* @param[in] queue Pointer to a queue instance.
+* @returns         Capacity, always a power of two.
+*/
+size_t spsc_capacity(const spsc_t *const queue);
+
+
+/**
+* @brief   Reports amount of stored elements.
+* @details Value is a snapshot and may be outdated when called concurrently.
+*
+* @param[in] queue Pointer to a queue instance.
+* @returns         Amount of elements in the queue.
+*/
+size_t spsc_size(const spsc_t *const queue);
+
+
+/**
+* @brief   Pushes single element, producer side.
+*
+* @param[in] queue Pointer to a queue instance.
+* @param[in] value Value to be copied.
+* @returns         @c false if queue is full.
+*/
+bool spsc_try_push(spsc_t *const queue, const void *const value);
+
+
+/**
+* @brief   Pops single element, consumer side.
+*
+* @param[in]  queue Pointer to a queue instance.
+* @param[out] out   Location for popped value.
+* @returns          @c false if queue is empty.
+*/
+bool spsc_try_pop(spsc_t *const queue, void *const out);
+
+
+/**
+* @brief   Publishes up to @c count elements at once, producer side.
+* @details Copies as many elements as fit with at most two copies
+*          and makes them visible to consumer with a single release store.
+*
+* @param[in] queue  Pointer to a queue instance.
+* @param[in] values Contiguous array of @c count elements.
+* @param[in] count  Amount of elements to be published.
+* @returns          Amount of elements published.
+*/
+size_t spsc_publish(spsc_t *const queue, const void *const values, const size_t count);
+
+
+/**
+* @brief   Consumes up to @c count elements at once, consumer side.
+* @details Copies available elements with at most two copies
+*          and releases their slots to producer with a single release store.
+*
+* @param[in]  queue Pointer to a queue instance.
+* @param[out] out   Destination array for @c count elements.
+* @param[in]  count Maximal amount of elements to be consumed.
+* @returns          Amount of elements consumed.
+*/
+size_t spsc_consume(spsc_t *const queue, void *const out, const size_t count);
+
+/** @} @noop SPSC_API */
+
+#endif/*_SPSC_H_*/
@@ -8,10 +8,63 @@
 #include "memswap.h"
 
 #include <assert.h> /** assert */
+#include <limits.h> /** CHAR_BIT */
+#include <stdint.h> /** uintptr_t */
 #include <stdio.h>  /** fprintf */
 #include <stdlib.h> /** malloc, realloc, free */
 #include <string.h> /** memcpy, memset */
 
+#if defined(__SSE2__)
+#include <emmintrin.h> /** _mm_stream_si128, _mm_sfence */
+#endif
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h> /** _mm_shuffle_epi8 */
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h> /** _mm256_cmpeq_epi8, _mm256_movemask_epi8 */
+#endif
+
+#if defined(__linux__)
+#include <sys/mman.h> /** madvise */
+#include <unistd.h>   /** sysconf */
+#endif
+
+/**
+ * @internal
+ * @brief Alignment required by non-temporal stores.
+ */
+#define STREAM_ALIGNMENT 16
+
+/**
+ * @internal
+ * @brief Minimal size of the pattern block replicated by streaming fill.
+ */
+#define STREAM_PATTERN_SIZE 1024
+
+/**
+ * @internal
+ * @brief Multiplication constants of the hash function.
+ */
+#define HASH_P0 0xa0761d6478bd642full
+#define HASH_P1 0xe7037ed1a0b428dbull
+#define HASH_P2 0x8ebc6af09c88c6e3ull
+#define HASH_P3 0x589965cc75374cc3ull
+
+/**
+ * @internal
+ * @brief Bit of @ref vector_t::allocator_size "allocator_size" marking a vector placed into caller provided storage.
+ * @details Allocator sizes never come close to it, so user allocator data cannot fake it.
+ */
+#define INLINE_FLAG ((size_t) 1 << (sizeof(size_t) * CHAR_BIT - 1))
+
+/**
+ * @internal
+ * @brief Capacity outputs of run-length encoding grow to first.
+ */
+#define RUN_LENGTH_MIN_CAP 16
+
 /**
  * @internal
  * @brief Assert for allocation size overflow detection.
@@ -20,12 +73,23 @@
 #define ASSERT_OVERFLOW(element_size, capacity, data_size, alloc_size, message) \
     assert((data_size / element_size == capacity && alloc_size > data_size) && message);
 
+/**
+ * @internal
+ * @brief Applies @c X to every comparator specialized for a fixed key size.
+ */
+#define SPECIALIZED_COMPARATORS(X) \
+    X(cmp_lex4_asc) X(cmp_lex4_dsc) X(cmp_lex8_asc) X(cmp_lex8_dsc) \
+    X(cmp_lex16_asc) X(cmp_lex16_dsc) X(cmp_lex32_asc) X(cmp_lex32_dsc) \
+    X(cmp_u32_asc) X(cmp_u32_dsc) X(cmp_u64_asc) X(cmp_u64_dsc) \
+    X(cmp_i32_asc) X(cmp_i32_dsc) X(cmp_i64_asc) X(cmp_i64_dsc) \
+    X(cmp_float_asc) X(cmp_float_dsc) X(cmp_double_asc) X(cmp_double_dsc)
+
 struct vector_t
 {
     size_t element_size;   /**< @brief Size of the underling element type. */
     size_t capacity;       /**< @brief Current amount of allocated elements. */
     size_t ext_header_size;/**< @brief Size of the extention header. */
-    size_t allocator_size; /**< @brief Size of the allocator. */
+    size_t allocator_size; /**< @brief Size of the allocator region, may carry @ref INLINE_FLAG. */
     char memory[];
     /**< @brief Beginning of the vector's memory region.
     *    @details Must be offsetted by @ref vector_t::ext_header_size
@@ -33,6 +97,22 @@ struct vector_t
     */
 };
 
+/**
+ * @internal
+ * @brief Record at the end of allocator region of a vector placed into caller provided storage.
+ * @details Present only while @ref INLINE_FLAG is set, copies made by clone or spill
+ *          leave it behind and are ordinary heap vectors.
+ */
+typedef struct inline_record_t
+{
+    size_t storage_size; /**< @brief Size of the caller provided storage. */
+    size_t user_size;    /**< @brief Size of the user allocator data preceding the record. */
+}
+inline_record_t;
+
+_Static_assert(sizeof(vector_t) == VECTOR_CONTROL_SIZE, "VECTOR_CONTROL_SIZE is out of sync!");
+_Static_assert(sizeof(inline_record_t) == VECTOR_INLINE_RECORD_SIZE, "VECTOR_INLINE_RECORD_SIZE is out of sync!");
+
 /*                             *
 * === Forward Declarations === *
 *                             */
@@ -50,6 +130,41 @@ static size_t calculate_alloc_size (const size_t element_size,
 */
 static void *get_allocator(const vector_t *const vector);
 
+/**
+* @brief   Size of allocator region of the vector, inline record included.
+*/
+static size_t get_allocator_size(const vector_t *const vector);
+
+/**
+* @brief   Reads inline record of the vector.
+* @warning Vector must be inline.
+*/
+static void get_inline_record(const vector_t *const vector, inline_record_t *const record);
+
+/**
+* @brief   Writes inline record at the end of allocator region.
+*/
+static void set_inline_record(vector_t *const vector, const inline_record_t *const record);
+
+/**
+* @brief   Copies inline vector onto the heap without its inline record.
+* @returns Heap vector of @c capacity elements or @c NULL if allocation failed.
+*/
+static vector_t *copy_out(const vector_t *const vector, const size_t capacity);
+
+/**
+* @brief   Resizes vector that lives in caller provided storage, spilling it onto the heap if needed.
+*/
+static vector_status_t resize_inline(vector_t **const vector,
+        const size_t capacity,
+        const vector_status_t error,
+        const bool zeroed);
+
+/**
+* @brief   Frees vector memory unless it belongs to caller provided storage.
+*/
+static void release(vector_t *const vector);
+
 /**
 * @brief   Performs binary search on a vectors range.
 *
@@ -64,6 +179,7 @@ static void *binary_find (const vector_t *const vector,
 
 /**
 * @brief Performs binary search on a vectors range.
+* @details Specialized comparators are detected and called directly.
 *
 * @returns index of the found element on success or -1 otherwise.
 */
@@ -74,6 +190,110 @@ static ssize_t binary_find_index (const vector_t *const vector,
         const compare_t cmp,
         void *param);
 
+/**
+* @brief   Fills memory region with repeated pattern of @c element_size bytes.
+* @details Pattern is expected to be already stored at the beginning of the region.
+*/
+static void fill_pattern(char *const dest,
+        const size_t element_size,
+        const size_t size);
+
+/**
+* @brief   Fills memory region with a @c value broadcasted into a vector register.
+* @details Specialized for element sizes that evenly divide a register (1, 2, 4, 8 and 16 bytes).
+* @returns @c false if element size is not supported, region is left untouched then.
+*/
+static bool fill_broadcast(char *dest,
+        const void *const value,
+        const size_t element_size,
+        size_t size);
+
+/**
+* @brief   Copies memory region using non-temporal stores for the aligned part.
+* @details Falls back to @c memcpy when streaming stores are not available.
+*/
+static void stream_copy(char *dest, const char *src, size_t size);
+
+/**
+* @brief   Zeroes memory region using non-temporal stores for the aligned part.
+* @details Falls back to @c memset when streaming stores are not available.
+*/
+static void stream_zero(char *dest, size_t size);
+
+/**
+* @brief   Makes streaming stores globally visible.
+*/
+static void stream_fence(void);
+
+/**
+* @brief   Compacts plain 4 byte elements that differ from @c key.
+* @returns Amount of elements kept.
+*/
+static size_t remove_key32(char *const data, const size_t limit, const uint32_t key);
+
+/**
+* @brief   Reads fixed-width key of @c key_size bytes.
+*/
+static uint64_t load_key(const char *const src, const size_t key_size);
+
+/**
+* @brief   Multiplies two words into 128 bits and folds halves together.
+*/
+static uint64_t hash_mix(uint64_t a, uint64_t b);
+
+/**
+* @brief   Folds next chunk digest into the accumulator.
+*/
+static uint64_t hash_fold_step(const uint64_t acc, const uint64_t digest);
+
+/**
+* @brief   Finds first differing byte of two regions.
+* @returns Offset of the byte or @c size if regions are equal.
+*/
+static size_t mismatch(const char *const a, const char *const b, const size_t size);
+
+/**
+* @brief   Reads 4 byte big-endian word.
+*/
+static uint32_t load_be32(const void *const src);
+
+/**
+* @brief   Reads 8 byte big-endian word.
+*/
+static uint64_t load_be64(const void *const src);
+
+/**
+* @brief   Lexicographical three-way comparison of @c words 8 byte words.
+*/
+static ssize_t lex_words(const char *const a, const char *const b, const size_t words);
+
+/**
+* @brief   Tells how many leading bytes decide equality under @c cmp.
+* @returns Key size when equality is bytewise and can be checked without calling back,
+*          otherwise zero.
+*/
+static size_t bytewise_size(const compare_t cmp, void *const param);
+
+/**
+* @brief   Finds end of the run of elements equal to the one at @c start.
+* @returns Index of the first element that differs or @c limit.
+*/
+static size_t run_end(const vector_t *const vector,
+        size_t start,
+        const size_t limit,
+        const compare_t cmp,
+        void *const param,
+        const size_t key_size);
+
+/**
+* @brief   Tells whether two elements compare equal.
+*/
+static bool equal_elements(const char *const a,
+        const char *const b,
+        const compare_t cmp,
+        void *const param,
+        const size_t key_size);
+
 
 /*                             *
 * === API Implementation   === *
@@ -83,13 +303,16 @@ vector_t *vector_create_(const vector_opts_t *const opts)
 {
     assert(opts && "non-null opts required!");
     assert(opts->element_size && "'element_size' gt then zero required!");
+    assert(!(opts->alloc_opts.size & INLINE_FLAG) && "Allocator is too large!");
 
     const size_t alloc_size = calculate_alloc_size(opts->element_size,
             opts->initial_cap,
             opts->alloc_opts.size,
             opts->ext_header_size);
 
-    vector_t *vector = (vector_t *) vector_alloc(alloc_size, opts->alloc_opts.data);
+    vector_t *vector = (vector_t *) (opts->zero_init
+        ? vector_calloc(alloc_size, opts->alloc_opts.data)
+        : vector_alloc(alloc_size, opts->alloc_opts.data));
     if (!vector)
     {
         return NULL;
@@ -109,10 +332,55 @@ vector_t *vector_create_(const vector_opts_t *const opts)
 }
 
 
+vector_t *vector_create_inline_(void *const storage, const size_t storage_size, const vector_opts_t *const opts)
+{
+    assert(storage);
+    assert(opts && "non-null opts required!");
+    assert(opts->element_size && "'element_size' gt then zero required!");
+    assert(!(opts->alloc_opts.size & INLINE_FLAG) && "Allocator is too large!");
+
+    const size_t allocator_size = opts->alloc_opts.size + sizeof(inline_record_t);
+    const size_t headers_size = calculate_alloc_size(opts->element_size, 0, allocator_size, opts->ext_header_size);
+    assert((headers_size <= storage_size) && "Storage is too small for vector headers!");
+
+    vector_t *vector = storage;
+    (*vector) = (vector_t) {
+        .element_size = opts->element_size,
+        .capacity = (storage_size - headers_size) / opts->element_size,
+        .ext_header_size = opts->ext_header_size,
+        .allocator_size = allocator_size | INLINE_FLAG,
+    };
+
+    if (opts->alloc_opts.size)
+    {
+        memcpy(get_allocator(vector), opts->alloc_opts.data, opts->alloc_opts.size);
+    }
+
+    set_inline_record(vector, &(inline_record_t) {
+        .storage_size = storage_size,
+        .user_size = opts->alloc_opts.size,
+    });
+
+    if (opts->zero_init)
+    {
+        memset(vector_data(vector), 0x00, vector->capacity * vector->element_size);
+    }
+
+    return vector;
+}
+
+
+bool vector_is_inline(const vector_t *const vector)
+{
+    assert(vector);
+    return vector->allocator_size & INLINE_FLAG;
+}
+
+
 void vector_destroy(vector_t *const vector)
 {
     assert(vector);
-    vector_free(vector, vector->memory);
+    release(vector);
 }
 
 
@@ -120,6 +388,11 @@ vector_t *vector_clone(const vector_t *const vector)
 {
     assert(vector);
 
+    if (vector_is_inline(vector))
+    {
+        return copy_out(vector, vector->capacity);
+    }
+
     const size_t alloc_size = calculate_alloc_size(vector->element_size,
             vector->capacity,
             vector->allocator_size,
@@ -142,6 +415,11 @@ vector_status_t vector_resize(vector_t **const vector, const size_t capacity, co
 {
     assert(vector && *vector);
 
+    if (vector_is_inline(*vector))
+    {
+        return resize_inline(vector, capacity, error, false);
+    }
+
     const size_t alloc_size = calculate_alloc_size((*vector)->element_size, 
             capacity,
             (*vector)->allocator_size,
@@ -159,11 +437,47 @@ vector_status_t vector_resize(vector_t **const vector, const size_t capacity, co
 }
 
 
+vector_status_t vector_resize_zeroed(vector_t **const vector, const size_t capacity, const vector_status_t error)
+{
+    assert(vector && *vector);
+
+    if (vector_is_inline(*vector))
+    {
+        return resize_inline(vector, capacity, error, true);
+    }
+
+    if (capacity <= (*vector)->capacity)
+    {
+        return vector_resize(vector, capacity, error);
+    }
+
+    const size_t old_size = calculate_alloc_size((*vector)->element_size,
+            (*vector)->capacity,
+            (*vector)->allocator_size,
+            (*vector)->ext_header_size);
+
+    const size_t alloc_size = calculate_alloc_size((*vector)->element_size,
+            capacity,
+            (*vector)->allocator_size,
+            (*vector)->ext_header_size);
+
+    vector_t *vec = (vector_t*) vector_realloc_zeroed(*vector, old_size, alloc_size, get_allocator(*vector));
+    if (!vec)
+    {
+        return error;
+    }
+
+    vec->capacity = capacity;
+    *vector = vec;
+    return VECTOR_SUCCESS;
+}
+
+
 void* vector_get_ext_header(const vector_t *const vector)
 {
     assert(vector);
     assert((vector->ext_header_size != 0) && "trying to access extended header that wasn't alloc'd");
-    return (void*)vector->memory + vector->allocator_size;
+    return (void*)vector->memory + get_allocator_size(vector);
 }
 
 
@@ -177,16 +491,26 @@ size_t vector_ext_header_size(const vector_t *const vector)
 size_t vector_data_offset(const vector_t *const vector)
 {
     assert(vector);
-    return vector->ext_header_size + vector->allocator_size;
+    return vector->ext_header_size + get_allocator_size(vector);
 }
 
 
 alloc_opts_t vector_alloc_opts(const vector_t *const vector)
 {
     assert(vector);
+
+    /* inline record is not a part of user allocator data */
+    size_t size = vector->allocator_size;
+    if (vector_is_inline(vector))
+    {
+        inline_record_t record;
+        get_inline_record(vector, &record);
+        size = record.user_size;
+    }
+
     return (alloc_opts_t) {
-        .size = vector->allocator_size,
-        .data = vector->allocator_size ? get_allocator(vector) : NULL,
+        .size = size,
+        .data = size ? get_allocator(vector) : NULL,
     };
 }
 
@@ -355,110 +679,841 @@ void vector_spread(vector_t *const vector, const size_t index, const size_t amou
 }
 
 
-void vector_shift(vector_t *const vector, const size_t offset, const size_t length, const ssize_t shift)
+void vector_fill_range(vector_t *const vector, const size_t offset, const size_t length, const void *const value)
 {
     assert(vector);
-    assert(shift != 0);
-    assert((offset < vector->capacity) && "Offset out of bounds.");
-    assert(((ssize_t)offset + shift >= 0) && "Shifted range underflows allocated buffer");
-    assert((offset + shift + length <= vector->capacity) && "Shifted range exceedes capacity");
+    assert(value);
+    assert((offset + length <= vector->capacity) && "`offset + length` exceeds vector's capacity!");
 
-    vector_move(vector, vector_get(vector, offset + shift), offset, length);
-}
+    if (0 == length) return;
 
+    char *dest = vector_data(vector) + offset * vector->element_size;
+    const size_t size = length * vector->element_size;
 
-void vector_swap(vector_t *const vector, const size_t index_a, const size_t index_b)
-{
-    assert(vector);
-    assert(index_a != index_b);
-    assert(index_a < vector->capacity && index_b < vector->capacity);
+    if (fill_broadcast(dest, value, vector->element_size, size))
+    {
+        return;
+    }
 
-    void *a = vector_get(vector, index_a);
-    void *b = vector_get(vector, index_b);
-    memswap(a, b, vector->element_size);
+    memmove(dest, value, vector->element_size);
+    fill_pattern(dest, vector->element_size, size);
 }
 
 
-int vector_foreach(const vector_t *const vector, const size_t limit, const foreach_t func, void *const param)
+void vector_zero_range(vector_t *const vector, const size_t offset, const size_t length)
 {
     assert(vector);
-    assert(limit && limit <= vector->capacity);
-    assert(func);
+    assert((offset + length <= vector->capacity) && "`offset + length` exceeds vector's capacity!");
 
-    for (size_t i = 0; i < limit; ++i)
+    char *dest = vector_data(vector) + offset * vector->element_size;
+    const size_t size = length * vector->element_size;
+
+    if (size < VECTOR_STREAM_THRESHOLD)
     {
-        int status = func(vector_get(vector, i), param);
-        if (status) return status;
+        memset(dest, 0x00, size);
+        return;
     }
 
-    return 0;
+    stream_zero(dest, size);
+    stream_fence();
 }
 
 
-int vector_aggregate(const vector_t *const vector, const size_t limit, const aggregate_t func, void *const acc, void *const param)
+void vector_zero_range_lazy(vector_t *const vector, const size_t offset, const size_t length)
 {
     assert(vector);
-    assert(limit && limit <= vector->capacity);
-    assert(func);
+    assert((offset + length <= vector->capacity) && "`offset + length` exceeds vector's capacity!");
 
-    for (size_t i = 0; i < limit; ++i)
+#if defined(__linux__)
+    char *dest = vector_data(vector) + offset * vector->element_size;
+    const size_t size = length * vector->element_size;
+    const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+
+    const size_t head = (page_size - (uintptr_t)dest % page_size) % page_size;
+    if (size >= VECTOR_STREAM_THRESHOLD && size >= head + page_size)
     {
-        int status = func(vector_get(vector, i), acc, param);
-        if (status) return status;
+        const size_t pages = (size - head) / page_size * page_size;
+        if (0 == madvise(dest + head, pages, MADV_DONTNEED))
+        {
+            memset(dest, 0x00, head);
+            memset(dest + head + pages, 0x00, size - head - pages);
+            return;
+        }
     }
-
-    return 0;
+#endif
+    vector_zero_range(vector, offset, length);
 }
 
 
-int vector_transform(vector_t *const vector, const size_t limit, const transform_t func, void *const param)
+void vector_stream_copy(const vector_t *const vector, char *const dest, const size_t offset, const size_t length)
 {
+    assert(dest);
     assert(vector);
-    assert(limit && limit <= vector->capacity);
-    assert(func);
+    assert((offset + length <= vector->capacity) && "`offset + length` exceeds vector's capacity!");
 
-    return vector_foreach(vector, limit, (foreach_t)func, param);
-}
+    const char *src = vector_data(vector) + offset * vector->element_size;
+    const size_t size = length * vector->element_size;
 
+    if (size < VECTOR_STREAM_THRESHOLD)
+    {
+        memcpy(dest, src, size);
+        return;
+    }
 
-void * __attribute__((weak)) vector_alloc(const size_t alloc_size, void *const param)
-{
-    (void)param;
-    return malloc(alloc_size);
+    stream_copy(dest, src, size);
+    stream_fence();
 }
 
 
-void * __attribute__((weak)) vector_realloc(void *ptr, const size_t alloc_size, void *const param)
+void vector_shift(vector_t *const vector, const size_t offset, const size_t length, const ssize_t shift)
 {
-    (void)param;
-    return realloc(ptr, alloc_size);
+    assert(vector);
+    assert(shift != 0);
+    assert((offset < vector->capacity) && "Offset out of bounds.");
+    assert(((ssize_t)offset + shift >= 0) && "Shifted range underflows allocated buffer");
+    assert((offset + shift + length <= vector->capacity) && "Shifted range exceedes capacity");
+
+    vector_move(vector, vector_get(vector, offset + shift), offset, length);
 }
 
 
-void __attribute__((weak)) vector_free(void *ptr, void *const param)
+void vector_insert_batch(vector_t *const vector,
+        const size_t length,
+        const size_t *const indices,
+        const void *const values,
+        const size_t count)
 {
-    (void)param;
-    free(ptr);
-}
+    assert(vector);
+    assert(!count || (indices && values));
+    assert((length + count <= vector->capacity) && "`length + count` exceeds vector's capacity!");
 
+    const size_t element_size = vector->element_size;
+    char *data = vector_data(vector);
+    const char *value = (const char *)values + count * element_size;
+    size_t src_end = length;
+    size_t dest_end = length + count;
 
-size_t calc_aligned_size(const size_t size, const size_t alignment)
-{
-    return (size + alignment - 1) / alignment * alignment;
+    /* move tail segments from the back, each element moves once */
+    for (size_t i = count; i-- > 0;)
+    {
+        assert((indices[i] <= src_end) && "Indices must be sorted and within length!");
+        const size_t segment = src_end - indices[i];
+        dest_end -= segment;
+        memmove(data + dest_end * element_size, data + indices[i] * element_size, segment * element_size);
+        src_end = indices[i];
+
+        value -= element_size;
+        --dest_end;
+        memcpy(data + dest_end * element_size, value, element_size);
+    }
 }
 
 
-ssize_t cmp_lex_asc(const void *value, const void *element, void *param)
+vector_status_t vector_resize_insert_batch(vector_t **const vector,
+        const size_t capacity,
+        const size_t length,
+        const size_t *const indices,
+        const void *const values,
+        const size_t count,
+        const vector_status_t error)
 {
-    return memcmp(value, element, (size_t)param);
+    assert(vector && *vector);
+    assert(!count || (indices && values));
+    assert((length + count <= capacity) && "`length + count` exceeds requested capacity!");
+    assert((length <= (*vector)->capacity) && "Length out of capacity bounds!");
+
+    /* grow through realloc, so allocator state lives in exactly one place,
+     * then scatter backward in place, each element moves once */
+    if (capacity > (*vector)->capacity)
+    {
+        const vector_status_t status = vector_resize(vector, capacity, error);
+        if (VECTOR_SUCCESS != status)
+        {
+            return status;
+        }
+    }
+
+    vector_insert_batch(*vector, length, indices, values, count);
+    return VECTOR_SUCCESS;
+}
+
+
+size_t vector_erase_batch(vector_t *const vector,
+        const size_t length,
+        const size_t *const indices,
+        const size_t count)
+{
+    assert(vector);
+    assert(!count || indices);
+    assert((length <= vector->capacity) && "Length out of capacity bounds!");
+    assert((count <= length) && "Erasing more elements than occupied!");
+
+    if (0 == count) return length;
+
+    const size_t element_size = vector->element_size;
+    char *data = vector_data(vector);
+    size_t dest = indices[0];
+
+    /* compact segments between erased elements, each element moves once */
+    for (size_t i = 0; i < count; ++i)
+    {
+        const size_t begin = indices[i] + 1;
+        const size_t end = (i + 1 < count) ? indices[i + 1] : length;
+        assert((begin <= end) && "Indices must be strictly increasing and within length!");
+
+        memmove(data + dest * element_size, data + begin * element_size, (end - begin) * element_size);
+        dest += end - begin;
+    }
+
+    return length - count;
+}
+
+
+size_t vector_remove_if(vector_t *const vector,
+        const size_t limit,
+        const predicate_t predicate,
+        void *const param)
+{
+    assert(vector);
+    assert(predicate);
+    assert((limit <= vector->capacity) && "Limit out of capacity bounds!");
+
+    const size_t element_size = vector->element_size;
+    char *data = vector_data(vector);
+    size_t dest = 0;
+    size_t begin = 0;
+    bool keeping = false;
+
+    /* predicate is evaluated once per element, kept runs are moved at once */
+    for (size_t i = 0; i < limit; ++i)
+    {
+        const bool keep = !predicate(data + i * element_size, param);
+
+        if (keep && !keeping)
+        {
+            begin = i;
+        }
+        else if (!keep && keeping)
+        {
+            if (dest != begin)
+            {
+                memmove(data + dest * element_size, data + begin * element_size, (i - begin) * element_size);
+            }
+            dest += i - begin;
+        }
+
+        keeping = keep;
+    }
+
+    if (keeping)
+    {
+        if (dest != begin)
+        {
+            memmove(data + dest * element_size, data + begin * element_size, (limit - begin) * element_size);
+        }
+        dest += limit - begin;
+    }
+
+    return dest;
+}
+
+
+size_t vector_remove_key(vector_t *const vector,
+        const size_t limit,
+        const size_t key_offset,
+        const size_t key_size,
+        const void *const key)
+{
+    assert(vector);
+    assert(key);
+    assert((limit <= vector->capacity) && "Limit out of capacity bounds!");
+    assert((key_size == 1 || key_size == 2 || key_size == 4 || key_size == 8) && "Unsupported key size!");
+    assert((key_offset + key_size <= vector->element_size) && "Key exceeds element bounds!");
+
+    const size_t element_size = vector->element_size;
+    char *data = vector_data(vector);
+    const uint64_t value = load_key(key, key_size);
+
+    if (4 == element_size && 4 == key_size)
+    {
+        return remove_key32(data, limit, (uint32_t)value);
+    }
+
+    /* branch free: copy every element, advance only past kept ones */
+    size_t dest = 0;
+    for (size_t i = 0; i < limit; ++i)
+    {
+        const char *src = data + i * element_size;
+        memmove(data + dest * element_size, src, element_size);
+        dest += (load_key(src + key_offset, key_size) != value);
+    }
+
+    return dest;
+}
+
+
+size_t vector_unique(vector_t *const vector,
+        const size_t limit,
+        const compare_t cmp,
+        void *const param)
+{
+    assert(vector);
+    assert(cmp);
+    assert((limit <= vector->capacity) && "Limit out of capacity bounds!");
+
+    if (limit < 2)
+    {
+        return limit;
+    }
+
+    const size_t element_size = vector->element_size;
+    const size_t key_size = bytewise_size(cmp, param);
+    char *data = vector_data(vector);
+
+    /* branch free: store every element, advance only past the first of a run,
+     * data may be misaligned for the word type, so words are moved with memcpy */
+#define UNIQUE_WORDS(type) \
+    do { \
+        type prev, cur; \
+        memcpy(&prev, data, sizeof(type)); \
+        size_t dest = 1; \
+        for (size_t i = 1; i < limit; ++i) \
+        { \
+            memcpy(&cur, data + i * sizeof(type), sizeof(type)); \
+            memcpy(data + dest * sizeof(type), &cur, sizeof(type)); \
+            dest += (cur != prev); \
+            prev = cur; \
+        } \
+        return dest; \
+    } while (0)
+
+    if (key_size == element_size)
+    {
+        switch (element_size)
+        {
+            case 1: UNIQUE_WORDS(uint8_t);
+            case 2: UNIQUE_WORDS(uint16_t);
+            case 4: UNIQUE_WORDS(uint32_t);
+            case 8: UNIQUE_WORDS(uint64_t);
+            default: break;
+        }
+    }
+
+#undef UNIQUE_WORDS
+
+    /* element preceding the current one is never overwritten before comparison */
+    size_t dest = 1;
+    for (size_t i = 1; i < limit; ++i)
+    {
+        const char *cur = data + i * element_size;
+        if (!equal_elements(cur, cur - element_size, cmp, param, key_size))
+        {
+            if (dest != i) memcpy(data + dest * element_size, cur, element_size);
+            ++dest;
+        }
+    }
+
+    return dest;
+}
+
+
+vector_status_t vector_run_length(const vector_t *const vector,
+        const size_t limit,
+        const compare_t cmp,
+        void *const param,
+        vector_t **const values,
+        vector_t **const counts,
+        size_t *const runs)
+{
+    assert(vector);
+    assert(cmp);
+    assert(values && *values);
+    assert(counts && *counts);
+    assert(runs);
+    assert((limit <= vector->capacity) && "Limit out of capacity bounds!");
+    assert(((*values)->element_size == vector->element_size) && "Values element size differs!");
+    assert(((*counts)->element_size == sizeof(size_t)) && "Counts of size_t expected!");
+
+    const size_t element_size = vector->element_size;
+    const size_t key_size = bytewise_size(cmp, param);
+    const char *data = vector_data(vector);
+
+    char *out = vector_data(*values);
+    char *lengths = vector_data(*counts);
+    size_t run = 0;
+
+    /* single pass, outputs grow geometrically, never beyond limit */
+    for (size_t start = 0, end; start < limit; start = end, ++run)
+    {
+        if (run == (*values)->capacity || run == (*counts)->capacity)
+        {
+            const size_t grown = run < RUN_LENGTH_MIN_CAP / 2 ? RUN_LENGTH_MIN_CAP : run * 2;
+            const size_t capacity = grown < limit ? grown : limit;
+
+            if (((*values)->capacity <= run && VECTOR_SUCCESS != vector_resize(values, capacity, VECTOR_ALLOC_ERROR))
+                || ((*counts)->capacity <= run && VECTOR_SUCCESS != vector_resize(counts, capacity, VECTOR_ALLOC_ERROR)))
+            {
+                return VECTOR_ALLOC_ERROR;
+            }
+
+            out = vector_data(*values);
+            lengths = vector_data(*counts);
+        }
+
+        end = run_end(vector, start, limit, cmp, param, key_size);
+        memcpy(out + run * element_size, data + start * element_size, element_size);
+        memcpy(lengths + run * sizeof(size_t), &(size_t) {end - start}, sizeof(size_t));
+    }
+
+    *runs = run;
+    return VECTOR_SUCCESS;
+}
+
+
+void vector_swap(vector_t *const vector, const size_t index_a, const size_t index_b)
+{
+    assert(vector);
+    assert(index_a != index_b);
+    assert(index_a < vector->capacity && index_b < vector->capacity);
+
+    void *a = vector_get(vector, index_a);
+    void *b = vector_get(vector, index_b);
+    memswap(a, b, vector->element_size);
+}
+
+
+int vector_foreach(const vector_t *const vector, const size_t limit, const foreach_t func, void *const param)
+{
+    assert(vector);
+    assert(limit && limit <= vector->capacity);
+    assert(func);
+
+    for (size_t i = 0; i < limit; ++i)
+    {
+        int status = func(vector_get(vector, i), param);
+        if (status) return status;
+    }
+
+    return 0;
+}
+
+
+int vector_aggregate(const vector_t *const vector, const size_t limit, const aggregate_t func, void *const acc, void *const param)
+{
+    assert(vector);
+    assert(limit && limit <= vector->capacity);
+    assert(func);
+
+    for (size_t i = 0; i < limit; ++i)
+    {
+        int status = func(vector_get(vector, i), acc, param);
+        if (status) return status;
+    }
+
+    return 0;
+}
+
+
+int vector_transform(vector_t *const vector, const size_t limit, const transform_t func, void *const param)
+{
+    assert(vector);
+    assert(limit && limit <= vector->capacity);
+    assert(func);
+
+    return vector_foreach(vector, limit, (foreach_t)func, param);
+}
+
+
+uint64_t vector_hash(const vector_t *const vector,
+        const size_t offset,
+        const size_t length,
+        const uint64_t seed)
+{
+    assert(vector);
+    assert((offset + length <= vector->capacity) && "`offset + length` exceeds vector's capacity!");
+
+    const size_t size = length * vector->element_size;
+    const char *data = vector_data(vector) + offset * vector->element_size;
+
+    if (size <= VECTOR_HASH_CHUNK)
+    {
+        return vector_hash_bytes(data, size, seed);
+    }
+
+    uint64_t acc = seed ^ hash_mix(size ^ HASH_P2, HASH_P3);
+    size_t count = 0;
+
+    for (size_t done = 0; done < size; done += VECTOR_HASH_CHUNK, ++count)
+    {
+        const size_t chunk = size - done < VECTOR_HASH_CHUNK ? size - done : VECTOR_HASH_CHUNK;
+        acc = hash_fold_step(acc, vector_hash_bytes(data + done, chunk, seed));
+    }
+
+    return hash_mix(acc ^ HASH_P0, count ^ HASH_P1);
+}
+
+
+vector_hash128_t vector_hash128(const vector_t *const vector,
+        const size_t offset,
+        const size_t length,
+        const uint64_t seed)
+{
+    return (vector_hash128_t) {
+        .low = vector_hash(vector, offset, length, seed),
+        .high = vector_hash(vector, offset, length, seed ^ HASH_P3),
+    };
+}
+
+
+uint64_t vector_hash_bytes(const void *const data, const size_t size, const uint64_t seed)
+{
+    assert(data || !size);
+
+    const char *p = data;
+    uint64_t a, b;
+
+    uint64_t state = seed ^ hash_mix(seed ^ HASH_P0, HASH_P1);
+
+    if (size <= 16)
+    {
+        if (size >= 4)
+        {
+            /* two overlapping pairs of 4 byte words cover 4..16 bytes */
+            const size_t shift = (size >> 3) << 2;
+            a = (load_key(p, 4) << 32) | load_key(p + shift, 4);
+            b = (load_key(p + size - 4, 4) << 32) | load_key(p + size - 4 - shift, 4);
+        }
+        else if (size > 0)
+        {
+            a = (load_key(p, 1) << 16) | (load_key(p + (size >> 1), 1) << 8) | load_key(p + size - 1, 1);
+            b = 0;
+        }
+        else
+        {
+            a = b = 0;
+        }
+    }
+    else
+    {
+        size_t left = size;
+
+        if (left > 48)
+        {
+            /* three independent lanes, 48 bytes per round */
+            uint64_t see1 = state, see2 = state;
+            do
+            {
+                state = hash_mix(load_key(p, 8) ^ HASH_P1, load_key(p + 8, 8) ^ state);
+                see1 = hash_mix(load_key(p + 16, 8) ^ HASH_P2, load_key(p + 24, 8) ^ see1);
+                see2 = hash_mix(load_key(p + 32, 8) ^ HASH_P3, load_key(p + 40, 8) ^ see2);
+                p += 48;
+                left -= 48;
+            }
+            while (left > 48);
+
+            state ^= see1 ^ see2;
+        }
+
+        while (left > 16)
+        {
+            state = hash_mix(load_key(p, 8) ^ HASH_P1, load_key(p + 8, 8) ^ state);
+            p += 16;
+            left -= 16;
+        }
+
+        a = load_key(p + left - 16, 8);
+        b = load_key(p + left - 8, 8);
+    }
+
+    a ^= HASH_P1;
+    b ^= state;
+
+    const __uint128_t product = (__uint128_t)a * b;
+    a = (uint64_t)product;
+    b = (uint64_t)(product >> 64);
+
+    return hash_mix(a ^ HASH_P0 ^ size, b ^ HASH_P1);
+}
+
+
+uint64_t vector_hash_fold(const uint64_t *const digests,
+        const size_t count,
+        const size_t size,
+        const uint64_t seed)
+{
+    assert(digests);
+    assert((count == (size ? (size + VECTOR_HASH_CHUNK - 1) / VECTOR_HASH_CHUNK : 1))
+            && "Digest count does not match size!");
+
+    if (size <= VECTOR_HASH_CHUNK)
+    {
+        return digests[0];
+    }
+
+    uint64_t acc = seed ^ hash_mix(size ^ HASH_P2, HASH_P3);
+    for (size_t i = 0; i < count; ++i)
+    {
+        acc = hash_fold_step(acc, digests[i]);
+    }
+
+    return hash_mix(acc ^ HASH_P0, count ^ HASH_P1);
+}
+
+
+bool vector_equal(const vector_t *const a, const vector_t *const b)
+{
+    assert(a);
+    assert(b);
+
+    if (a == b)
+    {
+        return true;
+    }
+
+    if (a->element_size != b->element_size || a->capacity != b->capacity)
+    {
+        return false;
+    }
+
+    const size_t size = vector_capacity_bytes(a);
+    return size == mismatch(vector_data(a), vector_data(b), size);
+}
+
+
+ssize_t vector_compare_range(const vector_t *const a,
+        const vector_t *const b,
+        const size_t offset,
+        const size_t length)
+{
+    assert(a);
+    assert(b);
+    assert((a->element_size == b->element_size) && "Element sizes differ!");
+    assert((offset + length <= a->capacity) && "`offset + length` exceeds capacity of `a`!");
+    assert((offset + length <= b->capacity) && "`offset + length` exceeds capacity of `b`!");
+
+    if (a == b || 0 == length)
+    {
+        return -1;
+    }
+
+    const size_t element_size = a->element_size;
+    const size_t size = length * element_size;
+    const size_t found = mismatch(vector_get(a, offset), vector_get(b, offset), size);
+
+    return found == size ? -1 : (ssize_t)(offset + found / element_size);
+}
+
+
+void * __attribute__((weak)) vector_alloc(const size_t alloc_size, void *const param)
+{
+    (void)param;
+    return malloc(alloc_size);
+}
+
+
+void * __attribute__((weak)) vector_realloc(void *ptr, const size_t alloc_size, void *const param)
+{
+    (void)param;
+    return realloc(ptr, alloc_size);
+}
+
+
+void * __attribute__((weak)) vector_calloc(const size_t alloc_size, void *const param)
+{
+    (void)param;
+    return calloc(1, alloc_size);
+}
+
+
+void * __attribute__((weak)) vector_realloc_zeroed(void *ptr, const size_t old_size, const size_t alloc_size, void *const param)
+{
+    char *new = vector_realloc(ptr, alloc_size, param);
+    if (new && alloc_size > old_size)
+    {
+        memset(new + old_size, 0x00, alloc_size - old_size);
+    }
+    return new;
+}
+
+
+void __attribute__((weak)) vector_free(void *ptr, void *const param)
+{
+    (void)param;
+    free(ptr);
+}
+
+
+size_t calc_aligned_size(const size_t size, const size_t alignment)
+{
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+
+ssize_t cmp_lex_asc(const void *value, const void *element, void *param)
+{
+    return memcmp(value, element, (size_t)param);
 }
 
 
 ssize_t cmp_lex_dsc(const void *value, const void *element, void *param)
 {
-    return memcmp(element, value, (size_t)param);
+    return memcmp(element, value, (size_t)param);
+}
+
+
+/* three-way comparison of native keys loaded from x and y */
+#define NATIVE_ORDER(type, x, y) \
+    do { \
+        type a, b; \
+        memcpy(&a, (x), sizeof(type)); \
+        memcpy(&b, (y), sizeof(type)); \
+        return (a > b) - (a < b); \
+    } while (0)
+
+
+ssize_t cmp_lex4_asc(const void *value, const void *element, void *param)
+{
+    (void) param;
+    const uint32_t a = load_be32(value), b = load_be32(element);
+    return (a > b) - (a < b);
+}
+
+
+ssize_t cmp_lex4_dsc(const void *value, const void *element, void *param)
+{
+    (void) param;
+    const uint32_t a = load_be32(element), b = load_be32(value);
+    return (a > b) - (a < b);
+}
+
+
+ssize_t cmp_lex8_asc(const void *value, const void *element, void *param)
+{
+    (void) param;
+    return lex_words(value, element, 1);
+}
+
+
+ssize_t cmp_lex8_dsc(const void *value, const void *element, void *param)
+{
+    (void) param;
+    return lex_words(element, value, 1);
+}
+
+
+ssize_t cmp_lex16_asc(const void *value, const void *element, void *param)
+{
+    (void) param;
+    return lex_words(value, element, 2);
+}
+
+
+ssize_t cmp_lex16_dsc(const void *value, const void *element, void *param)
+{
+    (void) param;
+    return lex_words(element, value, 2);
+}
+
+
+ssize_t cmp_lex32_asc(const void *value, const void *element, void *param)
+{
+    (void) param;
+    return lex_words(value, element, 4);
+}
+
+
+ssize_t cmp_lex32_dsc(const void *value, const void *element, void *param)
+{
+    (void) param;
+    return lex_words(element, value, 4);
+}
+
+
+ssize_t cmp_u32_asc(const void *value, const void *element, void *param)
+{
+    (void) param;
+    NATIVE_ORDER(uint32_t, value, element);
+}
+
+
+ssize_t cmp_u32_dsc(const void *value, const void *element, void *param)
+{
+    (void) param;
+    NATIVE_ORDER(uint32_t, element, value);
+}
+
+
+ssize_t cmp_u64_asc(const void *value, const void *element, void *param)
+{
+    (void) param;
+    NATIVE_ORDER(uint64_t, value, element);
+}
+
+
+ssize_t cmp_u64_dsc(const void *value, const void *element, void *param)
+{
+    (void) param;
+    NATIVE_ORDER(uint64_t, element, value);
+}
+
+
+ssize_t cmp_i32_asc(const void *value, const void *element, void *param)
+{
+    (void) param;
+    NATIVE_ORDER(int32_t, value, element);
+}
+
+
+ssize_t cmp_i32_dsc(const void *value, const void *element, void *param)
+{
+    (void) param;
+    NATIVE_ORDER(int32_t, element, value);
+}
+
+
+ssize_t cmp_i64_asc(const void *value, const void *element, void *param)
+{
+    (void) param;
+    NATIVE_ORDER(int64_t, value, element);
+}
+
+
+ssize_t cmp_i64_dsc(const void *value, const void *element, void *param)
+{
+    (void) param;
+    NATIVE_ORDER(int64_t, element, value);
+}
+
+
+ssize_t cmp_float_asc(const void *value, const void *element, void *param)
+{
+    (void) param;
+    NATIVE_ORDER(float, value, element);
+}
+
+
+ssize_t cmp_float_dsc(const void *value, const void *element, void *param)
+{
+    (void) param;
+    NATIVE_ORDER(float, element, value);
+}
+
+
+ssize_t cmp_double_asc(const void *value, const void *element, void *param)
+{
+    (void) param;
+    NATIVE_ORDER(double, value, element);
+}
+
+
+ssize_t cmp_double_dsc(const void *value, const void *element, void *param)
+{
+    (void) param;
+    NATIVE_ORDER(double, element, value);
 }
 
+#undef NATIVE_ORDER
+
 
 /*                        **
 * === Static Functions === *
@@ -483,32 +1538,115 @@ static void *get_allocator(const vector_t *const vector)
 }
 
 
-static void *binary_find(const vector_t *const vector,
-        const void *const value,
-        const size_t start,
-        const size_t end,
-        const compare_t cmp,
-        void *param)
+static size_t get_allocator_size(const vector_t *const vector)
+{
+    return vector->allocator_size & ~INLINE_FLAG;
+}
+
+
+static void get_inline_record(const vector_t *const vector, inline_record_t *const record)
+{
+    assert(vector_is_inline(vector));
+
+    /* allocator region has no alignment guarantees */
+    memcpy(record, vector->memory + get_allocator_size(vector) - sizeof(inline_record_t), sizeof(inline_record_t));
+}
+
+
+static void set_inline_record(vector_t *const vector, const inline_record_t *const record)
+{
+    memcpy(vector->memory + get_allocator_size(vector) - sizeof(inline_record_t), record, sizeof(inline_record_t));
+}
+
+
+static vector_t *copy_out(const vector_t *const vector, const size_t capacity)
 {
-    if (start == end)
+    inline_record_t record;
+    get_inline_record(vector, &record);
+
+    const size_t alloc_size = calculate_alloc_size(vector->element_size,
+            capacity,
+            record.user_size,
+            vector->ext_header_size);
+
+    // inheriting original vectors allocation method
+    vector_t *copy = (vector_t *) vector_alloc(alloc_size, get_allocator(vector));
+    if (!copy)
     {
         return NULL;
     }
 
-    const size_t middle = (start + end) / 2;
-    void *middle_value = vector_get(vector, middle);
+    *copy = (vector_t) {
+        .element_size = vector->element_size,
+        .capacity = capacity,
+        .ext_header_size = vector->ext_header_size,
+        .allocator_size = record.user_size,
+    };
+
+    /* user allocator data, then extension header and elements past the record */
+    const size_t count = (capacity < vector->capacity) ? capacity : vector->capacity;
+    memcpy(get_allocator(copy), get_allocator(vector), record.user_size);
+    memcpy(copy->memory + record.user_size,
+            vector->memory + get_allocator_size(vector),
+            vector->ext_header_size + count * vector->element_size);
+    return copy;
+}
+
 
-    if (0 == cmp(value, middle_value, param))
+static vector_status_t resize_inline(vector_t **const vector,
+        const size_t capacity,
+        const vector_status_t error,
+        const bool zeroed)
+{
+    vector_t *vec = *vector;
+    inline_record_t record;
+    get_inline_record(vec, &record);
+
+    const size_t old_capacity = vec->capacity;
+    const size_t alloc_size = calculate_alloc_size(vec->element_size,
+            capacity,
+            get_allocator_size(vec),
+            vec->ext_header_size);
+
+    if (alloc_size > record.storage_size)
+    {
+        /* spill: copy out of the storage, the copy is an ordinary heap vector */
+        vec = copy_out(*vector, capacity);
+        if (!vec)
+        {
+            return error;
+        }
+    }
+
+    vec->capacity = capacity;
+    if (zeroed && capacity > old_capacity)
     {
-        return middle_value;
+        memset(vector_data(vec) + old_capacity * vec->element_size, 0x00, (capacity - old_capacity) * vec->element_size);
     }
 
-    if (0 < cmp(value, middle_value, param))
+    *vector = vec;
+    return VECTOR_SUCCESS;
+}
+
+
+static void release(vector_t *const vector)
+{
+    if (!vector_is_inline(vector))
     {
-        return binary_find(vector, value, middle + 1, end, cmp, param);
+        vector_free(vector, get_allocator(vector));
     }
+}
 
-    return binary_find(vector, value, start, middle, cmp, param);
+
+static void *binary_find(const vector_t *const vector,
+        const void *const value,
+        const size_t start,
+        const size_t end,
+        const compare_t cmp,
+        void *param)
+{
+    const ssize_t index = binary_find_index(vector, value, start, end, cmp, param);
+    return index < 0 ? NULL : vector_get(vector, (size_t)index);
 }
 
 
@@ -519,23 +1657,469 @@ static ssize_t binary_find_index(const vector_t *const vector,
         const compare_t cmp,
         void *param)
 {
-    if (start == end)
+    const size_t element_size = vector->element_size;
+    const char *data = vector_data(vector);
+
+    /* `compare` is either the callback or a comparator called directly, so it gets inlined */
+#define BINARY_SEARCH(compare) \
+    do { \
+        size_t low = start, high = end; \
+        while (low < high) \
+        { \
+            const size_t middle = (low + high) / 2; \
+            const ssize_t order = compare(value, data + middle * element_size, param); \
+            if (0 == order) return (ssize_t)middle; \
+            if (0 < order) low = middle + 1; \
+            else high = middle; \
+        } \
+        return -1; \
+    } while (0)
+
+#define SEARCH_WITH(comparator) \
+    if (cmp == comparator) BINARY_SEARCH(comparator);
+
+    SPECIALIZED_COMPARATORS(SEARCH_WITH)
+    BINARY_SEARCH(cmp);
+
+#undef SEARCH_WITH
+#undef BINARY_SEARCH
+}
+
+
+static void fill_pattern(char *const dest,
+        const size_t element_size,
+        const size_t size)
+{
+    /* period of the pattern that keeps streaming stores aligned */
+    size_t period = element_size;
+    while (period % STREAM_ALIGNMENT) period += element_size;
+    period *= (STREAM_PATTERN_SIZE + period - 1) / period;
+
+    const size_t head = (STREAM_ALIGNMENT - (uintptr_t)dest % STREAM_ALIGNMENT) % STREAM_ALIGNMENT;
+    const size_t prefix = (size < VECTOR_STREAM_THRESHOLD || size < head + period)
+        ? size
+        : head + period;
+
+    /* copy pattern exponentially through out the cached prefix */
+    size_t filled = element_size;
+    while (filled < prefix)
     {
-        return -1;
+        const size_t chunk = (filled < prefix - filled) ? filled : prefix - filled;
+        memcpy(dest + filled, dest, chunk);
+        filled += chunk;
+    }
+
+    if (filled == size) return;
+
+    /* stream rest of the range, pattern phase matches every period from aligned head */
+    const char *pattern = dest + prefix - period;
+    for (; filled + period <= size; filled += period)
+    {
+        stream_copy(dest + filled, pattern, period);
+    }
+    memcpy(dest + filled, pattern, size - filled);
+    stream_fence();
+}
+
+
+static bool fill_broadcast(char *dest,
+        const void *const value,
+        const size_t element_size,
+        size_t size)
+{
+    if (1 == element_size)
+    {
+        if (size < VECTOR_STREAM_THRESHOLD)
+        {
+            memset(dest, *(const unsigned char *)value, size);
+            return true;
+        }
+    }
+    else if (element_size != 2 && element_size != 4
+            && element_size != 8 && element_size != 16)
+    {
+        return false;
+    }
+
+#if defined(__SSE2__)
+    /* two copies of the pattern, any 16 byte window is a valid phase */
+    unsigned char pattern[2 * STREAM_ALIGNMENT];
+    for (size_t i = 0; i < sizeof(pattern); i += element_size)
+    {
+        memcpy(pattern + i, value, element_size);
+    }
+
+    if (size < VECTOR_STREAM_THRESHOLD)
+    {
+        const __m128i p = _mm_loadu_si128((const __m128i *)pattern);
+        for (; size >= 4 * STREAM_ALIGNMENT; size -= 4 * STREAM_ALIGNMENT)
+        {
+            _mm_storeu_si128((__m128i *)dest + 0, p);
+            _mm_storeu_si128((__m128i *)dest + 1, p);
+            _mm_storeu_si128((__m128i *)dest + 2, p);
+            _mm_storeu_si128((__m128i *)dest + 3, p);
+            dest += 4 * STREAM_ALIGNMENT;
+        }
+        for (; size >= STREAM_ALIGNMENT; size -= STREAM_ALIGNMENT)
+        {
+            _mm_storeu_si128((__m128i *)dest, p);
+            dest += STREAM_ALIGNMENT;
+        }
+        memcpy(dest, pattern, size);
+        return true;
+    }
+
+    const size_t head = (STREAM_ALIGNMENT - (uintptr_t)dest % STREAM_ALIGNMENT) % STREAM_ALIGNMENT;
+    memcpy(dest, pattern, head);
+    dest += head; size -= head;
+
+    const __m128i p = _mm_loadu_si128((const __m128i *)(pattern + head));
+    for (; size >= 4 * STREAM_ALIGNMENT; size -= 4 * STREAM_ALIGNMENT)
+    {
+        _mm_stream_si128((__m128i *)dest + 0, p);
+        _mm_stream_si128((__m128i *)dest + 1, p);
+        _mm_stream_si128((__m128i *)dest + 2, p);
+        _mm_stream_si128((__m128i *)dest + 3, p);
+        dest += 4 * STREAM_ALIGNMENT;
+    }
+    for (; size >= STREAM_ALIGNMENT; size -= STREAM_ALIGNMENT)
+    {
+        _mm_stream_si128((__m128i *)dest, p);
+        dest += STREAM_ALIGNMENT;
+    }
+    memcpy(dest, pattern + head, size);
+    stream_fence();
+    return true;
+#else
+    (void) dest;
+    (void) value;
+    (void) size;
+    return false;
+#endif
+}
+
+
+static void stream_copy(char *dest, const char *src, size_t size)
+{
+#if defined(__SSE2__)
+    const size_t head = (STREAM_ALIGNMENT - (uintptr_t)dest % STREAM_ALIGNMENT) % STREAM_ALIGNMENT;
+    if (size < head + STREAM_ALIGNMENT)
+    {
+        memcpy(dest, src, size);
+        return;
+    }
+
+    memcpy(dest, src, head);
+    dest += head; src += head; size -= head;
+
+    for (; size >= 4 * STREAM_ALIGNMENT; size -= 4 * STREAM_ALIGNMENT)
+    {
+        const __m128i a = _mm_loadu_si128((const __m128i *)src + 0);
+        const __m128i b = _mm_loadu_si128((const __m128i *)src + 1);
+        const __m128i c = _mm_loadu_si128((const __m128i *)src + 2);
+        const __m128i d = _mm_loadu_si128((const __m128i *)src + 3);
+        _mm_stream_si128((__m128i *)dest + 0, a);
+        _mm_stream_si128((__m128i *)dest + 1, b);
+        _mm_stream_si128((__m128i *)dest + 2, c);
+        _mm_stream_si128((__m128i *)dest + 3, d);
+        dest += 4 * STREAM_ALIGNMENT;
+        src += 4 * STREAM_ALIGNMENT;
+    }
+
+    for (; size >= STREAM_ALIGNMENT; size -= STREAM_ALIGNMENT)
+    {
+        _mm_stream_si128((__m128i *)dest, _mm_loadu_si128((const __m128i *)src));
+        dest += STREAM_ALIGNMENT;
+        src += STREAM_ALIGNMENT;
+    }
+#endif
+    memcpy(dest, src, size);
+}
+
+
+static void stream_zero(char *dest, size_t size)
+{
+#if defined(__SSE2__)
+    const size_t head = (STREAM_ALIGNMENT - (uintptr_t)dest % STREAM_ALIGNMENT) % STREAM_ALIGNMENT;
+    if (size < head + STREAM_ALIGNMENT)
+    {
+        memset(dest, 0x00, size);
+        return;
+    }
+
+    memset(dest, 0x00, head);
+    dest += head; size -= head;
+
+    const __m128i zero = _mm_setzero_si128();
+    for (; size >= 4 * STREAM_ALIGNMENT; size -= 4 * STREAM_ALIGNMENT)
+    {
+        _mm_stream_si128((__m128i *)dest + 0, zero);
+        _mm_stream_si128((__m128i *)dest + 1, zero);
+        _mm_stream_si128((__m128i *)dest + 2, zero);
+        _mm_stream_si128((__m128i *)dest + 3, zero);
+        dest += 4 * STREAM_ALIGNMENT;
+    }
+
+    for (; size >= STREAM_ALIGNMENT; size -= STREAM_ALIGNMENT)
+    {
+        _mm_stream_si128((__m128i *)dest, zero);
+        dest += STREAM_ALIGNMENT;
+    }
+#endif
+    memset(dest, 0x00, size);
+}
+
+
+#if defined(__SSSE3__)
+/**
+ * @internal
+ * @brief Shuffle masks moving kept 4 byte lanes to the front, indexed by keep mask.
+ */
+static const int8_t compress_lut[16][16] = {
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    { 0,  1,  2,  3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    { 4,  5,  6,  7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    { 0,  1,  2,  3,  4,  5,  6,  7, -1, -1, -1, -1, -1, -1, -1, -1},
+    { 8,  9, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    { 0,  1,  2,  3,  8,  9, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1},
+    { 4,  5,  6,  7,  8,  9, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1},
+    { 0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, -1, -1, -1, -1},
+    {12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    { 0,  1,  2,  3, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1},
+    { 4,  5,  6,  7, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1},
+    { 0,  1,  2,  3,  4,  5,  6,  7, 12, 13, 14, 15, -1, -1, -1, -1},
+    { 8,  9, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1},
+    { 0,  1,  2,  3,  8,  9, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1},
+    { 4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1},
+    { 0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15},
+};
+#endif
+
+
+static size_t remove_key32(char *const data, const size_t limit, const uint32_t key)
+{
+    /* data may be misaligned for uint32_t, scalar access goes through memcpy */
+    size_t dest = 0;
+    size_t i = 0;
+
+#if defined(__SSE2__)
+    const __m128i keys = _mm_set1_epi32((int)key);
+    for (; i + 4 <= limit; i += 4)
+    {
+        const __m128i block = _mm_loadu_si128((const __m128i *)(data + i * sizeof(uint32_t)));
+        const unsigned keep = ~(unsigned)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, keys))) & 0xF;
+#if defined(__SSSE3__)
+        /* writes full register, garbage lanes land on already consumed elements */
+        const __m128i shuffle = _mm_loadu_si128((const __m128i *)compress_lut[keep]);
+        _mm_storeu_si128((__m128i *)(data + dest * sizeof(uint32_t)), _mm_shuffle_epi8(block, shuffle));
+        dest += (size_t)__builtin_popcount(keep);
+#else
+        uint32_t lanes[4];
+        _mm_storeu_si128((__m128i *)lanes, block);
+        for (unsigned n = 0; n < 4; ++n)
+        {
+            memcpy(data + dest * sizeof(uint32_t), &lanes[n], sizeof(uint32_t));
+            dest += (keep >> n) & 1;
+        }
+#endif
+    }
+#endif
+
+    for (; i < limit; ++i)
+    {
+        uint32_t element;
+        memcpy(&element, data + i * sizeof(uint32_t), sizeof(element));
+        memcpy(data + dest * sizeof(uint32_t), &element, sizeof(element));
+        dest += (element != key);
+    }
+
+    return dest;
+}
+
+
+static uint64_t load_key(const char *const src, const size_t key_size)
+{
+    switch (key_size)
+    {
+        case 1: { uint8_t k; memcpy(&k, src, sizeof(k)); return k; }
+        case 2: { uint16_t k; memcpy(&k, src, sizeof(k)); return k; }
+        case 4: { uint32_t k; memcpy(&k, src, sizeof(k)); return k; }
+        default: { uint64_t k; memcpy(&k, src, sizeof(k)); return k; }
+    }
+}
+
+
+static uint64_t hash_mix(uint64_t a, uint64_t b)
+{
+    const __uint128_t product = (__uint128_t)a * b;
+    return (uint64_t)product ^ (uint64_t)(product >> 64);
+}
+
+
+static uint64_t hash_fold_step(const uint64_t acc, const uint64_t digest)
+{
+    return hash_mix(acc ^ digest, HASH_P1);
+}
+
+
+static size_t mismatch(const char *const a, const char *const b, const size_t size)
+{
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    for (; i + 32 <= size; i += 32)
+    {
+        const __m256i x = _mm256_loadu_si256((const __m256i *)(a + i));
+        const __m256i y = _mm256_loadu_si256((const __m256i *)(b + i));
+        const uint32_t equal = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y));
+        if (equal != UINT32_MAX) return i + __builtin_ctz(~equal);
+    }
+#elif defined(__SSE2__)
+    for (; i + 16 <= size; i += 16)
+    {
+        const __m128i x = _mm_loadu_si128((const __m128i *)(a + i));
+        const __m128i y = _mm_loadu_si128((const __m128i *)(b + i));
+        const uint32_t equal = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(x, y));
+        if (equal != 0xffff) return i + __builtin_ctz(~equal);
+    }
+#endif
+
+    for (; i + 8 <= size; i += 8)
+    {
+        const uint64_t diff = load_key(a + i, 8) ^ load_key(b + i, 8);
+        if (diff)
+        {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            return i + __builtin_ctzll(diff) / 8;
+#else
+            return i + __builtin_clzll(diff) / 8;
+#endif
+        }
+    }
+
+    for (; i < size; ++i)
+    {
+        if (a[i] != b[i]) return i;
+    }
+
+    return size;
+}
+
+
+static uint32_t load_be32(const void *const src)
+{
+    uint32_t word;
+    memcpy(&word, src, sizeof(word));
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    word = __builtin_bswap32(word);
+#endif
+    return word;
+}
+
+
+static uint64_t load_be64(const void *const src)
+{
+    uint64_t word;
+    memcpy(&word, src, sizeof(word));
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    word = __builtin_bswap64(word);
+#endif
+    return word;
+}
+
+
+static ssize_t lex_words(const char *const a, const char *const b, const size_t words)
+{
+    for (size_t i = 0; i < words; ++i)
+    {
+        const uint64_t x = load_be64(a + i * sizeof(uint64_t));
+        const uint64_t y = load_be64(b + i * sizeof(uint64_t));
+        if (x != y) return (x > y) - (x < y);
     }
+    return 0;
+}
+
+
+static size_t bytewise_size(const compare_t cmp, void *const param)
+{
+    if (cmp == cmp_lex_asc || cmp == cmp_lex_dsc) return (size_t)param;
+    if (cmp == cmp_lex4_asc || cmp == cmp_lex4_dsc) return 4;
+    if (cmp == cmp_lex8_asc || cmp == cmp_lex8_dsc) return 8;
+    if (cmp == cmp_lex16_asc || cmp == cmp_lex16_dsc) return 16;
+    if (cmp == cmp_lex32_asc || cmp == cmp_lex32_dsc) return 32;
+
+    /* integers are equal iff their bytes are, floats are not (-0.0 == 0.0) */
+    if (cmp == cmp_u32_asc || cmp == cmp_u32_dsc || cmp == cmp_i32_asc || cmp == cmp_i32_dsc) return 4;
+    if (cmp == cmp_u64_asc || cmp == cmp_u64_dsc || cmp == cmp_i64_asc || cmp == cmp_i64_dsc) return 8;
+
+    return 0;
+}
 
-    const size_t middle = (start + end) / 2;
-    void *middle_value = vector_get(vector, middle);
 
-    if (0 == cmp(value, middle_value, param))
+static size_t run_end(const vector_t *const vector,
+        size_t start,
+        const size_t limit,
+        const compare_t cmp,
+        void *const param,
+        const size_t key_size)
+{
+    const size_t element_size = vector->element_size;
+    const char *data = vector_data(vector);
+
+    /* data may be misaligned for the word type */
+#define RUN_END_WORDS(type) \
+    do { \
+        type first, cur; \
+        memcpy(&first, data + start * sizeof(type), sizeof(type)); \
+        while (++start < limit) \
+        { \
+            memcpy(&cur, data + start * sizeof(type), sizeof(type)); \
+            if (cur != first) break; \
+        } \
+        return start; \
+    } while (0)
+
+    if (key_size == element_size)
     {
-        return middle;
+        switch (element_size)
+        {
+            case 1: RUN_END_WORDS(uint8_t);
+            case 2: RUN_END_WORDS(uint16_t);
+            case 4: RUN_END_WORDS(uint32_t);
+            case 8: RUN_END_WORDS(uint64_t);
+            default: break;
+        }
     }
 
-    if (0 < cmp(value, middle_value, param))
+#undef RUN_END_WORDS
+
+    const char *first = data + start * element_size;
+    while (++start < limit && equal_elements(data + start * element_size, first, cmp, param, key_size));
+    return start;
+}
+
+
+static bool equal_elements(const char *const a,
+        const char *const b,
+        const compare_t cmp,
+        void *const param,
+        const size_t key_size)
+{
+    switch (key_size)
     {
-        return binary_find_index(vector, value, middle + 1, end, cmp, param);
+        case 0:
+            return 0 == cmp(a, b, param);
+        case 1: case 2: case 4: case 8:
+            return load_key(a, key_size) == load_key(b, key_size);
+        default:
+            return 0 == memcmp(a, b, key_size);
     }
+}
 
-    return binary_find_index(vector, value, start, middle, cmp, param);
+
+static void stream_fence(void)
+{
+#if defined(__SSE2__)
+    _mm_sfence();
+#endif
 }
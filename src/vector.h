@@ -9,6 +9,7 @@
 
 #include <stdbool.h>    /* bool, true, false */
 #include <stddef.h>     /* size_t */
+#include <stdint.h>     /* uint64_t */
 #include <sys/types.h>  /* ssize_t */
 
 /**
@@ -57,6 +58,7 @@ typedef struct vector_opts_t
 
     /* optional: */
     size_t initial_cap;       /**< @brief Amount of elements that will be preallocated. */
+    bool zero_init;           /**< @brief Preallocated elements are zero initialized. @see vector_calloc */
 }
 vector_opts_t;
 
@@ -78,6 +80,63 @@ vector_status_t;
 #define VECTOR_DEFAULT_ARGS \
     .initial_cap = 10
 
+/**
+* @brief   Size in bytes starting from which bulk range operations
+*          switch to non-temporal (streaming) stores.
+* @details Streaming stores bypass the cache hierarchy, so initializing or copying
+*          buffers that are not going to be touched again soon does not evict
+*          working sets of concurrent workloads from the last level cache.
+*          Can be overridden at build time, e.g. @c -DVECTOR_STREAM_THRESHOLD=0x100000 .
+* @see vector_fill_range, vector_zero_range, vector_stream_copy
+*/
+#ifndef VECTOR_STREAM_THRESHOLD
+#define VECTOR_STREAM_THRESHOLD (4 * 1024 * 1024)
+#endif
+
+/**
+* @brief   Size in bytes of independently hashed chunks.
+* @details Ranges larger than a chunk are hashed as a sequence of chunk digests,
+*          so chunks can be hashed in parallel or rehashed individually when they change,
+*          without changing the resulting hash value.
+* @see vector_hash, vector_hash_fold
+*/
+#define VECTOR_HASH_CHUNK (64 * 1024)
+
+/**
+* @brief   Size of the vector control structure.
+* @see VECTOR_INLINE_SIZE
+*/
+#define VECTOR_CONTROL_SIZE (4 * sizeof(size_t))
+
+/**
+* @brief   Size of the record kept by a vector placed into caller provided storage.
+* @details Record is appended to vector's allocator region, but is not a part of
+*          allocator data reported by @ref vector_alloc_opts. Whether the vector is inline
+*          is tracked in its control structure, never read from allocator data.
+* @see VECTOR_INLINE_SIZE
+*/
+#define VECTOR_INLINE_RECORD_SIZE (2 * sizeof(size_t))
+
+/**
+* @brief   Size of caller provided storage for a vector of @c capacity elements.
+* @details Accounts for control structure and inline record,
+*          allocator and extension header sizes must be added when present.
+* @see vector_create_inline_
+*/
+#define VECTOR_INLINE_SIZE(element_size, capacity) \
+    (VECTOR_CONTROL_SIZE + VECTOR_INLINE_RECORD_SIZE + (element_size) * (capacity))
+
+/**
+* @brief   128-bit hash value.
+* @see vector_hash128
+*/
+typedef struct vector_hash128_t
+{
+    uint64_t low;  /**< @brief Lower 64 bits. */
+    uint64_t high; /**< @brief Upper 64 bits. */
+}
+vector_hash128_t;
+
 /**
  * @addtogroup Vector_API Vector API
  * @brief      Main vectors methods. @{ */
@@ -180,10 +239,41 @@ typedef int (*transform_t) (void *const element, void *const param);
 vector_t *vector_create_(const vector_opts_t *const opts);
 
 
+/**
+* @brief   Vector constructor placing vector into caller provided storage.
+* @details Storage holds the whole vector: control structure, allocator,
+*          extension header and as many elements as fit, so no allocation happens.
+*          Once resized beyond the storage vector spills: it is copied out
+*          into memory obtained from @ref vector_alloc and stays on the heap from then on.
+*          All other vector functions work the same for inline and spilled vectors.
+* @warning Storage must be suitably aligned and outlive the vector while it is inline.
+*          Inline vector must not be relocated: a bytewise copy still refers to
+*          the original storage, use @ref vector_clone to copy it.
+*
+* @param[in] storage      Caller provided storage.
+* @param[in] storage_size Size of the storage in bytes, see @ref VECTOR_INLINE_SIZE.
+* @param[in] opts         Options according to which vector will be created,
+*                         @c initial_cap is ignored, capacity is whatever fits into storage.
+* @returns                Vector placed at the beginning of the storage.
+*/
+vector_t *vector_create_inline_(void *const storage, const size_t storage_size, const vector_opts_t *const opts);
+
+
+/**
+* @brief   Tells whether vector still lives in caller provided storage.
+* @see vector_create_inline_
+*
+* @param[in] vector Pointer to a vector instance.
+* @returns          @c true if vector was placed into storage and has not spilled yet.
+*/
+bool vector_is_inline(const vector_t *const vector);
+
+
 /**
 * @brief   Deallocates vector.
 *
 * A pointer will be invalidated after the call.
+* Vector that is still inline releases nothing, its storage belongs to the caller.
 *
 * @param[in] vector Vector pointer that will be deallocated.
 */
@@ -214,6 +304,21 @@ vector_t *vector_clone(const vector_t *const vector);
 */
 vector_status_t vector_resize(vector_t **const vector, const size_t capacity, const vector_status_t error);
 
+
+/**
+* @brief   Performs allocation resize, zero initializing grown elements.
+* @details Works as @ref vector_resize, but elements in a range [old capacity, capacity)
+*          are guaranteed to be zero after the call.
+*          Zeroing is delegated to @ref vector_realloc_zeroed, so allocators
+*          that obtain fresh zero pages do not touch the grown region at all.
+*
+* @param[in] vector   Reference to vectors pointer.
+* @param[in] capacity Desired vectors capacity.
+* @param[in] error    Extension feature, error status code that will be returned upon allocation failure.
+* @returns            Operation status.
+*/
+vector_status_t vector_resize_zeroed(vector_t **const vector, const size_t capacity, const vector_status_t error);
+
 /** @} @noop Lifetime */
 
 /**
@@ -463,6 +568,78 @@ void vector_part_copy(const vector_t *const vector,
 void vector_spread(vector_t *const vector, const size_t index, const size_t amount);
 
 
+/**
+* @brief   Sets elements in a range to a @c value.
+* @details Fills range [offset, offset + length) with copies of the @c value.
+*          Elements of 1, 2, 4, 8 and 16 bytes are broadcasted into
+*          vector registers and stored directly, other sizes are replicated
+*          by doubling copies of the already filled prefix.
+*          Ranges larger than @ref VECTOR_STREAM_THRESHOLD are written
+*          with non-temporal stores when supported by the target.
+*
+* @param[in] vector Pointer to a vector instance.
+* @param[in] offset Offset in @ref vector_t::element_size "elements" (begin index).
+* @param[in] length Size of the range in elements.
+* @param[in] value  Value to be stored across the range.
+*/
+void vector_fill_range(vector_t *const vector,
+        const size_t offset,
+        const size_t length,
+        const void *const value);
+
+
+/**
+* @brief   Sets elements in a range to a zero value.
+* @details Zeroes range [offset, offset + length).
+*          Ranges larger than @ref VECTOR_STREAM_THRESHOLD are written
+*          with non-temporal stores when supported by the target.
+*
+* @param[in] vector Pointer to a vector instance.
+* @param[in] offset Offset in @ref vector_t::element_size "elements" (begin index).
+* @param[in] length Size of the range in elements.
+*/
+void vector_zero_range(vector_t *const vector,
+        const size_t offset,
+        const size_t length);
+
+
+/**
+* @brief   Sets elements in a range to a zero value lazily.
+* @details Works as @ref vector_zero_range, but for ranges larger than
+*          @ref VECTOR_STREAM_THRESHOLD whole memory pages inside the range
+*          are handed back to the system and replaced with fresh zero pages
+*          on the next access, so nothing is written upfront.
+*          Falls back to @ref vector_zero_range on platforms other than Linux.
+* @warning Requires vector's memory to be private anonymous mapping,
+*          which is the case for the default allocator.
+*          Do not use with custom allocators backed by files or shared memory.
+*
+* @param[in] vector Pointer to a vector instance.
+* @param[in] offset Offset in @ref vector_t::element_size "elements" (begin index).
+* @param[in] length Size of the range in elements.
+*/
+void vector_zero_range_lazy(vector_t *const vector,
+        const size_t offset,
+        const size_t length);
+
+
+/**
+* @brief   Copy element range to other location bypassing the cache.
+* @details Works as @ref vector_copy, but ranges larger than @ref VECTOR_STREAM_THRESHOLD
+*          are written into @c dest with non-temporal stores when supported by the target.
+* @warning Regions must not overlap.
+*
+* @param[in]  vector Pointer to vector instance.
+* @param[out] dest   Destination pointer.
+* @param[in]  offset Offset in @ref vector_t::element_size "elements" (begin index).
+* @param[in]  length Size of the coping range in elements.
+*/
+void vector_stream_copy(const vector_t *const vector,
+        char *dest,
+        const size_t offset,
+        const size_t length);
+
+
 /**
 * @brief   Shift range of elements.
 * @details Shifting @c length elements at @c offset by @c shift times in direction of a sign.
@@ -480,6 +657,163 @@ void vector_shift(vector_t *const vector,
         const ssize_t shift);
 
 
+/**
+* @brief   Inserts batch of values at given positions in a single pass.
+* @details Treats first @c length elements as occupied and inserts @c count values,
+*          value @c i is placed before element that was at @c indices[i] prior to the call,
+*          so it ends up at index @c indices[i] + @c i .
+*          Every occupied element is moved at most once.
+  @verbatim
+  | A | B | C |   |   | length = 3
+  indices = {1, 3}, values = {X, Y}
+  | A | X | B | C | Y |
+  @endverbatim
+* @warning @c indices must be sorted in non-decreasing order.
+*
+* @param[in] vector  Pointer to vector instance.
+* @param[in] length  Amount of occupied elements, @c length + @c count must fit in capacity.
+* @param[in] indices Insert positions in range [0, length].
+* @param[in] values  Contiguous array of @c count values to be inserted.
+* @param[in] count   Amount of values to be inserted.
+*/
+void vector_insert_batch(vector_t *const vector,
+        const size_t length,
+        const size_t *const indices,
+        const void *const values,
+        const size_t count);
+
+
+/**
+* @brief   Inserts batch of values, resizing the vector if needed.
+* @details Works as @ref vector_insert_batch, but when @c capacity exceeds current one,
+*          vector is grown with @ref vector_resize first, so stateful allocators
+*          see an ordinary reallocation, then elements are scattered backward in place.
+*          Vector pointer is updated on success, remains untouched on failure.
+*
+* @param[in] vector   Reference to vectors pointer.
+* @param[in] capacity Desired capacity, not less than @c length + @c count.
+* @param[in] length   Amount of occupied elements.
+* @param[in] indices  Insert positions in range [0, length], sorted in non-decreasing order.
+* @param[in] values   Contiguous array of @c count values to be inserted.
+* @param[in] count    Amount of values to be inserted.
+* @param[in] error    Error status code that will be returned upon allocation failure.
+* @returns            Operation status.
+*/
+vector_status_t vector_resize_insert_batch(vector_t **const vector,
+        const size_t capacity,
+        const size_t length,
+        const size_t *const indices,
+        const void *const values,
+        const size_t count,
+        const vector_status_t error);
+
+
+/**
+* @brief   Erases elements at given positions in a single pass.
+* @details Treats first @c length elements as occupied, removes elements at @c indices
+*          and compacts the rest preserving their order.
+*          Every remaining element is moved at most once.
+* @warning @c indices must be sorted in strictly increasing order.
+*
+* @param[in] vector  Pointer to vector instance.
+* @param[in] length  Amount of occupied elements.
+* @param[in] indices Positions of elements to be erased in range [0, length).
+* @param[in] count   Amount of elements to be erased.
+* @returns           New amount of occupied elements.
+*/
+size_t vector_erase_batch(vector_t *const vector,
+        const size_t length,
+        const size_t *const indices,
+        const size_t count);
+
+
+/**
+* @brief   Removes elements matching predicate, compacting the rest.
+* @details Stream compaction of the first @c limit elements,
+*          order of remaining elements is preserved.
+*          Predicate is called exactly once per element in index order,
+*          consecutive runs of kept elements are moved at once.
+*
+* @param[in] vector    Pointer to a vector instance.
+* @param[in] limit     Amount of occupied elements to be processed.
+* @param[in] predicate Condition for element to be removed.
+* @param[in] param     User defined parameter, passed to @c predicate.
+* @returns             New amount of occupied elements.
+*/
+size_t vector_remove_if(vector_t *const vector,
+        const size_t limit,
+        const predicate_t predicate,
+        void *const param);
+
+
+/**
+* @brief   Removes elements whose fixed-width key field equals @c key.
+* @details Specialized stream compaction, e.g. sweeping tombstoned records
+*          whose 4 byte field at @c key_offset is zero.
+*          Compaction is branch free, vectors of plain 4 byte keys
+*          are compacted four at a time with SIMD compress tables when available.
+*
+* @param[in] vector     Pointer to a vector instance.
+* @param[in] limit      Amount of occupied elements to be processed.
+* @param[in] key_offset Offset of the key field inside an element in bytes.
+* @param[in] key_size   Size of the key field in bytes: 1, 2, 4 or 8.
+* @param[in] key        Pointer to a key value of elements to be removed.
+* @returns              New amount of occupied elements.
+*/
+size_t vector_remove_key(vector_t *const vector,
+        const size_t limit,
+        const size_t key_offset,
+        const size_t key_size,
+        const void *const key);
+
+
+/**
+* @brief   Removes adjacent equal elements, keeping first of each run.
+* @details Compacts the first @c limit elements in a single pass,
+*          on sorted input leaves distinct elements only.
+*          When @c cmp is @ref cmp_lex_asc or @ref cmp_lex_dsc elements are compared bytewise
+*          without calling back, elements of 1, 2, 4 and 8 bytes compared as a whole
+*          are compacted branch free.
+*
+* @param[in] vector Pointer to a vector instance.
+* @param[in] limit  Amount of occupied elements to be processed.
+* @param[in] cmp    Equality is zero result of comparison.
+* @param[in] param  User defined parameter, passed to @c cmp.
+* @returns          New amount of occupied elements.
+*/
+size_t vector_unique(vector_t *const vector,
+        const size_t limit,
+        const compare_t cmp,
+        void *const param);
+
+
+/**
+* @brief   Encodes runs of adjacent equal elements as (value, count) pairs.
+* @details Value of a run is its first element, pair @c i is stored
+*          at index @c i of @c values and @c counts respectively.
+*          Runs are encoded in a single pass, output vectors that are too small
+*          grow geometrically with @ref vector_resize, up to @c limit elements.
+*          Shares bytewise fast path with @ref vector_unique.
+*
+* @param[in]  vector Pointer to a vector instance.
+* @param[in]  limit  Amount of occupied elements to be processed.
+* @param[in]  cmp    Equality is zero result of comparison.
+* @param[in]  param  User defined parameter, passed to @c cmp.
+* @param[in]  values Reference to a vector of run values, same element size as @c vector.
+* @param[in]  counts Reference to a vector of @c size_t run lengths.
+* @param[out] runs   Amount of encoded runs.
+* @returns           @ref VECTOR_SUCCESS or @ref VECTOR_ALLOC_ERROR,
+*                    outputs stay valid then, but hold partial results.
+*/
+vector_status_t vector_run_length(const vector_t *const vector,
+        const size_t limit,
+        const compare_t cmp,
+        void *const param,
+        vector_t **const values,
+        vector_t **const counts,
+        size_t *const runs);
+
+
 /**
 * @brief Swaps values of elements designated by indicies.
 * @warning index_a should differ from index_b
@@ -545,6 +879,98 @@ int vector_transform(vector_t *const vector,
 
 /** @} @noop Elements */
 
+/**
+* @addtogroup Hashing
+* @brief Content hashing and equality of vectors. @{ */
+
+/**
+* @brief   Hashes range of elements.
+* @details Fast non-cryptographic 64-bit hash (wyhash family, 48 bytes per round).
+*          Ranges up to @ref VECTOR_HASH_CHUNK bytes are hashed as a whole,
+*          larger ones are split into chunks whose digests are combined by @ref vector_hash_fold.
+*          Value depends on bytes only, vectors with equal contents hash equally.
+*
+* @param[in] vector Pointer to a vector instance.
+* @param[in] offset Offset in @ref vector_t::element_size "elements" (begin index).
+* @param[in] length Amount of elements to be hashed.
+* @param[in] seed   Seed of the hash function.
+* @returns          Hash value.
+*/
+uint64_t vector_hash(const vector_t *const vector,
+        const size_t offset,
+        const size_t length,
+        const uint64_t seed);
+
+
+/**
+* @brief   Hashes range of elements into 128 bits.
+* @details Two independently seeded lanes of @ref vector_hash.
+* @see vector_hash
+*/
+vector_hash128_t vector_hash128(const vector_t *const vector,
+        const size_t offset,
+        const size_t length,
+        const uint64_t seed);
+
+
+/**
+* @brief   Hashes contiguous bytes, digest of a single chunk.
+*
+* @param[in] data Pointer to the bytes.
+* @param[in] size Amount of bytes.
+* @param[in] seed Seed of the hash function.
+* @returns        Hash value, same as @ref vector_hash of a range of @c size bytes
+*                 when @c size is not greater than @ref VECTOR_HASH_CHUNK.
+*/
+uint64_t vector_hash_bytes(const void *const data, const size_t size, const uint64_t seed);
+
+
+/**
+* @brief   Combines chunk digests into a hash of the whole range.
+* @details Digest @c i is @ref vector_hash_bytes of @ref VECTOR_HASH_CHUNK bytes
+*          starting at @c i * @ref VECTOR_HASH_CHUNK, last chunk may be shorter.
+*
+* @param[in] digests Chunk digests in order.
+* @param[in] count   Amount of chunks, @c size / @ref VECTOR_HASH_CHUNK rounded up, at least one.
+* @param[in] size    Size of the whole range in bytes.
+* @param[in] seed    Seed chunks were hashed with.
+* @returns           Same value as @ref vector_hash over the range.
+*/
+uint64_t vector_hash_fold(const uint64_t *const digests,
+        const size_t count,
+        const size_t size,
+        const uint64_t seed);
+
+
+/**
+* @brief   Tells whether two vectors hold equal contents.
+* @details Vectors of different element size or capacity are never equal,
+*          otherwise whole capacity is compared with wide SIMD compares when available.
+*
+* @param[in] a Pointer to a first vector instance.
+* @param[in] b Pointer to a second vector instance.
+* @returns     @c true if all elements are bytewise equal.
+*/
+bool vector_equal(const vector_t *const a, const vector_t *const b);
+
+
+/**
+* @brief   Finds first differing element in a range of two vectors.
+* @details Range [offset, offset + length) is compared bytewise with wide SIMD compares when available.
+*
+* @param[in] a      Pointer to a first vector instance.
+* @param[in] b      Pointer to a second vector instance of the same element size.
+* @param[in] offset Offset in @ref vector_t::element_size "elements" (begin index).
+* @param[in] length Amount of elements to be compared.
+* @returns          Index of the first differing element or @c -1 if ranges are equal.
+*/
+ssize_t vector_compare_range(const vector_t *const a,
+        const vector_t *const b,
+        const size_t offset,
+        const size_t length);
+
+/** @} @noop Hashing */
+
 /**
  * @addtogroup Allocation
  * @brief   Allocator functions.
@@ -563,6 +989,20 @@ int vector_transform(vector_t *const vector,
 void *vector_alloc(const size_t alloc_size, void *const param);
 
 
+/**
+ * @brief   Allocates zero initialized memory chunk of \a alloc_size.
+ * @details Used when @ref vector_opts_t::zero_init "zero_init" option is set.
+ *          Default implementation relies on @c calloc, which does not touch
+ *          fresh pages obtained from the system.
+ * @warning Override along with @ref vector_alloc when using custom allocator.
+ *
+ * @param[in]     alloc_size  Allocation size in bytes
+ * @param[in,out] param       Optional allocator parameter. @see alloc_opts_t
+ * @returns allocated memory chunk or @c NULL pointer on failure.
+ */
+void *vector_calloc(const size_t alloc_size, void *const param);
+
+
 /**
  * @brief   Reallocates already allocated memory chunk in order to change allocation size.
  * @warning This operation can move whole chunk to a completely different location.
@@ -575,6 +1015,23 @@ void *vector_alloc(const size_t alloc_size, void *const param);
 void *vector_realloc(void *ptr, const size_t alloc_size, void *const param);
 
 
+/**
+ * @brief   Reallocates memory chunk, zero initializing grown part of it.
+ * @details Used by @ref vector_resize_zeroed.
+ *          Default implementation calls @ref vector_realloc and zeroes
+ *          bytes in range [old_size, alloc_size), override it when allocator
+ *          already guarantees zeroed growth (e.g. @c mremap of anonymous mapping).
+ * @warning This operation can move whole chunk to a completely different location.
+ *
+ * @param[in]     ptr         Pointer to a memory chunk previously allocated with current allocator!
+ * @param[in]     old_size    Current allocation size in bytes
+ * @param[in]     alloc_size  Allocation size in bytes
+ * @param[in,out] param       Optional allocator parameter. @see alloc_opts_t
+ * @returns allocated memory chunk or @c NULL pointer on failure.
+ */
+void *vector_realloc_zeroed(void *ptr, const size_t old_size, const size_t alloc_size, void *const param);
+
+
 /**
 * @brief Free allocation that was previously allocated.
 *
@@ -613,6 +1070,181 @@ ssize_t cmp_lex_asc(const void *const value, const void *const element, void *co
 */
 ssize_t cmp_lex_dsc(const void *const value, const void *const element, void *const param);
 
+/**
+ * @addtogroup Comparators
+ * @brief      Comparators specialized for fixed key sizes.
+ * @details    Compared key occupies first bytes of an element, @c param is ignored.
+ *             Lexicographical ones order keys as @ref cmp_lex_asc does with
+ *             @c param of the key size, comparing big-endian words instead of calling @c memcmp.
+ *             Native ones compare keys as numbers of the host representation,
+ *             floating point NaNs are unordered (compare equal to anything).
+ *             Library functions taking @ref compare_t detect these by address
+ *             and inline comparison instead of calling through the pointer:
+ *             @ref vector_binary_find, @ref vector_binary_find_index,
+ *             @ref vector_unique and @ref vector_run_length. @{ */
+
+
+/**
+* @brief Lexicographical ascending order of 4 byte keys.
+*
+* @see compare_t
+*/
+ssize_t cmp_lex4_asc(const void *const value, const void *const element, void *const param);
+
+
+/**
+* @brief Lexicographical descending order of 4 byte keys.
+*
+* @see compare_t
+*/
+ssize_t cmp_lex4_dsc(const void *const value, const void *const element, void *const param);
+
+
+/**
+* @brief Lexicographical ascending order of 8 byte keys.
+*
+* @see compare_t
+*/
+ssize_t cmp_lex8_asc(const void *const value, const void *const element, void *const param);
+
+
+/**
+* @brief Lexicographical descending order of 8 byte keys.
+*
+* @see compare_t
+*/
+ssize_t cmp_lex8_dsc(const void *const value, const void *const element, void *const param);
+
+
+/**
+* @brief Lexicographical ascending order of 16 byte keys.
+*
+* @see compare_t
+*/
+ssize_t cmp_lex16_asc(const void *const value, const void *const element, void *const param);
+
+
+/**
+* @brief Lexicographical descending order of 16 byte keys.
+*
+* @see compare_t
+*/
+ssize_t cmp_lex16_dsc(const void *const value, const void *const element, void *const param);
+
+
+/**
+* @brief Lexicographical ascending order of 32 byte keys.
+*
+* @see compare_t
+*/
+ssize_t cmp_lex32_asc(const void *const value, const void *const element, void *const param);
+
+
+/**
+* @brief Lexicographical descending order of 32 byte keys.
+*
+* @see compare_t
+*/
+ssize_t cmp_lex32_dsc(const void *const value, const void *const element, void *const param);
+
+
+/**
+* @brief Ascending order of native @c uint32_t keys.
+*
+* @see compare_t
+*/
+ssize_t cmp_u32_asc(const void *const value, const void *const element, void *const param);
+
+
+/**
+* @brief Descending order of native @c uint32_t keys.
+*
+* @see compare_t
+*/
+ssize_t cmp_u32_dsc(const void *const value, const void *const element, void *const param);
+
+
+/**
+* @brief Ascending order of native @c uint64_t keys.
+*
+* @see compare_t
+*/
+ssize_t cmp_u64_asc(const void *const value, const void *const element, void *const param);
+
+
+/**
+* @brief Descending order of native @c uint64_t keys.
+*
+* @see compare_t
+*/
+ssize_t cmp_u64_dsc(const void *const value, const void *const element, void *const param);
+
+
+/**
+* @brief Ascending order of native @c int32_t keys.
+*
+* @see compare_t
+*/
+ssize_t cmp_i32_asc(const void *const value, const void *const element, void *const param);
+
+
+/**
+* @brief Descending order of native @c int32_t keys.
+*
+* @see compare_t
+*/
+ssize_t cmp_i32_dsc(const void *const value, const void *const element, void *const param);
+
+
+/**
+* @brief Ascending order of native @c int64_t keys.
+*
+* @see compare_t
+*/
+ssize_t cmp_i64_asc(const void *const value, const void *const element, void *const param);
+
+
+/**
+* @brief Descending order of native @c int64_t keys.
+*
+* @see compare_t
+*/
+ssize_t cmp_i64_dsc(const void *const value, const void *const element, void *const param);
+
+
+/**
+* @brief Ascending order of native @c float keys.
+*
+* @see compare_t
+*/
+ssize_t cmp_float_asc(const void *const value, const void *const element, void *const param);
+
+
+/**
+* @brief Descending order of native @c float keys.
+*
+* @see compare_t
+*/
+ssize_t cmp_float_dsc(const void *const value, const void *const element, void *const param);
+
+
+/**
+* @brief Ascending order of native @c double keys.
+*
+* @see compare_t
+*/
+ssize_t cmp_double_asc(const void *const value, const void *const element, void *const param);
+
+
+/**
+* @brief Descending order of native @c double keys.
+*
+* @see compare_t
+*/
+ssize_t cmp_double_dsc(const void *const value, const void *const element, void *const param);
+
+/** @} @noop Comparators */
+
 /** @} @noop Utilities */
 /** @} @noop Vector_API */
 
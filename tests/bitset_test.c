@@ -0,0 +1,168 @@
+#include <check.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../src/bitset.h"
+
+static bitset_t *bitset;
+
+static void setup_empty(void)
+{
+    bitset = bitset_create(.bits = 1000);
+    ck_assert_ptr_nonnull(bitset);
+}
+
+static void teardown(void)
+{
+    bitset_destroy(bitset);
+}
+
+
+START_TEST (test_bitset_create)
+{
+    ck_assert_uint_eq(bitset_size(bitset), 1000);
+    ck_assert_uint_eq(bitset_count(bitset), 0);
+    ck_assert_int_eq(bitset_find_first(bitset), -1);
+
+    bitset_t *empty = bitset_create();
+    ck_assert_uint_eq(bitset_size(empty), 0);
+    ck_assert_int_eq(bitset_find_first(empty), -1);
+    bitset_destroy(empty);
+}
+END_TEST
+
+
+START_TEST (test_bitset_set_test_clear)
+{
+    bitset_set(bitset, 0);
+    bitset_set(bitset, 63);
+    bitset_set(bitset, 64);
+    bitset_set(bitset, 999);
+    bitset_flip(bitset, 500);
+
+    ck_assert(bitset_test(bitset, 63));
+    ck_assert(bitset_test(bitset, 500));
+    ck_assert(!bitset_test(bitset, 62));
+    ck_assert_uint_eq(bitset_count(bitset), 5);
+
+    bitset_clear(bitset, 63);
+    bitset_flip(bitset, 500);
+    ck_assert(!bitset_test(bitset, 63));
+    ck_assert_uint_eq(bitset_count(bitset), 3);
+
+    bitset_fill(bitset, true);
+    ck_assert_uint_eq(bitset_count(bitset), 1000);
+    bitset_fill(bitset, false);
+    ck_assert_uint_eq(bitset_count(bitset), 0);
+}
+END_TEST
+
+
+START_TEST (test_bitset_iterate)
+{
+    for (size_t i = 3; i < 1000; i += 97)
+    {
+        bitset_set(bitset, i);
+    }
+
+    size_t expected = 3, visited = 0;
+    for (ssize_t i = bitset_find_first(bitset); i >= 0; i = bitset_find_next(bitset, i))
+    {
+        ck_assert_int_eq(i, expected);
+        expected += 97;
+        ++visited;
+    }
+    ck_assert_uint_eq(visited, bitset_count(bitset));
+    ck_assert_int_eq(bitset_find_next(bitset, 999), -1);
+}
+END_TEST
+
+
+START_TEST (test_bitset_ops)
+{
+    bitset_t *other = bitset_create(.bits = 1000);
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        if (i % 2 == 0) bitset_set(bitset, i);
+        if (i % 3 == 0) bitset_set(other, i);
+    }
+
+    bitset_t *tmp = bitset_create(.bits = 1000);
+
+    bitset_or(tmp, bitset);
+    bitset_and(tmp, other);
+    ck_assert_uint_eq(bitset_count(tmp), 167);  /* multiples of 6 */
+
+    bitset_fill(tmp, false);
+    bitset_or(tmp, bitset);
+    bitset_or(tmp, other);
+    ck_assert_uint_eq(bitset_count(tmp), 500 + 334 - 167);
+
+    bitset_xor(tmp, other);
+    ck_assert_uint_eq(bitset_count(tmp), 500 - 167);
+
+    bitset_fill(tmp, true);
+    bitset_andnot(tmp, bitset);
+    ck_assert_uint_eq(bitset_count(tmp), 500);
+    ck_assert(bitset_test(tmp, 999));
+    ck_assert(!bitset_test(tmp, 998));
+
+    bitset_destroy(tmp);
+    bitset_destroy(other);
+}
+END_TEST
+
+
+START_TEST (test_bitset_resize)
+{
+    bitset_fill(bitset, true);
+
+    ck_assert_int_eq(bitset_resize(&bitset, 70, VECTOR_ALLOC_ERROR), VECTOR_SUCCESS);
+    ck_assert_uint_eq(bitset_count(bitset), 70);
+
+    ck_assert_int_eq(bitset_resize(&bitset, 5000, VECTOR_ALLOC_ERROR), VECTOR_SUCCESS);
+    ck_assert_uint_eq(bitset_size(bitset), 5000);
+    ck_assert_uint_eq(bitset_count(bitset), 70);
+    ck_assert_int_eq(bitset_find_next(bitset, 69), -1);
+}
+END_TEST
+
+
+Suite *bitset_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Bitset");
+
+    /* Core test case */
+    tc_core = tcase_create("Core");
+
+    tcase_add_checked_fixture(tc_core, setup_empty, teardown);
+    tcase_add_test(tc_core, test_bitset_create);
+    tcase_add_test(tc_core, test_bitset_set_test_clear);
+    tcase_add_test(tc_core, test_bitset_iterate);
+    tcase_add_test(tc_core, test_bitset_ops);
+    tcase_add_test(tc_core, test_bitset_resize);
+
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+
+int main(void)
+{
+    int number_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = bitset_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
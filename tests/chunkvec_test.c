@@ -0,0 +1,140 @@
+#include <check.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../src/chunkvec.h"
+
+static chunkvec_t *chunkvec;
+
+static void setup_empty(void)
+{
+    chunkvec = chunkvec_create(
+       .element_size = sizeof(int),
+       .block_cap = 10
+    );
+    ck_assert_ptr_nonnull(chunkvec);
+}
+
+static void teardown(void)
+{
+    chunkvec_destroy(chunkvec);
+}
+
+
+static int sum_int(const void *const element, void *const acc, void *const param)
+{
+    (void) param;
+    *(long *) acc += *(const int *) element;
+    return 0;
+}
+
+
+static int negate_int(void *const element, void *const param)
+{
+    (void) param;
+    *(int *) element = -*(int *) element;
+    return 0;
+}
+
+
+static int stop_at(const void *const element, void *const param)
+{
+    return *(const int *) element == *(const int *) param;
+}
+
+
+START_TEST (test_chunkvec_create)
+{
+    ck_assert_uint_eq(chunkvec_capacity(chunkvec), 0);
+    ck_assert_uint_eq(chunkvec_block_cap(chunkvec), 16);
+
+    chunkvec_t *c = chunkvec_create(.element_size = 1, .initial_cap = 5000);
+    ck_assert_uint_eq(chunkvec_capacity(c), 8192);
+    chunkvec_destroy(c);
+}
+END_TEST
+
+
+START_TEST (test_chunkvec_resize)
+{
+    ck_assert_int_eq(chunkvec_resize(&chunkvec, 100, VECTOR_ALLOC_ERROR), VECTOR_SUCCESS);
+    ck_assert_uint_eq(chunkvec_capacity(chunkvec), 112);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        chunkvec_set(chunkvec, i, &i);
+    }
+    int *first = chunkvec_get(chunkvec, 0);
+
+    /* growth never moves existing elements */
+    ck_assert_int_eq(chunkvec_resize(&chunkvec, 1000, VECTOR_ALLOC_ERROR), VECTOR_SUCCESS);
+    ck_assert_ptr_eq(first, chunkvec_get(chunkvec, 0));
+    ck_assert_int_eq(*(int *) chunkvec_get(chunkvec, 99), 99);
+    ck_assert_int_eq(*(int *) vector_get(chunkvec_block(chunkvec, 6), 3), 99);
+
+    ck_assert_int_eq(chunkvec_resize(&chunkvec, 17, VECTOR_ALLOC_ERROR), VECTOR_SUCCESS);
+    ck_assert_uint_eq(chunkvec_capacity(chunkvec), 32);
+    ck_assert_int_eq(*(int *) chunkvec_get(chunkvec, 31), 31);
+}
+END_TEST
+
+
+START_TEST (test_chunkvec_iterate)
+{
+    chunkvec_resize(&chunkvec, 100, VECTOR_ALLOC_ERROR);
+    for (int i = 0; i < 100; ++i)
+    {
+        chunkvec_set(chunkvec, i, &i);
+    }
+
+    long sum = 0;
+    ck_assert_int_eq(chunkvec_aggregate(chunkvec, 50, sum_int, &sum, NULL), 0);
+    ck_assert_int_eq(sum, 49 * 50 / 2);
+
+    ck_assert_int_eq(chunkvec_transform(chunkvec, 100, negate_int, NULL), 0);
+    sum = 0;
+    chunkvec_aggregate(chunkvec, 100, sum_int, &sum, NULL);
+    ck_assert_int_eq(sum, -99 * 100 / 2);
+
+    ck_assert_int_eq(chunkvec_foreach(chunkvec, 100, stop_at, TMP_REF(int, -40)), 1);
+    ck_assert_int_eq(chunkvec_foreach(chunkvec, 40, stop_at, TMP_REF(int, -40)), 0);
+}
+END_TEST
+
+
+Suite *chunkvec_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Chunked Vector");
+
+    /* Core test case */
+    tc_core = tcase_create("Core");
+
+    tcase_add_checked_fixture(tc_core, setup_empty, teardown);
+    tcase_add_test(tc_core, test_chunkvec_create);
+    tcase_add_test(tc_core, test_chunkvec_resize);
+    tcase_add_test(tc_core, test_chunkvec_iterate);
+
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+
+int main(void)
+{
+    int number_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = chunkvec_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
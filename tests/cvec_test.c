@@ -0,0 +1,179 @@
+#include <check.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../src/cvec.h"
+
+#define THREADS 4
+#define RECORDS 5000
+
+static cvec_t *cvec;
+static bool fail_alloc;
+
+
+void *vector_alloc(const size_t alloc_size, void *const param)
+{
+    (void) param;
+    return fail_alloc ? NULL : malloc(alloc_size);
+}
+
+static void setup_empty(void)
+{
+    cvec = cvec_create(
+       .element_size = sizeof(long),
+       .segment_cap = 4
+    );
+    ck_assert_ptr_nonnull(cvec);
+}
+
+static void teardown(void)
+{
+    cvec_destroy(cvec);
+}
+
+
+static int sum_long(const void *const element, void *const param)
+{
+    *(long *) param += *(const long *) element;
+    return 0;
+}
+
+
+START_TEST (test_cvec_create)
+{
+    ck_assert_uint_eq(cvec_size(cvec), 0);
+    ck_assert_ptr_null(cvec_get(cvec, 0));
+    ck_assert_ptr_null(cvec_get(cvec, (size_t) -1));
+}
+END_TEST
+
+
+START_TEST (test_cvec_append)
+{
+    const long *first = NULL;
+    for (long i = 0; i < 100; ++i)
+    {
+        size_t index;
+        ck_assert_int_eq(cvec_append(cvec, &i, &index), CVEC_SUCCESS);
+        ck_assert_uint_eq(index, i);
+        if (!first) first = cvec_get(cvec, 0);
+    }
+
+    ck_assert_uint_eq(cvec_size(cvec), 100);
+    for (long i = 0; i < 100; ++i)
+    {
+        ck_assert_int_eq(*(long *) cvec_get(cvec, i), i);
+    }
+
+    /* addresses are stable across segment growth */
+    ck_assert_ptr_eq(first, cvec_get(cvec, 0));
+    ck_assert_ptr_null(cvec_get(cvec, 100));
+
+    long sum = 0;
+    ck_assert_int_eq(cvec_foreach(cvec, sum_long, &sum), 0);
+    ck_assert_int_eq(sum, 99 * 100 / 2);
+}
+END_TEST
+
+
+static void *append_records(void *param)
+{
+    const long base = *(const long *) param;
+    for (long i = 0; i < RECORDS; ++i)
+    {
+        const long value = base + i;
+        ck_assert_int_eq(cvec_append(cvec, &value, NULL), CVEC_SUCCESS);
+    }
+    return NULL;
+}
+
+
+START_TEST (test_cvec_alloc_error)
+{
+    for (long i = 0; i < 4; ++i)
+    {
+        ck_assert_int_eq(cvec_append(cvec, &i, NULL), CVEC_SUCCESS);
+    }
+
+    /* next append needs a new segment */
+    fail_alloc = true;
+    ck_assert_int_eq(cvec_append(cvec, TMP_REF(long, 100), NULL), CVEC_ALLOC_ERROR);
+    fail_alloc = false;
+    ck_assert_uint_eq(cvec_size(cvec), 4);
+
+    size_t index;
+    ck_assert_int_eq(cvec_append(cvec, TMP_REF(long, 4), &index), CVEC_SUCCESS);
+    ck_assert_uint_eq(index, 4);
+
+    long sum = 0;
+    ck_assert_int_eq(cvec_foreach(cvec, sum_long, &sum), 0);
+    ck_assert_int_eq(sum, 0 + 1 + 2 + 3 + 4);
+}
+END_TEST
+
+
+START_TEST (test_cvec_threads)
+{
+    pthread_t threads[THREADS];
+    long bases[THREADS];
+
+    for (int t = 0; t < THREADS; ++t)
+    {
+        bases[t] = (long) t * RECORDS;
+        pthread_create(&threads[t], NULL, append_records, &bases[t]);
+    }
+
+    for (int t = 0; t < THREADS; ++t)
+    {
+        pthread_join(threads[t], NULL);
+    }
+
+    const long total = (long) THREADS * RECORDS;
+    ck_assert_uint_eq(cvec_size(cvec), total);
+
+    long sum = 0;
+    ck_assert_int_eq(cvec_foreach(cvec, sum_long, &sum), 0);
+    ck_assert_int_eq(sum, (total - 1) * total / 2);
+}
+END_TEST
+
+
+Suite *cvec_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Concurrent Vector");
+
+    /* Core test case */
+    tc_core = tcase_create("Core");
+
+    tcase_add_checked_fixture(tc_core, setup_empty, teardown);
+    tcase_add_test(tc_core, test_cvec_create);
+    tcase_add_test(tc_core, test_cvec_append);
+    tcase_add_test(tc_core, test_cvec_alloc_error);
+    tcase_add_test(tc_core, test_cvec_threads);
+
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+
+int main(void)
+{
+    int number_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = cvec_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
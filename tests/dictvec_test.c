@@ -0,0 +1,175 @@
+#include <check.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../src/dictvec.h"
+
+typedef struct record_t
+{
+    char name[24];
+    int kind;
+    int weight;
+}
+record_t;
+
+static dictvec_t *dictvec;
+
+static void setup_empty(void)
+{
+    dictvec = dictvec_create(
+       .element_size = sizeof(record_t),
+       .code_size = 1,
+       .initial_cap = 1000
+    );
+    ck_assert_ptr_nonnull(dictvec);
+}
+
+static void teardown(void)
+{
+    dictvec_destroy(dictvec);
+}
+
+
+static record_t make_record(const int kind)
+{
+    record_t record = {.kind = kind, .weight = kind * 10};
+    snprintf(record.name, sizeof(record.name), "kind-%d", kind);
+    return record;
+}
+
+
+static bool is_heavy(const void *const element, void *const param)
+{
+    ++*(size_t *) param;
+    return ((const record_t *) element)->weight >= 50;
+}
+
+
+static int sum_kind(const void *const element, void *const param)
+{
+    *(long *) param += ((const record_t *) element)->kind;
+    return 0;
+}
+
+
+START_TEST (test_dictvec_create)
+{
+    ck_assert_uint_eq(dictvec_capacity(dictvec), 1000);
+    ck_assert_uint_eq(dictvec_cardinality(dictvec), 1);
+
+    const record_t *record = dictvec_get(dictvec, 999);
+    ck_assert_int_eq(record->kind, 0);
+    ck_assert_str_eq(record->name, "");
+}
+END_TEST
+
+
+START_TEST (test_dictvec_set_get)
+{
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        const record_t record = make_record((int) (i % 7) + 1);
+        ck_assert_int_eq(dictvec_set(dictvec, i, &record), DICTVEC_SUCCESS);
+    }
+
+    /* zero value plus seven kinds */
+    ck_assert_uint_eq(dictvec_cardinality(dictvec), 8);
+    ck_assert_str_eq(((const record_t *) dictvec_get(dictvec, 15))->name, "kind-2");
+
+    /* equal values share dictionary entry */
+    ck_assert_ptr_eq(dictvec_get(dictvec, 1), dictvec_get(dictvec, 8));
+    ck_assert_uint_eq(dictvec_code(dictvec, 1), dictvec_code(dictvec, 8));
+
+    long sum = 0;
+    ck_assert_int_eq(dictvec_foreach(dictvec, 14, sum_kind, &sum), 0);
+    ck_assert_int_eq(sum, 2 * (1 + 2 + 3 + 4 + 5 + 6 + 7));
+}
+END_TEST
+
+
+START_TEST (test_dictvec_filter)
+{
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        const record_t record = make_record((int) (i % 7) + 1);
+        dictvec_set(dictvec, i, &record);
+    }
+
+    size_t calls = 0;
+    size_t indices[1000];
+    const size_t count = dictvec_filter(dictvec, 1000, is_heavy, &calls, indices);
+
+    /* predicate is evaluated per distinct value only */
+    ck_assert_uint_eq(calls, 8);
+    ck_assert_uint_eq(count, 143 + 143 + 142);
+    ck_assert_uint_eq(indices[0], 4);
+    for (size_t i = 0; i < count; ++i)
+    {
+        ck_assert_int_ge(((const record_t *) dictvec_get(dictvec, indices[i]))->weight, 50);
+    }
+
+    calls = 0;
+    ck_assert_uint_eq(dictvec_filter(dictvec, 10, is_heavy, &calls, NULL), 3);
+}
+END_TEST
+
+
+START_TEST (test_dictvec_full)
+{
+    record_t record = {0};
+    for (int kind = 1; kind < 256; ++kind)
+    {
+        record = make_record(kind);
+        ck_assert_int_eq(dictvec_set(dictvec, kind, &record), DICTVEC_SUCCESS);
+    }
+    ck_assert_uint_eq(dictvec_cardinality(dictvec), 256);
+
+    record = make_record(1000);
+    ck_assert_int_eq(dictvec_set(dictvec, 0, &record), DICTVEC_FULL);
+    ck_assert_int_eq(((const record_t *) dictvec_get(dictvec, 0))->kind, 0);
+
+    ck_assert_int_eq(dictvec_resize(&dictvec, 2000, VECTOR_ALLOC_ERROR), VECTOR_SUCCESS);
+    ck_assert_int_eq(((const record_t *) dictvec_get(dictvec, 1999))->kind, 0);
+    ck_assert_int_eq(((const record_t *) dictvec_get(dictvec, 255))->kind, 255);
+}
+END_TEST
+
+
+Suite *dictvec_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Dictionary Vector");
+
+    /* Core test case */
+    tc_core = tcase_create("Core");
+
+    tcase_add_checked_fixture(tc_core, setup_empty, teardown);
+    tcase_add_test(tc_core, test_dictvec_create);
+    tcase_add_test(tc_core, test_dictvec_set_get);
+    tcase_add_test(tc_core, test_dictvec_filter);
+    tcase_add_test(tc_core, test_dictvec_full);
+
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+
+int main(void)
+{
+    int number_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = dictvec_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,120 @@
+#include <check.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../src/digest.h"
+
+#define BIG_LENGTH (VECTOR_HASH_CHUNK + VECTOR_HASH_CHUNK / 2) // of uint32_t, six chunks
+
+static vector_t *vector;
+
+static void setup_empty(void)
+{
+    vector = vector_create(.element_size = sizeof(uint32_t), .initial_cap = BIG_LENGTH);
+    ck_assert_ptr_nonnull(vector);
+
+    for (size_t i = 0; i < BIG_LENGTH; ++i)
+    {
+        *(uint32_t*) vector_get(vector, i) = (uint32_t) (i * 2654435761u);
+    }
+}
+
+static void teardown(void)
+{
+    vector_destroy(vector);
+}
+
+
+START_TEST (test_digest_small)
+{
+    digest_t *digest = digest_create(.vector = vector, .length = 100, .seed = 9);
+    ck_assert_ptr_nonnull(digest);
+    ck_assert_uint_eq(digest_chunks(digest), 1);
+    ck_assert_uint_eq(digest_value(digest), vector_hash(vector, 0, 100, 9));
+
+    *(uint32_t*) vector_get(vector, 50) += 1;
+    ck_assert_uint_eq(digest_update(digest, vector, 50, 1), vector_hash(vector, 0, 100, 9));
+    digest_destroy(digest);
+
+    digest = digest_create(.vector = vector, .length = 0);
+    ck_assert_ptr_nonnull(digest);
+    ck_assert_uint_eq(digest_value(digest), vector_hash(vector, 0, 0, 0));
+    digest_destroy(digest);
+}
+END_TEST
+
+
+START_TEST (test_digest_threads)
+{
+    const uint64_t expected = vector_hash(vector, 0, BIG_LENGTH, 3);
+
+    for (size_t threads = 1; threads <= 8; threads *= 2)
+    {
+        digest_t *digest = digest_create(.vector = vector, .length = BIG_LENGTH, .seed = 3, .threads = threads);
+        ck_assert_ptr_nonnull(digest);
+        ck_assert_uint_eq(digest_chunks(digest), 6);
+        ck_assert_uint_eq(digest_value(digest), expected);
+        digest_destroy(digest);
+    }
+}
+END_TEST
+
+
+START_TEST (test_digest_update)
+{
+    digest_t *digest = digest_create(.vector = vector, .length = BIG_LENGTH, .threads = 4);
+    ck_assert_ptr_nonnull(digest);
+
+    /* edit straddles a chunk boundary */
+    const size_t boundary = VECTOR_HASH_CHUNK / sizeof(uint32_t);
+    for (size_t i = boundary - 2; i < boundary + 2; ++i) *(uint32_t*) vector_get(vector, i) = 0;
+
+    ck_assert_uint_eq(digest_update(digest, vector, boundary - 2, 4), vector_hash(vector, 0, BIG_LENGTH, 0));
+
+    *(uint32_t*) vector_get(vector, BIG_LENGTH - 1) = 42;
+    ck_assert_uint_eq(digest_update(digest, vector, BIG_LENGTH - 1, 1), vector_hash(vector, 0, BIG_LENGTH, 0));
+
+    /* empty update keeps the value */
+    ck_assert_uint_eq(digest_update(digest, vector, 0, 0), digest_value(digest));
+    digest_destroy(digest);
+}
+END_TEST
+
+
+Suite *digest_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Digest");
+
+    /* Core test case */
+    tc_core = tcase_create("Core");
+
+    tcase_add_checked_fixture(tc_core, setup_empty, teardown);
+    tcase_add_test(tc_core, test_digest_small);
+    tcase_add_test(tc_core, test_digest_threads);
+    tcase_add_test(tc_core, test_digest_update);
+
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+
+int main(void)
+{
+    int number_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = digest_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
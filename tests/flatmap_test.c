@@ -0,0 +1,210 @@
+#include <check.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../src/flatmap.h"
+
+static flatmap_t *map;
+
+static ssize_t cmp_int(const void *const value, const void *const element, void *const param)
+{
+    (void) param;
+    const int a = *(const int *) value;
+    const int b = *(const int *) element;
+    return (a > b) - (a < b);
+}
+
+static void setup_empty(void)
+{
+    map = flatmap_create(
+       .key_size = sizeof(int),
+       .value_size = sizeof(double),
+       .cmp = cmp_int,
+       .initial_cap = 4,
+       .stage_cap = 8
+    );
+    ck_assert_ptr_nonnull(map);
+}
+
+static void teardown(void)
+{
+    flatmap_destroy(map);
+}
+
+
+typedef struct order_t
+{
+    const flatmap_t *map;
+    int prev;
+    size_t count;
+}
+order_t;
+
+static int check_order(const void *const entry, void *const param)
+{
+    order_t *order = param;
+    const int key = *(const int *) entry;
+
+    if (order->count && key <= order->prev) return 1;
+    if (*(double *) flatmap_value(order->map, entry) != key * 0.5) return 2;
+
+    order->prev = key;
+    ++order->count;
+    return 0;
+}
+
+
+START_TEST (test_flatmap_create)
+{
+    ck_assert_uint_eq(flatmap_size(map), 0);
+    ck_assert_ptr_null(flatmap_get(map, TMP_REF(int, 1)));
+    ck_assert(!flatmap_remove(map, TMP_REF(int, 1)));
+    ck_assert_int_eq(flatmap_flush(&map), FLATMAP_SUCCESS);
+}
+END_TEST
+
+
+START_TEST (test_flatmap_insert_get)
+{
+    for (int i = 0; i < 1000; ++i)
+    {
+        const int key = (i * 389) % 1000;
+        ck_assert_int_eq(flatmap_insert(&map, &key, TMP_REF(double, key * 0.5)), FLATMAP_SUCCESS);
+    }
+    ck_assert_uint_eq(flatmap_size(map), 1000);
+
+    for (int key = 0; key < 1000; ++key)
+    {
+        const double *value = flatmap_get(map, &key);
+        ck_assert_ptr_nonnull(value);
+        ck_assert(*value == key * 0.5);
+    }
+    ck_assert_ptr_null(flatmap_get(map, TMP_REF(int, 1000)));
+
+    order_t order = {.map = map};
+    ck_assert_int_eq(flatmap_foreach(map, check_order, &order), 0);
+    ck_assert_uint_eq(order.count, 1000);
+}
+END_TEST
+
+
+START_TEST (test_flatmap_overwrite)
+{
+    /* one key in the body, one in the staging area */
+    for (int key = 0; key < 9; ++key)
+    {
+        flatmap_insert(&map, &key, TMP_REF(double, 0.0));
+    }
+
+    flatmap_insert(&map, TMP_REF(int, 0), TMP_REF(double, 1.0));
+    flatmap_insert(&map, TMP_REF(int, 8), TMP_REF(double, 2.0));
+    ck_assert_uint_eq(flatmap_size(map), 9);
+    ck_assert(*(double *) flatmap_get(map, TMP_REF(int, 0)) == 1.0);
+    ck_assert(*(double *) flatmap_get(map, TMP_REF(int, 8)) == 2.0);
+}
+END_TEST
+
+
+START_TEST (test_flatmap_remove)
+{
+    for (int key = 0; key < 20; ++key)
+    {
+        flatmap_insert(&map, &key, TMP_REF(double, key * 0.5));
+    }
+
+    ck_assert(flatmap_remove(map, TMP_REF(int, 19)));
+    ck_assert(flatmap_remove(map, TMP_REF(int, 0)));
+    ck_assert(flatmap_remove(map, TMP_REF(int, 10)));
+    ck_assert(!flatmap_remove(map, TMP_REF(int, 10)));
+    ck_assert_uint_eq(flatmap_size(map), 17);
+    ck_assert_ptr_null(flatmap_get(map, TMP_REF(int, 10)));
+
+    ck_assert_int_eq(flatmap_flush(&map), FLATMAP_SUCCESS);
+    order_t order = {.map = map};
+    ck_assert_int_eq(flatmap_foreach(map, check_order, &order), 0);
+    ck_assert_uint_eq(order.count, 17);
+}
+END_TEST
+
+
+START_TEST (test_flatmap_staged_order)
+{
+    /* descending keys leave the staging area in reverse order */
+    for (int key = 12; key >= 0; --key)
+    {
+        flatmap_insert(&map, &key, TMP_REF(double, key * 0.5));
+    }
+
+    ck_assert(flatmap_remove(map, TMP_REF(int, 2)));
+    ck_assert_ptr_null(flatmap_get(map, TMP_REF(int, 2)));
+    ck_assert(*(double *) flatmap_get(map, TMP_REF(int, 1)) == 0.5);
+
+    order_t order = {.map = map};
+    ck_assert_int_eq(flatmap_foreach(map, check_order, &order), 0);
+    ck_assert_uint_eq(order.count, 12);
+
+    ck_assert_int_eq(flatmap_flush(&map), FLATMAP_SUCCESS);
+    order = (order_t) {.map = map};
+    ck_assert_int_eq(flatmap_foreach(map, check_order, &order), 0);
+    ck_assert_uint_eq(order.count, 12);
+}
+END_TEST
+
+
+START_TEST (test_flatmap_default_cmp)
+{
+    flatmap_t *m = flatmap_create(.key_size = 3, .value_size = 0);
+    ck_assert_ptr_nonnull(m);
+
+    ck_assert_int_eq(flatmap_insert(&m, "abc", NULL), FLATMAP_SUCCESS);
+    ck_assert_int_eq(flatmap_insert(&m, "abb", NULL), FLATMAP_SUCCESS);
+    ck_assert_int_eq(flatmap_insert(&m, "abb", NULL), FLATMAP_SUCCESS);
+    ck_assert_int_eq(flatmap_flush(&m), FLATMAP_SUCCESS);
+    ck_assert_int_eq(flatmap_insert(&m, "abc", NULL), FLATMAP_SUCCESS);
+    ck_assert_uint_eq(flatmap_size(m), 2);
+    ck_assert_ptr_nonnull(flatmap_get(m, "abb"));
+    ck_assert_ptr_null(flatmap_get(m, "abd"));
+    flatmap_destroy(m);
+}
+END_TEST
+
+
+Suite *flatmap_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Flat Map");
+
+    /* Core test case */
+    tc_core = tcase_create("Core");
+
+    tcase_add_checked_fixture(tc_core, setup_empty, teardown);
+    tcase_add_test(tc_core, test_flatmap_create);
+    tcase_add_test(tc_core, test_flatmap_insert_get);
+    tcase_add_test(tc_core, test_flatmap_overwrite);
+    tcase_add_test(tc_core, test_flatmap_remove);
+    tcase_add_test(tc_core, test_flatmap_staged_order);
+    tcase_add_test(tc_core, test_flatmap_default_cmp);
+
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+
+int main(void)
+{
+    int number_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = flatmap_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
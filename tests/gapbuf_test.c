@@ -0,0 +1,175 @@
+#include <check.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../src/gapbuf.h"
+
+static gapbuf_t *gapbuf;
+
+static void setup_empty(void)
+{
+    gapbuf = gapbuf_create(.element_size = sizeof(char), .initial_cap = 4);
+    ck_assert_ptr_nonnull(gapbuf);
+}
+
+static void teardown(void)
+{
+    gapbuf_destroy(gapbuf);
+}
+
+
+static void assert_contents(const char *const expected)
+{
+    const size_t length = strlen(expected);
+    char buffer[256] = {0};
+
+    ck_assert_uint_eq(gapbuf_length(gapbuf), length);
+    gapbuf_copy(gapbuf, buffer, 0, length);
+    ck_assert_str_eq(buffer, expected);
+}
+
+
+static int append_char(const void *const element, void *const param)
+{
+    char *out = param;
+    out[strlen(out)] = *(const char *) element;
+    return 0;
+}
+
+
+START_TEST (test_gapbuf_create)
+{
+    ck_assert_uint_eq(gapbuf_length(gapbuf), 0);
+    ck_assert_uint_eq(gapbuf_cursor(gapbuf), 0);
+}
+END_TEST
+
+
+START_TEST (test_gapbuf_insert_move)
+{
+    ck_assert_int_eq(gapbuf_insert(&gapbuf, "hello", 5), GAPBUF_SUCCESS);
+    ck_assert_uint_eq(gapbuf_cursor(gapbuf), 5);
+    assert_contents("hello");
+
+    gapbuf_move(gapbuf, 0);
+    ck_assert_int_eq(gapbuf_insert(&gapbuf, ">", 1), GAPBUF_SUCCESS);
+    assert_contents(">hello");
+
+    gapbuf_move(gapbuf, 3);
+    for (const char *c = "LLLLLLLLLLLLLLLLLLLL"; *c; ++c)
+    {
+        ck_assert_int_eq(gapbuf_insert(&gapbuf, c, 1), GAPBUF_SUCCESS);
+    }
+    assert_contents(">heLLLLLLLLLLLLLLLLLLLLllo");
+    ck_assert_int_eq(*(char *) gapbuf_get(gapbuf, 2), 'e');
+    ck_assert_int_eq(*(char *) gapbuf_get(gapbuf, 23), 'l');
+
+    gapbuf_move(gapbuf, gapbuf_length(gapbuf));
+    ck_assert_int_eq(gapbuf_insert(&gapbuf, "!", 1), GAPBUF_SUCCESS);
+    assert_contents(">heLLLLLLLLLLLLLLLLLLLLllo!");
+
+    char partial[8] = {0};
+    gapbuf_move(gapbuf, 10);
+    gapbuf_copy(gapbuf, partial, 21, 5);
+    ck_assert_str_eq(partial, "LLllo");
+}
+END_TEST
+
+
+START_TEST (test_gapbuf_erase)
+{
+    ck_assert_int_eq(gapbuf_insert(&gapbuf, "abcdefgh", 8), GAPBUF_SUCCESS);
+
+    gapbuf_move(gapbuf, 4);
+    gapbuf_erase_before(gapbuf, 2);
+    ck_assert_uint_eq(gapbuf_cursor(gapbuf), 2);
+    assert_contents("abefgh");
+
+    gapbuf_erase_after(gapbuf, 3);
+    assert_contents("abh");
+
+    ck_assert_int_eq(gapbuf_insert(&gapbuf, "XY", 2), GAPBUF_SUCCESS);
+    assert_contents("abXYh");
+
+    char out[16] = {0};
+    ck_assert_int_eq(gapbuf_foreach(gapbuf, append_char, out), 0);
+    ck_assert_str_eq(out, "abXYh");
+}
+END_TEST
+
+
+START_TEST (test_gapbuf_random_edits)
+{
+    char model[256] = {0};
+    size_t length = 0;
+    srand(7);
+
+    for (int step = 0; step < 2000; ++step)
+    {
+        const size_t position = length ? (size_t) rand() % (length + 1) : 0;
+        gapbuf_move(gapbuf, position);
+
+        if (length < 200 && (rand() % 3 || !length))
+        {
+            const char c = (char) ('a' + rand() % 26);
+            ck_assert_int_eq(gapbuf_insert(&gapbuf, &c, 1), GAPBUF_SUCCESS);
+            memmove(model + position + 1, model + position, length - position);
+            model[position] = c;
+            ++length;
+        }
+        else if (position < length)
+        {
+            gapbuf_erase_after(gapbuf, 1);
+            memmove(model + position, model + position + 1, length - position - 1);
+            model[--length] = '\0';
+        }
+        else
+        {
+            gapbuf_erase_before(gapbuf, 1);
+            model[--length] = '\0';
+        }
+    }
+
+    assert_contents(model);
+}
+END_TEST
+
+
+Suite *gapbuf_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Gap Buffer");
+
+    /* Core test case */
+    tc_core = tcase_create("Core");
+
+    tcase_add_checked_fixture(tc_core, setup_empty, teardown);
+    tcase_add_test(tc_core, test_gapbuf_create);
+    tcase_add_test(tc_core, test_gapbuf_insert_move);
+    tcase_add_test(tc_core, test_gapbuf_erase);
+    tcase_add_test(tc_core, test_gapbuf_random_edits);
+
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+
+int main(void)
+{
+    int number_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = gapbuf_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
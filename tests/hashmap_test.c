@@ -0,0 +1,205 @@
+#include <check.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../src/hashmap.h"
+
+static hashmap_t *map;
+
+static void setup_empty(void)
+{
+    map = hashmap_create(
+       .key_size = sizeof(int),
+       .value_size = sizeof(long)
+    );
+    ck_assert_ptr_nonnull(map);
+}
+
+static void teardown(void)
+{
+    hashmap_destroy(map);
+}
+
+
+static size_t hash_constant(const void *const key, void *const param)
+{
+    (void) key;
+    (void) param;
+    return 42;
+}
+
+
+static int sum_values(const void *const entry, void *const param)
+{
+    *(long *) param += *(long *) hashmap_value(map, entry);
+    return 0;
+}
+
+
+START_TEST (test_hashmap_create)
+{
+    ck_assert_uint_eq(hashmap_size(map), 0);
+    ck_assert_uint_eq(hashmap_capacity(map), 16);
+    ck_assert_ptr_null(hashmap_get(map, TMP_REF(int, 1)));
+    ck_assert(!hashmap_remove(map, TMP_REF(int, 1)));
+}
+END_TEST
+
+
+START_TEST (test_hashmap_insert_get)
+{
+    for (int key = 0; key < 1000; ++key)
+    {
+        ck_assert_int_eq(hashmap_insert(&map, &key, TMP_REF(long, key * 2L)), HASHMAP_SUCCESS);
+    }
+    ck_assert_uint_eq(hashmap_size(map), 1000);
+    ck_assert_uint_ge(hashmap_capacity(map) - hashmap_capacity(map) / 8, 1000);
+
+    for (int key = 0; key < 1000; ++key)
+    {
+        const long *value = hashmap_get(map, &key);
+        ck_assert_ptr_nonnull(value);
+        ck_assert_int_eq(*value, key * 2L);
+    }
+    ck_assert_ptr_null(hashmap_get(map, TMP_REF(int, 1000)));
+
+    /* overwrite keeps size */
+    hashmap_insert(&map, TMP_REF(int, 7), TMP_REF(long, -1));
+    ck_assert_uint_eq(hashmap_size(map), 1000);
+    ck_assert_int_eq(*(long *) hashmap_get(map, TMP_REF(int, 7)), -1);
+
+    long sum = 0;
+    ck_assert_int_eq(hashmap_foreach(map, sum_values, &sum), 0);
+    ck_assert_int_eq(sum, 999L * 1000 - 14 - 1);
+}
+END_TEST
+
+
+START_TEST (test_hashmap_remove_churn)
+{
+    /* sliding window of live keys leaves plenty of tombstones behind */
+    for (int key = 0; key < 5000; ++key)
+    {
+        ck_assert_int_eq(hashmap_insert(&map, &key, TMP_REF(long, key)), HASHMAP_SUCCESS);
+        if (key >= 10)
+        {
+            ck_assert(hashmap_remove(map, TMP_REF(int, key - 10)));
+        }
+    }
+
+    ck_assert_uint_eq(hashmap_size(map), 10);
+    ck_assert_uint_le(hashmap_capacity(map), 64);
+
+    for (int key = 0; key < 5000; ++key)
+    {
+        const long *value = hashmap_get(map, &key);
+        if (key < 4990) ck_assert_ptr_null(value);
+        else ck_assert_int_eq(*value, key);
+    }
+}
+END_TEST
+
+
+START_TEST (test_hashmap_collisions)
+{
+    hashmap_t *m = hashmap_create(.key_size = sizeof(int), .value_size = sizeof(long), .hash = hash_constant);
+    ck_assert_ptr_nonnull(m);
+
+    for (int key = 0; key < 100; ++key)
+    {
+        ck_assert_int_eq(hashmap_insert(&m, &key, TMP_REF(long, key)), HASHMAP_SUCCESS);
+    }
+    for (int key = 0; key < 100; key += 2)
+    {
+        ck_assert(hashmap_remove(m, &key));
+    }
+    for (int key = 0; key < 100; ++key)
+    {
+        const long *value = hashmap_get(m, &key);
+        if (key % 2) ck_assert_int_eq(*value, key);
+        else ck_assert_ptr_null(value);
+    }
+    hashmap_destroy(m);
+}
+END_TEST
+
+
+START_TEST (test_hashmap_set)
+{
+    hashmap_t *set = hashmap_create(.key_size = sizeof(int));
+    ck_assert_ptr_nonnull(set);
+
+    for (int key = 0; key < 100; ++key)
+    {
+        ck_assert_int_eq(hashmap_insert(&set, &key, NULL), HASHMAP_SUCCESS);
+    }
+    ck_assert_int_eq(hashmap_insert(&set, TMP_REF(int, 7), NULL), HASHMAP_SUCCESS);
+    ck_assert_uint_eq(hashmap_size(set), 100);
+
+    ck_assert(hashmap_remove(set, TMP_REF(int, 7)));
+    for (int key = 0; key < 100; ++key)
+    {
+        if (7 == key) ck_assert_ptr_null(hashmap_get(set, &key));
+        else ck_assert_ptr_nonnull(hashmap_get(set, &key));
+    }
+    hashmap_destroy(set);
+}
+END_TEST
+
+
+START_TEST (test_hashmap_reserve)
+{
+    ck_assert_int_eq(hashmap_insert(&map, TMP_REF(int, 5), TMP_REF(long, 5)), HASHMAP_SUCCESS);
+    ck_assert_int_eq(hashmap_reserve(&map, 1000), HASHMAP_SUCCESS);
+    ck_assert_uint_eq(hashmap_capacity(map), 2048);
+    ck_assert_int_eq(*(long *) hashmap_get(map, TMP_REF(int, 5)), 5);
+
+    const size_t capacity = hashmap_capacity(map);
+    for (int key = 0; key < 1000; ++key)
+    {
+        hashmap_insert(&map, &key, TMP_REF(long, key));
+    }
+    ck_assert_uint_eq(hashmap_capacity(map), capacity);
+}
+END_TEST
+
+
+Suite *hashmap_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Hash Map");
+
+    /* Core test case */
+    tc_core = tcase_create("Core");
+
+    tcase_add_checked_fixture(tc_core, setup_empty, teardown);
+    tcase_add_test(tc_core, test_hashmap_create);
+    tcase_add_test(tc_core, test_hashmap_insert_get);
+    tcase_add_test(tc_core, test_hashmap_remove_churn);
+    tcase_add_test(tc_core, test_hashmap_collisions);
+    tcase_add_test(tc_core, test_hashmap_set);
+    tcase_add_test(tc_core, test_hashmap_reserve);
+
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+
+int main(void)
+{
+    int number_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = hashmap_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,171 @@
+#include <check.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../src/heap.h"
+
+static heap_t *heap;
+
+static ssize_t cmp_long(const void *const value, const void *const element, void *const param)
+{
+    (void) param;
+    const long a = *(const long *) value;
+    const long b = *(const long *) element;
+    return (a > b) - (a < b);
+}
+
+static void setup_empty(void)
+{
+    heap = heap_create(
+       .element_size = sizeof(long),
+       .cmp = cmp_long,
+       .initial_cap = 4
+    );
+    ck_assert_ptr_nonnull(heap);
+}
+
+static void teardown(void)
+{
+    heap_destroy(heap);
+}
+
+
+static void check_drain(heap_t *const h, const size_t expected)
+{
+    ck_assert_uint_eq(heap_size(h), expected);
+
+    long prev = 0, value;
+    for (size_t i = 0; i < expected; ++i)
+    {
+        ck_assert_int_eq(heap_pop(h, &value), HEAP_SUCCESS);
+        if (i) ck_assert_int_ge(value, prev);
+        prev = value;
+    }
+    ck_assert_int_eq(heap_pop(h, &value), HEAP_EMPTY);
+}
+
+
+START_TEST (test_heap_create)
+{
+    ck_assert_uint_eq(heap_size(heap), 0);
+    ck_assert_uint_eq(heap_capacity(heap), 4);
+    ck_assert_ptr_null(heap_top(heap));
+    ck_assert_int_eq(heap_pop(heap, NULL), HEAP_EMPTY);
+    ck_assert_int_eq(heap_replace_top(heap, TMP_REF(long, 1), NULL), HEAP_EMPTY);
+}
+END_TEST
+
+
+START_TEST (test_heap_push_pop)
+{
+    for (long i = 0; i < 100; ++i)
+    {
+        const long value = (i * 37) % 100;
+        ck_assert_int_eq(heap_push(&heap, &value), HEAP_SUCCESS);
+    }
+    ck_assert_int_eq(*(long *) heap_top(heap), 0);
+    check_drain(heap, 100);
+}
+END_TEST
+
+
+START_TEST (test_heap_arity4)
+{
+    heap_t *h = heap_create(.element_size = sizeof(long), .cmp = cmp_long, .arity = 4);
+    ck_assert_ptr_nonnull(h);
+
+    for (long i = 0; i < 257; ++i)
+    {
+        const long value = (i * 101) % 257;
+        ck_assert_int_eq(heap_push(&h, &value), HEAP_SUCCESS);
+    }
+    check_drain(h, 257);
+    heap_destroy(h);
+}
+END_TEST
+
+
+START_TEST (test_heap_push_bulk)
+{
+    long values[500];
+    for (long i = 0; i < 500; ++i)
+    {
+        values[i] = (i * 7919) % 500;
+    }
+
+    /* rebuilt bottom-up */
+    ck_assert_int_eq(heap_push_bulk(&heap, values, 500), HEAP_SUCCESS);
+    /* sifted up one by one */
+    ck_assert_int_eq(heap_push_bulk(&heap, values, 3), HEAP_SUCCESS);
+    ck_assert_int_eq(heap_push_bulk(&heap, values, 0), HEAP_SUCCESS);
+    check_drain(heap, 503);
+}
+END_TEST
+
+
+START_TEST (test_heap_replace_top)
+{
+    /* keep 10 largest values, top is the smallest of them */
+    for (long i = 0; i < 1000; ++i)
+    {
+        const long value = (i * 613) % 1000;
+        if (heap_size(heap) < 10)
+        {
+            heap_push(&heap, &value);
+        }
+        else if (value > *(long *) heap_top(heap))
+        {
+            long replaced;
+            ck_assert_int_eq(heap_replace_top(heap, &value, &replaced), HEAP_SUCCESS);
+            ck_assert_int_lt(replaced, value);
+        }
+    }
+
+    for (long expected = 990; expected < 1000; ++expected)
+    {
+        long value;
+        heap_pop(heap, &value);
+        ck_assert_int_eq(value, expected);
+    }
+}
+END_TEST
+
+
+Suite *heap_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Heap");
+
+    /* Core test case */
+    tc_core = tcase_create("Core");
+
+    tcase_add_checked_fixture(tc_core, setup_empty, teardown);
+    tcase_add_test(tc_core, test_heap_create);
+    tcase_add_test(tc_core, test_heap_push_pop);
+    tcase_add_test(tc_core, test_heap_arity4);
+    tcase_add_test(tc_core, test_heap_push_bulk);
+    tcase_add_test(tc_core, test_heap_replace_top);
+
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+
+int main(void)
+{
+    int number_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = heap_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,185 @@
+#include <check.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "../src/mpmc.h"
+
+static mpmc_t *queue;
+
+static void setup_empty(void)
+{
+    queue = mpmc_create(
+       .element_size = sizeof(long),
+       .capacity = 8
+    );
+    ck_assert_ptr_nonnull(queue);
+}
+
+static void teardown(void)
+{
+    mpmc_destroy(queue);
+}
+
+
+START_TEST (test_mpmc_create)
+{
+    ck_assert_uint_eq(mpmc_capacity(queue), 8);
+
+    mpmc_t *q = mpmc_create(.element_size = 3, .capacity = 1);
+    ck_assert_uint_eq(mpmc_capacity(q), 2);
+    mpmc_destroy(q);
+}
+END_TEST
+
+
+START_TEST (test_mpmc_try_push_pop)
+{
+    long value;
+    ck_assert(!mpmc_try_pop(queue, &value));
+
+    for (long i = 0; i < 8; ++i)
+    {
+        ck_assert(mpmc_try_push(queue, &i));
+    }
+    ck_assert(!mpmc_try_push(queue, TMP_REF(long, 8)));
+
+    for (long i = 0; i < 8; ++i)
+    {
+        ck_assert(mpmc_try_pop(queue, &value));
+        ck_assert_int_eq(value, i);
+    }
+    ck_assert(!mpmc_try_pop(queue, &value));
+
+    /* slots are reusable after wrap around */
+    for (long i = 0; i < 20; ++i)
+    {
+        mpmc_push(queue, &i);
+        mpmc_pop(queue, &value);
+        ck_assert_int_eq(value, i);
+    }
+}
+END_TEST
+
+
+#define THREADS 4
+#define RECORDS 5000
+
+static void *producer(void *param)
+{
+    for (long i = 1; i <= RECORDS; ++i)
+    {
+        mpmc_push(param, &i);
+    }
+    return NULL;
+}
+
+static void *consumer(void *param)
+{
+    long *sum = malloc(sizeof(long));
+    *sum = 0;
+    for (long i = 0; i < RECORDS; ++i)
+    {
+        long value;
+        mpmc_pop(param, &value);
+        *sum += value;
+    }
+    return sum;
+}
+
+START_TEST (test_mpmc_threads)
+{
+    pthread_t producers[THREADS], consumers[THREADS];
+
+    for (size_t i = 0; i < THREADS; ++i)
+    {
+        ck_assert_int_eq(0, pthread_create(&producers[i], NULL, producer, queue));
+        ck_assert_int_eq(0, pthread_create(&consumers[i], NULL, consumer, queue));
+    }
+
+    long total = 0;
+    for (size_t i = 0; i < THREADS; ++i)
+    {
+        void *sum;
+        pthread_join(producers[i], NULL);
+        pthread_join(consumers[i], &sum);
+        total += *(long*)sum;
+        free(sum);
+    }
+
+    ck_assert_int_eq(total, (long)THREADS * RECORDS * (RECORDS + 1) / 2);
+
+    long value;
+    ck_assert(!mpmc_try_pop(queue, &value));
+}
+END_TEST
+
+
+START_TEST (test_mpmc_park)
+{
+    /* consumers block on empty queue long enough to park */
+    pthread_t consumers[THREADS];
+    for (size_t i = 0; i < THREADS; ++i)
+    {
+        ck_assert_int_eq(0, pthread_create(&consumers[i], NULL, consumer, queue));
+    }
+    usleep(50 * 1000);
+
+    /* single producer wakes them, it parks itself whenever the small queue is full */
+    for (size_t i = 0; i < THREADS; ++i)
+    {
+        producer(queue);
+    }
+
+    long total = 0;
+    for (size_t i = 0; i < THREADS; ++i)
+    {
+        void *sum;
+        pthread_join(consumers[i], &sum);
+        total += *(long*)sum;
+        free(sum);
+    }
+
+    ck_assert_int_eq(total, (long)THREADS * RECORDS * (RECORDS + 1) / 2);
+}
+END_TEST
+
+
+Suite *mpmc_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("MPMC");
+
+    /* Core test case */
+    tc_core = tcase_create("Core");
+
+    tcase_add_checked_fixture(tc_core, setup_empty, teardown);
+    tcase_add_test(tc_core, test_mpmc_create);
+    tcase_add_test(tc_core, test_mpmc_try_push_pop);
+    tcase_add_test(tc_core, test_mpmc_threads);
+    tcase_add_test(tc_core, test_mpmc_park);
+
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+
+int main(void)
+{
+    int number_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = mpmc_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
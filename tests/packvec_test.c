@@ -0,0 +1,183 @@
+#include <check.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../src/packvec.h"
+
+#define LENGTH 1000
+
+static vector_t *source;
+
+static void setup_empty(void)
+{
+    source = vector_create(.element_size = sizeof(uint64_t), .initial_cap = LENGTH);
+    ck_assert_ptr_nonnull(source);
+
+    /* sorted timestamps with small irregular gaps */
+    uint64_t value = 1700000000000ULL;
+    for (size_t i = 0; i < LENGTH; ++i)
+    {
+        value += (i * 7919) % 100;
+        vector_set(source, i, &value);
+    }
+}
+
+static void teardown(void)
+{
+    vector_destroy(source);
+}
+
+
+static void check_roundtrip(const packvec_t *const packvec, const vector_t *const values, const size_t length)
+{
+    ck_assert_uint_eq(packvec_length(packvec), length);
+
+    for (size_t i = 0; i < length; ++i)
+    {
+        ck_assert_uint_eq(packvec_get(packvec, i), *(uint64_t *) vector_get(values, i));
+    }
+
+    uint64_t block[PACKVEC_BLOCK];
+    size_t index = 0;
+    for (size_t b = 0; b < packvec_blocks(packvec); ++b)
+    {
+        const size_t count = packvec_decode(packvec, b, block);
+        for (size_t i = 0; i < count; ++i, ++index)
+        {
+            ck_assert_uint_eq(block[i], *(uint64_t *) vector_get(values, index));
+        }
+    }
+    ck_assert_uint_eq(index, length);
+}
+
+
+typedef struct scan_t
+{
+    const vector_t *values;
+    size_t index;
+}
+scan_t;
+
+static int check_value(const void *const element, void *const param)
+{
+    scan_t *scan = param;
+    return *(const uint64_t *) element != *(uint64_t *) vector_get(scan->values, scan->index++);
+}
+
+
+START_TEST (test_packvec_delta)
+{
+    packvec_t *packvec = packvec_create(.source = source, .length = LENGTH, .encoding = PACKVEC_DELTA);
+    ck_assert_ptr_nonnull(packvec);
+
+    check_roundtrip(packvec, source, LENGTH);
+    ck_assert_uint_eq(packvec_blocks(packvec), 8);
+
+    /* 7 bit deltas instead of 64 bit values */
+    ck_assert_uint_lt(packvec_memory(packvec) * 6, LENGTH * sizeof(uint64_t));
+
+    scan_t scan = {.values = source};
+    ck_assert_int_eq(packvec_foreach(packvec, check_value, &scan), 0);
+    ck_assert_uint_eq(scan.index, LENGTH);
+
+    packvec_destroy(packvec);
+}
+END_TEST
+
+
+START_TEST (test_packvec_for)
+{
+    packvec_t *packvec = packvec_create(.source = source, .length = LENGTH - 5, .encoding = PACKVEC_FOR);
+    ck_assert_ptr_nonnull(packvec);
+    check_roundtrip(packvec, source, LENGTH - 5);
+    ck_assert_uint_lt(packvec_memory(packvec) * 4, LENGTH * sizeof(uint64_t));
+    packvec_destroy(packvec);
+}
+END_TEST
+
+
+START_TEST (test_packvec_widths)
+{
+    /* constant block, full width block and unsorted delta block */
+    for (size_t i = 0; i < LENGTH; ++i)
+    {
+        uint64_t value = (i < 128) ? 42
+            : (i < 256) ? (i % 2 ? UINT64_MAX : 0)
+            : (i * 2654435761ULL) % 1000003;
+        vector_set(source, i, &value);
+    }
+
+    packvec_t *packvec = packvec_create(.source = source, .length = LENGTH);
+    check_roundtrip(packvec, source, LENGTH);
+    packvec_destroy(packvec);
+
+    packvec = packvec_create(.source = source, .length = LENGTH, .encoding = PACKVEC_DELTA);
+    check_roundtrip(packvec, source, LENGTH);
+    packvec_destroy(packvec);
+
+    packvec = packvec_create(.source = source, .length = 0);
+    ck_assert_uint_eq(packvec_blocks(packvec), 0);
+    packvec_destroy(packvec);
+}
+END_TEST
+
+
+START_TEST (test_packvec_narrow_source)
+{
+    vector_t *narrow = vector_create(.element_size = sizeof(uint32_t), .initial_cap = 300);
+    vector_t *wide = vector_create(.element_size = sizeof(uint64_t), .initial_cap = 300);
+    for (uint32_t i = 0; i < 300; ++i)
+    {
+        const uint32_t value = UINT32_MAX - i * 3;
+        vector_set(narrow, i, &value);
+        vector_set(wide, i, TMP_REF(uint64_t, value));
+    }
+
+    packvec_t *packvec = packvec_create(.source = narrow, .length = 300);
+    check_roundtrip(packvec, wide, 300);
+
+    packvec_destroy(packvec);
+    vector_destroy(wide);
+    vector_destroy(narrow);
+}
+END_TEST
+
+
+Suite *packvec_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Compressed Vector");
+
+    /* Core test case */
+    tc_core = tcase_create("Core");
+
+    tcase_add_checked_fixture(tc_core, setup_empty, teardown);
+    tcase_add_test(tc_core, test_packvec_delta);
+    tcase_add_test(tc_core, test_packvec_for);
+    tcase_add_test(tc_core, test_packvec_widths);
+    tcase_add_test(tc_core, test_packvec_narrow_source);
+
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+
+int main(void)
+{
+    int number_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = packvec_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
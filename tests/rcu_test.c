@@ -0,0 +1,244 @@
+#include <check.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../src/rcu.h"
+
+#define READERS 4
+#define UPDATES 200
+#define STRESS_UPDATES 5000
+
+static rcu_t *rcu;
+
+static void setup_empty(void)
+{
+    vector_t *initial = vector_create(.element_size = sizeof(long), .initial_cap = 4);
+    ck_assert_ptr_nonnull(initial);
+    for (long i = 0; i < 4; ++i)
+    {
+        vector_set(initial, i, &i);
+    }
+
+    rcu = rcu_create(.vector = initial, .readers = READERS);
+    ck_assert_ptr_nonnull(rcu);
+}
+
+static void teardown(void)
+{
+    rcu_destroy(rcu);
+}
+
+
+static int append_value(vector_t **const copy, void *const param)
+{
+    const size_t capacity = vector_capacity(*copy);
+    if (VECTOR_SUCCESS != vector_resize(copy, capacity + 1, VECTOR_ALLOC_ERROR))
+    {
+        return 1;
+    }
+    vector_set(*copy, capacity, param);
+    return 0;
+}
+
+
+static int bump_values(vector_t **const copy, void *const param)
+{
+    (void) param;
+    for (size_t i = 0; i < vector_capacity(*copy); ++i)
+    {
+        ++*(long *) vector_get(*copy, i);
+    }
+    return 0;
+}
+
+
+static int reject(vector_t **const copy, void *const param)
+{
+    (void) copy;
+    (void) param;
+    return 1;
+}
+
+
+START_TEST (test_rcu_create)
+{
+    ck_assert_uint_eq(rcu_readers(rcu), READERS);
+
+    const vector_t *v = rcu_read_lock(rcu, 0);
+    ck_assert_uint_eq(vector_capacity(v), 4);
+    ck_assert_int_eq(*(long *) vector_get(v, 3), 3);
+    rcu_read_unlock(rcu, 0);
+}
+END_TEST
+
+
+START_TEST (test_rcu_update)
+{
+    const vector_t *before = rcu_read_lock(rcu, 0);
+
+    ck_assert_int_eq(rcu_update(rcu, append_value, TMP_REF(long, 42)), RCU_SUCCESS);
+    ck_assert_int_eq(rcu_update(rcu, reject, NULL), RCU_ABORTED);
+
+    /* old version stays intact while reader holds it */
+    ck_assert_uint_eq(rcu_reclaim(rcu), 1);
+    ck_assert_uint_eq(vector_capacity(before), 4);
+    rcu_read_unlock(rcu, 0);
+
+    const vector_t *after = rcu_read_lock(rcu, 1);
+    ck_assert_uint_eq(vector_capacity(after), 5);
+    ck_assert_int_eq(*(long *) vector_get(after, 4), 42);
+    rcu_read_unlock(rcu, 1);
+
+    ck_assert_uint_eq(rcu_reclaim(rcu), 0);
+}
+END_TEST
+
+
+static atomic_bool done;
+
+static void *read_versions(void *param)
+{
+    const size_t reader = *(const size_t *) param;
+    size_t last = 0;
+
+    while (!atomic_load(&done))
+    {
+        const vector_t *v = rcu_read_lock(rcu, reader);
+        const size_t capacity = vector_capacity(v);
+
+        /* versions only grow and every element equals its index */
+        ck_assert_uint_ge(capacity, last);
+        for (size_t i = 0; i < capacity; ++i)
+        {
+            ck_assert_int_eq(*(long *) vector_get(v, i), (long) i);
+        }
+        last = capacity;
+
+        rcu_read_unlock(rcu, reader);
+        sched_yield();
+    }
+    return NULL;
+}
+
+
+static void *stress_versions(void *param)
+{
+    const size_t reader = *(const size_t *) param;
+    long last = 0;
+
+    while (!atomic_load(&done))
+    {
+        const vector_t *v = rcu_read_lock(rcu, reader);
+
+        /* a reclaimed version would show torn or regressing generations */
+        const long generation = *(const long *) vector_get(v, 0);
+        ck_assert_int_ge(generation, last);
+        for (size_t i = 1; i < vector_capacity(v); ++i)
+        {
+            ck_assert_int_eq(*(const long *) vector_get(v, i), generation + (long) i);
+        }
+        last = generation;
+
+        rcu_read_unlock(rcu, reader);
+    }
+    return NULL;
+}
+
+
+START_TEST (test_rcu_threads)
+{
+    pthread_t threads[READERS];
+    size_t slots[READERS];
+
+    atomic_store(&done, false);
+    for (size_t t = 0; t < READERS; ++t)
+    {
+        slots[t] = t;
+        pthread_create(&threads[t], NULL, read_versions, &slots[t]);
+    }
+
+    for (long i = 4; i < 4 + UPDATES; ++i)
+    {
+        ck_assert_int_eq(rcu_update(rcu, append_value, &i), RCU_SUCCESS);
+    }
+
+    atomic_store(&done, true);
+    for (size_t t = 0; t < READERS; ++t)
+    {
+        pthread_join(threads[t], NULL);
+    }
+
+    ck_assert_uint_eq(rcu_reclaim(rcu), 0);
+}
+END_TEST
+
+
+START_TEST (test_rcu_stress)
+{
+    pthread_t threads[READERS];
+    size_t slots[READERS];
+
+    atomic_store(&done, false);
+    for (size_t t = 0; t < READERS; ++t)
+    {
+        slots[t] = t;
+        pthread_create(&threads[t], NULL, stress_versions, &slots[t]);
+    }
+
+    for (size_t i = 0; i < STRESS_UPDATES; ++i)
+    {
+        ck_assert_int_eq(rcu_update(rcu, bump_values, NULL), RCU_SUCCESS);
+    }
+
+    atomic_store(&done, true);
+    for (size_t t = 0; t < READERS; ++t)
+    {
+        pthread_join(threads[t], NULL);
+    }
+
+    ck_assert_int_eq(*(const long *) vector_get(rcu_read_lock(rcu, 0), 0), STRESS_UPDATES);
+    rcu_read_unlock(rcu, 0);
+    ck_assert_uint_eq(rcu_reclaim(rcu), 0);
+}
+END_TEST
+
+
+Suite *rcu_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("RCU");
+
+    /* Core test case */
+    tc_core = tcase_create("Core");
+
+    tcase_add_checked_fixture(tc_core, setup_empty, teardown);
+    tcase_add_test(tc_core, test_rcu_create);
+    tcase_add_test(tc_core, test_rcu_update);
+    tcase_add_test(tc_core, test_rcu_threads);
+    tcase_add_test(tc_core, test_rcu_stress);
+
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+
+int main(void)
+{
+    int number_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = rcu_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,215 @@
+#include <check.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../src/ring.h"
+
+static ring_t *ring;
+
+static void setup_empty(void)
+{
+    ring = ring_create(
+       .element_size = sizeof(int),
+       .initial_cap = 4
+    );
+    ck_assert_ptr_nonnull(ring);
+}
+
+static void teardown(void)
+{
+    ring_destroy(ring);
+}
+
+
+START_TEST (test_ring_create)
+{
+    ck_assert_uint_eq(ring_size(ring), 0);
+    ck_assert_uint_eq(ring_capacity(ring), 4);
+
+    ring_t *r = ring_create(.element_size = sizeof(int), .initial_cap = 5);
+    ck_assert_uint_eq(ring_capacity(r), 8);
+    ring_destroy(r);
+}
+END_TEST
+
+
+START_TEST (test_ring_push_pop)
+{
+    int value;
+
+    for (int i = 0; i < 3; ++i)
+    {
+        ck_assert_int_eq(RING_SUCCESS, ring_push_back(&ring, &i));
+    }
+    ck_assert_int_eq(RING_SUCCESS, ring_push_front(&ring, TMP_REF(int, -1)));
+
+    /* -1 0 1 2 */
+    ck_assert_uint_eq(ring_size(ring), 4);
+    for (int i = 0; i < 4; ++i)
+    {
+        ck_assert_int_eq(*(int*) ring_get(ring, i), i - 1);
+    }
+
+    ck_assert_int_eq(RING_SUCCESS, ring_pop_back(ring, &value));
+    ck_assert_int_eq(value, 2);
+    ck_assert_int_eq(RING_SUCCESS, ring_pop_front(ring, &value));
+    ck_assert_int_eq(value, -1);
+    ck_assert_int_eq(RING_SUCCESS, ring_pop_front(ring, NULL));
+    ck_assert_int_eq(RING_SUCCESS, ring_pop_front(ring, &value));
+    ck_assert_int_eq(value, 1);
+
+    ck_assert_int_eq(RING_EMPTY, ring_pop_front(ring, &value));
+    ck_assert_int_eq(RING_EMPTY, ring_pop_back(ring, &value));
+}
+END_TEST
+
+
+START_TEST (test_ring_wrap_around)
+{
+    int value;
+
+    /* move head towards the end of the buffer */
+    for (int i = 0; i < 3; ++i)
+    {
+        ring_push_back(&ring, &i);
+        ring_pop_front(ring, NULL);
+    }
+
+    for (int i = 0; i < 4; ++i)
+    {
+        ck_assert_int_eq(RING_SUCCESS, ring_push_back(&ring, &i));
+    }
+    ck_assert_uint_eq(ring_capacity(ring), 4);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        ck_assert_int_eq(RING_SUCCESS, ring_pop_front(ring, &value));
+        ck_assert_int_eq(value, i);
+    }
+}
+END_TEST
+
+
+START_TEST (test_ring_grow_unwraps)
+{
+    /* two layouts: wrapped part shorter and longer than the front part */
+    const int rotations[] = {1, 3};
+
+    for (size_t r = 0; r < 2; ++r)
+    {
+        ring_t *rg = ring_create(.element_size = sizeof(int), .initial_cap = 4);
+        for (int i = 0; i < rotations[r]; ++i)
+        {
+            ring_push_back(&rg, &i);
+            ring_pop_front(rg, NULL);
+        }
+
+        for (int i = 0; i < 20; ++i)
+        {
+            ck_assert_int_eq(RING_SUCCESS, ring_push_back(&rg, &i));
+        }
+        ck_assert_uint_eq(ring_capacity(rg), 32);
+
+        for (int i = 0; i < 20; ++i)
+        {
+            ck_assert_int_eq(*(int*) ring_get(rg, i), i);
+        }
+        ring_destroy(rg);
+    }
+}
+END_TEST
+
+
+START_TEST (test_ring_push_front_grow)
+{
+    for (int i = 0; i < 10; ++i)
+    {
+        ck_assert_int_eq(RING_SUCCESS, ring_push_front(&ring, &i));
+    }
+
+    for (int i = 0; i < 10; ++i)
+    {
+        ck_assert_int_eq(*(int*) ring_get(ring, i), 9 - i);
+    }
+}
+END_TEST
+
+
+START_TEST (test_ring_enqueue_dequeue)
+{
+    const int values[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    int out[10] = {0};
+
+    ck_assert_int_eq(RING_SUCCESS, ring_enqueue(&ring, values, 3));
+    ck_assert_uint_eq(ring_dequeue(ring, out, 2), 2);
+    ck_assert_mem_eq(out, values, 2 * sizeof(int));
+
+    /* wraps around the end of the buffer */
+    ck_assert_int_eq(RING_SUCCESS, ring_enqueue(&ring, values + 3, 3));
+    ck_assert_uint_eq(ring_capacity(ring), 4);
+    ck_assert_uint_eq(ring_dequeue(ring, out, 10), 4);
+    ck_assert_mem_eq(out, values + 2, 4 * sizeof(int));
+    ck_assert_uint_eq(ring_size(ring), 0);
+
+    /* grows while wrapped */
+    ck_assert_int_eq(RING_SUCCESS, ring_enqueue(&ring, values, 3));
+    ck_assert_int_eq(RING_SUCCESS, ring_enqueue(&ring, values + 3, 7));
+    ck_assert_uint_eq(ring_size(ring), 10);
+    ck_assert_uint_eq(ring_dequeue(ring, NULL, 1), 1);
+    ck_assert_uint_eq(ring_dequeue(ring, out, 9), 9);
+    ck_assert_mem_eq(out, values + 1, 9 * sizeof(int));
+}
+END_TEST
+
+
+START_TEST (test_ring_reserve)
+{
+    ck_assert_int_eq(RING_SUCCESS, ring_reserve(&ring, 2));
+    ck_assert_uint_eq(ring_capacity(ring), 4);
+
+    ck_assert_int_eq(RING_SUCCESS, ring_reserve(&ring, 100));
+    ck_assert_uint_eq(ring_capacity(ring), 128);
+}
+END_TEST
+
+
+Suite *ring_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Ring");
+
+    /* Core test case */
+    tc_core = tcase_create("Core");
+
+    tcase_add_checked_fixture(tc_core, setup_empty, teardown);
+    tcase_add_test(tc_core, test_ring_create);
+    tcase_add_test(tc_core, test_ring_push_pop);
+    tcase_add_test(tc_core, test_ring_wrap_around);
+    tcase_add_test(tc_core, test_ring_grow_unwraps);
+    tcase_add_test(tc_core, test_ring_push_front_grow);
+    tcase_add_test(tc_core, test_ring_enqueue_dequeue);
+    tcase_add_test(tc_core, test_ring_reserve);
+
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+
+int main(void)
+{
+    int number_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = ring_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
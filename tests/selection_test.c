@@ -0,0 +1,180 @@
+#include <check.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../src/selection.h"
+
+#define SAMPLES 10000
+
+static vector_t *vector;
+
+static void setup_random(void)
+{
+    vector = vector_create(.element_size = sizeof(int), .initial_cap = SAMPLES);
+    ck_assert_ptr_nonnull(vector);
+
+    srand(42);
+    for (size_t i = 0; i < SAMPLES; ++i)
+    {
+        vector_set(vector, i, TMP_REF(int, rand() % 1000));
+    }
+}
+
+static void teardown(void)
+{
+    vector_destroy(vector);
+}
+
+
+static ssize_t cmp_int(const void *const value, const void *const element, void *const param)
+{
+    (void) param;
+    const int a = *(const int *) value, b = *(const int *) element;
+    return (a > b) - (a < b);
+}
+
+
+static int cmp_qsort(const void *a, const void *b)
+{
+    return (int) cmp_int(a, b, NULL);
+}
+
+
+static int get_int(const vector_t *const v, const size_t index)
+{
+    return *(int *) vector_get(v, index);
+}
+
+
+static int *sorted_copy(void)
+{
+    int *copy = malloc(SAMPLES * sizeof(int));
+    ck_assert_ptr_nonnull(copy);
+    vector_copy(vector, (char *) copy, 0, SAMPLES);
+    qsort(copy, SAMPLES, sizeof(int), cmp_qsort);
+    return copy;
+}
+
+
+START_TEST (test_nth_element)
+{
+    int *sorted = sorted_copy();
+    const size_t positions[] = {0, SAMPLES - 1, SAMPLES / 2, SAMPLES * 99 / 100, 17};
+
+    for (size_t p = 0; p < sizeof(positions) / sizeof(*positions); ++p)
+    {
+        const size_t nth = positions[p];
+        vector_nth_element(vector, SAMPLES, nth, cmp_int, NULL);
+
+        const int value = get_int(vector, nth);
+        ck_assert_int_eq(value, sorted[nth]);
+
+        for (size_t i = 0; i < nth; ++i) ck_assert_int_le(get_int(vector, i), value);
+        for (size_t i = nth + 1; i < SAMPLES; ++i) ck_assert_int_ge(get_int(vector, i), value);
+    }
+
+    /* already sorted and constant inputs */
+    vector_nth_element(vector, SAMPLES, 1234, cmp_int, NULL);
+    ck_assert_int_eq(get_int(vector, 1234), sorted[1234]);
+
+    for (size_t i = 0; i < SAMPLES; ++i) vector_set(vector, i, TMP_REF(int, 7));
+    vector_nth_element(vector, SAMPLES, 5000, cmp_int, NULL);
+    ck_assert_int_eq(get_int(vector, 5000), 7);
+
+    free(sorted);
+}
+END_TEST
+
+
+START_TEST (test_partial_sort)
+{
+    int *sorted = sorted_copy();
+
+    vector_partial_sort(vector, SAMPLES, 100, cmp_int, NULL);
+    for (size_t i = 0; i < 100; ++i)
+    {
+        ck_assert_int_eq(get_int(vector, i), sorted[i]);
+    }
+
+    vector_partial_sort(vector, SAMPLES, 1, cmp_int, NULL);
+    ck_assert_int_eq(get_int(vector, 0), sorted[0]);
+
+    vector_partial_sort(vector, 50, 50, cmp_int, NULL);
+    for (size_t i = 1; i < 50; ++i)
+    {
+        ck_assert_int_le(get_int(vector, i - 1), get_int(vector, i));
+    }
+
+    free(sorted);
+}
+END_TEST
+
+
+START_TEST (test_topk)
+{
+    int *sorted = sorted_copy();
+    topk_t topk;
+
+    ck_assert_int_eq(topk_init(&topk, .element_size = sizeof(int), .k = 10, .cmp = cmp_int), VECTOR_SUCCESS);
+    ck_assert_ptr_null(topk_threshold(&topk));
+
+    ck_assert_int_eq(vector_foreach(vector, SAMPLES, topk_collect, &topk), 0);
+    ck_assert_uint_eq(topk_size(&topk), 10);
+    ck_assert_int_eq(*(const int *) topk_threshold(&topk), sorted[SAMPLES - 10]);
+
+    int out[10];
+    ck_assert_uint_eq(topk_extract(&topk, out), 10);
+    ck_assert_uint_eq(topk_size(&topk), 0);
+    for (size_t i = 0; i < 10; ++i)
+    {
+        ck_assert_int_eq(out[i], sorted[SAMPLES - 1 - i]);
+    }
+
+    topk_push(&topk, TMP_REF(int, 3));
+    topk_push(&topk, TMP_REF(int, 5));
+    ck_assert_uint_eq(topk_extract(&topk, out), 2);
+    ck_assert_int_eq(out[0], 5);
+    ck_assert_int_eq(out[1], 3);
+
+    topk_deinit(&topk);
+    free(sorted);
+}
+END_TEST
+
+
+Suite *selection_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Selection");
+
+    /* Core test case */
+    tc_core = tcase_create("Core");
+
+    tcase_add_checked_fixture(tc_core, setup_random, teardown);
+    tcase_add_test(tc_core, test_nth_element);
+    tcase_add_test(tc_core, test_partial_sort);
+    tcase_add_test(tc_core, test_topk);
+
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+
+int main(void)
+{
+    int number_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = selection_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,211 @@
+#include <check.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../src/setops.h"
+
+static vector_t *dest;
+
+static void setup_empty(void)
+{
+    dest = vector_create(.element_size = sizeof(int), .initial_cap = 1);
+    ck_assert_ptr_nonnull(dest);
+}
+
+static void teardown(void)
+{
+    vector_destroy(dest);
+}
+
+
+static ssize_t cmp_int(const void *const value, const void *const element, void *const param)
+{
+    (void) param;
+    const int a = *(const int *) value, b = *(const int *) element;
+    return (a > b) - (a < b);
+}
+
+
+static vector_t *make_ints(const size_t length, const int start, const int step)
+{
+    vector_t *vector = vector_create(.element_size = sizeof(int), .initial_cap = length ? length : 1);
+    ck_assert_ptr_nonnull(vector);
+
+    for (size_t i = 0; i < length; ++i)
+    {
+        vector_set(vector, i, TMP_REF(int, start + (int) i * step));
+    }
+    return vector;
+}
+
+
+static int get_int(const size_t index)
+{
+    return *(int *) vector_get(dest, index);
+}
+
+
+START_TEST (test_setops_merge)
+{
+    const vector_t *sources[5] = {
+        make_ints(10, 0, 3),
+        make_ints(7, 1, 5),
+        make_ints(0, 0, 1),
+        make_ints(12, 0, 2),
+        make_ints(1, 100, 0),
+    };
+    const size_t lengths[5] = {10, 7, 0, 12, 1};
+    size_t length = 0;
+
+    ck_assert_int_eq(setops_merge(&dest, &length, sources, lengths, 5, cmp_int, NULL), VECTOR_SUCCESS);
+    ck_assert_uint_eq(length, 30);
+    ck_assert_uint_ge(vector_capacity(dest), 30);
+
+    for (size_t i = 1; i < length; ++i)
+    {
+        ck_assert_int_le(get_int(i - 1), get_int(i));
+    }
+    ck_assert_int_eq(get_int(29), 100);
+
+    ck_assert_int_eq(setops_union(&dest, &length, sources, lengths, 5, cmp_int, NULL), VECTOR_SUCCESS);
+    /* {0..27 step 3} u {1..31 step 5} u {0..22 step 2} u {100}, 0 and 6 and 12... shared */
+    size_t expected = 0;
+    for (int v = 0; v <= 100; ++v)
+    {
+        expected += (v % 3 == 0 && v <= 27) || (v % 5 == 1 && v <= 31) || (v % 2 == 0 && v <= 22) || v == 100;
+    }
+    ck_assert_uint_eq(length, expected);
+
+    for (size_t i = 1; i < length; ++i)
+    {
+        ck_assert_int_lt(get_int(i - 1), get_int(i));
+    }
+
+    for (size_t s = 0; s < 5; ++s) vector_destroy((vector_t *) sources[s]);
+}
+END_TEST
+
+
+START_TEST (test_setops_intersect_difference)
+{
+    const vector_t *sources[3] = {
+        make_ints(100, 0, 2),  /* evens */
+        make_ints(100, 0, 3),  /* multiples of 3 */
+        make_ints(4000, 0, 1), /* 0..3999, skewed */
+    };
+    const size_t lengths[3] = {100, 100, 4000};
+    size_t length = 0;
+
+    ck_assert_int_eq(setops_intersect(&dest, &length, sources, lengths, 3, cmp_int, NULL), VECTOR_SUCCESS);
+    ck_assert_uint_eq(length, 34); /* multiples of 6 up to 198 */
+    for (size_t i = 0; i < length; ++i)
+    {
+        ck_assert_int_eq(get_int(i), (int) i * 6);
+    }
+
+    const vector_t *diff_sources[2] = {sources[2], sources[0]};
+    const size_t diff_lengths[2] = {4000, 100};
+    ck_assert_int_eq(setops_difference(&dest, &length, diff_sources, diff_lengths, 2, cmp_int, NULL),
+            VECTOR_SUCCESS);
+    ck_assert_uint_eq(length, 3900);
+    ck_assert_int_eq(get_int(0), 1);
+    ck_assert_int_eq(get_int(99), 199);
+    ck_assert_int_eq(get_int(100), 200);
+
+    const vector_t *few_sources[2] = {sources[0], sources[2]};
+    const size_t few_lengths[2] = {3, 4000};
+    ck_assert_int_eq(setops_difference(&dest, &length, few_sources, few_lengths, 2, cmp_int, NULL),
+            VECTOR_SUCCESS);
+    ck_assert_uint_eq(length, 0);
+
+    for (size_t s = 0; s < 3; ++s) vector_destroy((vector_t *) sources[s]);
+}
+END_TEST
+
+
+START_TEST (test_setops_intersect_u32)
+{
+    vector_t *a = vector_create(.element_size = sizeof(uint32_t), .initial_cap = 1000);
+    vector_t *b = vector_create(.element_size = sizeof(uint32_t), .initial_cap = 700);
+    vector_t *out = vector_create(.element_size = sizeof(uint32_t), .initial_cap = 1);
+    ck_assert_ptr_nonnull(a);
+    ck_assert_ptr_nonnull(b);
+    ck_assert_ptr_nonnull(out);
+
+    for (uint32_t i = 0; i < 1000; ++i) vector_set(a, i, TMP_REF(uint32_t, i * 7));
+    for (uint32_t i = 0; i < 700; ++i) vector_set(b, i, TMP_REF(uint32_t, i * 5 + 3000000000u));
+    vector_set(b, 0, TMP_REF(uint32_t, 35));
+    vector_set(b, 1, TMP_REF(uint32_t, 70));
+    vector_set(b, 2, TMP_REF(uint32_t, 6993));
+
+    size_t length = 0;
+    ck_assert_int_eq(setops_intersect_u32(&out, &length, a, 1000, b, 700), VECTOR_SUCCESS);
+    ck_assert_uint_eq(length, 3);
+    ck_assert_uint_eq(*(uint32_t *) vector_get(out, 0), 35);
+    ck_assert_uint_eq(*(uint32_t *) vector_get(out, 1), 70);
+    ck_assert_uint_eq(*(uint32_t *) vector_get(out, 2), 6993);
+
+    for (uint32_t i = 0; i < 700; ++i) vector_set(b, i, TMP_REF(uint32_t, i * 5));
+    ck_assert_int_eq(setops_intersect_u32(&out, &length, a, 1000, b, 700), VECTOR_SUCCESS);
+    ck_assert_uint_eq(length, 100); /* multiples of 35 below 3500 */
+    for (size_t i = 0; i < length; ++i)
+    {
+        ck_assert_uint_eq(*(uint32_t *) vector_get(out, i), i * 35);
+    }
+
+    /* detected comparator takes the same path */
+    const vector_t *sources[2] = {a, b};
+    const size_t lengths[2] = {1000, 700};
+    ck_assert_int_eq(setops_intersect(&out, &length, sources, lengths, 2, cmp_u32_asc, NULL), VECTOR_SUCCESS);
+    ck_assert_uint_eq(length, 100);
+
+    /* skewed inputs gallop instead, result is the same */
+    const size_t skewed[2] = {1000, 20};
+    ck_assert_int_eq(setops_intersect(&out, &length, sources, skewed, 2, cmp_u32_asc, NULL), VECTOR_SUCCESS);
+    ck_assert_uint_eq(length, 3); /* 0, 35, 70 */
+    ck_assert_uint_eq(*(uint32_t *) vector_get(out, 2), 70);
+
+    vector_destroy(out);
+    vector_destroy(b);
+    vector_destroy(a);
+}
+END_TEST
+
+
+Suite *setops_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Set Operations");
+
+    /* Core test case */
+    tc_core = tcase_create("Core");
+
+    tcase_add_checked_fixture(tc_core, setup_empty, teardown);
+    tcase_add_test(tc_core, test_setops_merge);
+    tcase_add_test(tc_core, test_setops_intersect_difference);
+    tcase_add_test(tc_core, test_setops_intersect_u32);
+
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+
+int main(void)
+{
+    int number_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = setops_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
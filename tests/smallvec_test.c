@@ -0,0 +1,229 @@
+#include <check.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../src/smallvec.h"
+
+static _Alignas(max_align_t) char storage[SMALLVEC_STORAGE_SIZE(sizeof(int), 4)];
+static vector_t *smallvec;
+
+static void setup_empty(void)
+{
+    smallvec = smallvec_create(
+        .element_size = sizeof(int),
+        .storage = storage,
+        .storage_size = sizeof(storage)
+    );
+    ck_assert_ptr_nonnull(smallvec);
+}
+
+static void teardown(void)
+{
+    vector_destroy(smallvec);
+}
+
+
+static int sum_int(const void *const element, void *const acc, void *const param)
+{
+    (void) param;
+    *(long *) acc += *(const int *) element;
+    return 0;
+}
+
+
+static int double_int(void *const element, void *const param)
+{
+    (void) param;
+    *(int *) element *= 2;
+    return 0;
+}
+
+
+static int count_int(const void *const element, void *const param)
+{
+    (void) element;
+    ++*(size_t *) param;
+    return 0;
+}
+
+
+START_TEST (test_smallvec_create)
+{
+    ck_assert(vector_is_inline(smallvec));
+    ck_assert_ptr_eq(smallvec, (vector_t *) storage);
+    ck_assert_uint_eq(vector_capacity(smallvec), 4);
+    ck_assert_ptr_eq(vector_data(smallvec) + vector_capacity_bytes(smallvec), storage + sizeof(storage));
+}
+END_TEST
+
+
+START_TEST (test_smallvec_inline)
+{
+    for (int i = 0; i < 4; ++i)
+    {
+        vector_set(smallvec, i, &i);
+    }
+    ck_assert_int_eq(*(int *) vector_get(smallvec, 2), 2);
+
+    long sum = 0;
+    ck_assert_int_eq(vector_transform(smallvec, 4, double_int, NULL), 0);
+    ck_assert_int_eq(vector_aggregate(smallvec, 4, sum_int, &sum, NULL), 0);
+    ck_assert_int_eq(sum, 12);
+
+    size_t count = 0;
+    ck_assert_int_eq(vector_foreach(smallvec, 3, count_int, &count), 0);
+    ck_assert_uint_eq(count, 3);
+
+    /* resizing within storage stays inline */
+    ck_assert_int_eq(vector_resize(&smallvec, 2, VECTOR_ALLOC_ERROR), VECTOR_SUCCESS);
+    ck_assert_int_eq(vector_resize_zeroed(&smallvec, 4, VECTOR_ALLOC_ERROR), VECTOR_SUCCESS);
+    ck_assert(vector_is_inline(smallvec));
+    ck_assert_int_eq(*(int *) vector_get(smallvec, 1), 2);
+    ck_assert_int_eq(*(int *) vector_get(smallvec, 3), 0);
+
+    /* clone is an ordinary heap vector */
+    vector_t *clone = vector_clone(smallvec);
+    ck_assert_ptr_nonnull(clone);
+    ck_assert(!vector_is_inline(clone));
+    ck_assert(vector_equal(clone, smallvec));
+    vector_destroy(clone);
+}
+END_TEST
+
+
+START_TEST (test_smallvec_spill)
+{
+    for (int i = 0; i < 4; ++i)
+    {
+        vector_set(smallvec, i, &i);
+    }
+
+    ck_assert_int_eq(vector_resize(&smallvec, 100, VECTOR_ALLOC_ERROR), VECTOR_SUCCESS);
+    ck_assert(!vector_is_inline(smallvec));
+    ck_assert_ptr_ne(smallvec, (vector_t *) storage);
+    ck_assert_uint_eq(vector_capacity(smallvec), 100);
+
+    for (int i = 4; i < 100; ++i)
+    {
+        vector_set(smallvec, i, &i);
+    }
+
+    long sum = 0;
+    ck_assert_int_eq(vector_aggregate(smallvec, 100, sum_int, &sum, NULL), 0);
+    ck_assert_int_eq(sum, 99 * 100 / 2);
+
+    /* spilled vector stays on the heap */
+    ck_assert_int_eq(vector_resize(&smallvec, 3, VECTOR_ALLOC_ERROR), VECTOR_SUCCESS);
+    ck_assert(!vector_is_inline(smallvec));
+    ck_assert_int_eq(*(int *) vector_get(smallvec, 2), 2);
+}
+END_TEST
+
+
+START_TEST (test_smallvec_spill_insert)
+{
+    for (int i = 0; i < 4; ++i)
+    {
+        vector_set(smallvec, i, TMP_REF(int, i * 10));
+    }
+
+    const size_t indices[] = {0, 2, 4};
+    const int values[] = {-1, 15, 40};
+    ck_assert_int_eq(vector_resize_insert_batch(&smallvec, 8, 4, indices, values, 3, VECTOR_ALLOC_ERROR), VECTOR_SUCCESS);
+    ck_assert(!vector_is_inline(smallvec));
+
+    const int expected[] = {-1, 0, 10, 15, 20, 30, 40};
+    ck_assert_mem_eq(vector_data(smallvec), expected, sizeof(expected));
+}
+END_TEST
+
+
+START_TEST (test_smallvec_declare)
+{
+    smallvec_declare(local, double, 8);
+    ck_assert(vector_is_inline(local));
+    ck_assert_uint_eq(vector_capacity(local), 8);
+
+    vector_set(local, 7, TMP_REF(double, 1.5));
+    ck_assert(*(double *) vector_get(local, 7) == 1.5);
+    vector_destroy(local);
+
+    /* allocator data and extension header are kept across spill */
+    const long allocator = 42;
+    _Alignas(max_align_t) char buffer[SMALLVEC_STORAGE_SIZE(sizeof(double), 8) + 2 * sizeof(long)];
+    vector_t *v = smallvec_create(
+        .alloc_opts = alloc_opts(.size = sizeof(allocator), .data = (void *) &allocator),
+        .ext_header_size = sizeof(long),
+        .element_size = sizeof(double),
+        .storage = buffer,
+        .storage_size = sizeof(buffer),
+        .initial_cap = 32
+    );
+    ck_assert_ptr_nonnull(v);
+    ck_assert(!vector_is_inline(v));
+    ck_assert_uint_eq(vector_capacity(v), 32);
+    ck_assert_int_eq(*(long *) vector_alloc_opts(v).data, 42);
+    ck_assert_uint_eq(vector_alloc_opts(v).size, sizeof(allocator));
+    vector_destroy(v);
+
+    /* inline record is not reported as allocator data */
+    v = smallvec_create(
+        .alloc_opts = alloc_opts(.size = sizeof(allocator), .data = (void *) &allocator),
+        .element_size = sizeof(double),
+        .storage = buffer,
+        .storage_size = sizeof(buffer)
+    );
+    ck_assert(vector_is_inline(v));
+    ck_assert_uint_eq(vector_alloc_opts(v).size, sizeof(allocator));
+    ck_assert_int_eq(*(long *) vector_alloc_opts(v).data, 42);
+
+    vector_t *clone = vector_clone(v);
+    ck_assert_ptr_nonnull(clone);
+    ck_assert(!vector_is_inline(clone));
+    ck_assert_uint_eq(vector_alloc_opts(clone).size, sizeof(allocator));
+    ck_assert_uint_eq(vector_capacity(clone), vector_capacity(v));
+    vector_destroy(clone);
+    vector_destroy(v);
+}
+END_TEST
+
+
+Suite *smallvec_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Small Vector");
+
+    /* Core test case */
+    tc_core = tcase_create("Core");
+
+    tcase_add_checked_fixture(tc_core, setup_empty, teardown);
+    tcase_add_test(tc_core, test_smallvec_create);
+    tcase_add_test(tc_core, test_smallvec_inline);
+    tcase_add_test(tc_core, test_smallvec_spill);
+    tcase_add_test(tc_core, test_smallvec_spill_insert);
+    tcase_add_test(tc_core, test_smallvec_declare);
+
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+
+int main(void)
+{
+    int number_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = smallvec_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
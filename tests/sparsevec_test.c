@@ -0,0 +1,175 @@
+#include <check.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../src/sparsevec.h"
+
+static sparsevec_t *sparsevec;
+
+static void setup_empty(void)
+{
+    sparsevec = sparsevec_create(.element_size = sizeof(double), .length = 1000);
+    ck_assert_ptr_nonnull(sparsevec);
+}
+
+static void teardown(void)
+{
+    sparsevec_destroy(sparsevec);
+}
+
+
+static int sum_double(const void *const element, void *const acc, void *const param)
+{
+    (void) param;
+    *(double *) acc += *(const double *) element;
+    return 0;
+}
+
+
+START_TEST (test_sparsevec_create)
+{
+    ck_assert_uint_eq(sparsevec_length(sparsevec), 1000);
+    ck_assert_uint_eq(sparsevec_nonzero(sparsevec), 0);
+    ck_assert_double_eq(*(const double *) sparsevec_get(sparsevec, 999), 0.0);
+}
+END_TEST
+
+
+START_TEST (test_sparsevec_set_get)
+{
+    const size_t positions[] = {500, 3, 999, 0, 250, 3};
+    for (size_t i = 0; i < sizeof(positions) / sizeof(*positions); ++i)
+    {
+        ck_assert_int_eq(sparsevec_set(&sparsevec, positions[i], TMP_REF(double, positions[i] + 0.5)),
+                SPARSEVEC_SUCCESS);
+    }
+
+    ck_assert_uint_eq(sparsevec_nonzero(sparsevec), 5);
+
+    const size_t *indices = sparsevec_indices(sparsevec);
+    const size_t expected[] = {0, 3, 250, 500, 999};
+    for (size_t i = 0; i < 5; ++i)
+    {
+        ck_assert_uint_eq(indices[i], expected[i]);
+        ck_assert_double_eq(*(const double *) sparsevec_get(sparsevec, expected[i]), expected[i] + 0.5);
+    }
+    ck_assert_double_eq(*(const double *) sparsevec_get(sparsevec, 4), 0.0);
+
+    /* zero value removes entry */
+    ck_assert_int_eq(sparsevec_set(&sparsevec, 250, TMP_REF(double, 0.0)), SPARSEVEC_SUCCESS);
+    ck_assert_int_eq(sparsevec_set(&sparsevec, 251, TMP_REF(double, 0.0)), SPARSEVEC_SUCCESS);
+    ck_assert_uint_eq(sparsevec_nonzero(sparsevec), 4);
+    ck_assert_double_eq(*(const double *) sparsevec_get(sparsevec, 250), 0.0);
+    ck_assert_uint_eq(sparsevec_indices(sparsevec)[2], 500);
+
+    double sum = 0.0;
+    ck_assert_int_eq(sparsevec_aggregate(sparsevec, sum_double, &sum, NULL), 0);
+    ck_assert_double_eq(sum, 0.5 + 3.5 + 500.5 + 999.5);
+}
+END_TEST
+
+
+START_TEST (test_sparsevec_dense_roundtrip)
+{
+    vector_t *dense = vector_create(.element_size = sizeof(double), .initial_cap = 1000);
+    ck_assert_ptr_nonnull(dense);
+    vector_zero_range(dense, 0, 1000);
+
+    for (size_t i = 0; i < 1000; i += 7)
+    {
+        vector_set(dense, i, TMP_REF(double, (double) i));
+    }
+
+    sparsevec_t *from = sparsevec_from_dense(dense, 1000);
+    ck_assert_ptr_nonnull(from);
+    ck_assert_uint_eq(sparsevec_nonzero(from), 142); /* index 0 holds zero */
+
+    vector_t *back = vector_create(.element_size = sizeof(double), .initial_cap = 1000);
+    ck_assert_ptr_nonnull(back);
+    vector_set(back, 1, TMP_REF(double, 42.0));
+    sparsevec_to_dense(from, back);
+
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        ck_assert_double_eq(*(double *) vector_get(back, i), *(double *) vector_get(dense, i));
+    }
+
+    vector_destroy(back);
+    sparsevec_destroy(from);
+    vector_destroy(dense);
+}
+END_TEST
+
+
+START_TEST (test_sparsevec_dot)
+{
+    vector_t *dense = vector_create(.element_size = sizeof(double), .initial_cap = 1000);
+    vector_t *dense_f = vector_create(.element_size = sizeof(float), .initial_cap = 1000);
+    sparsevec_t *sparse_f = sparsevec_create(.element_size = sizeof(float), .length = 1000);
+    ck_assert_ptr_nonnull(dense);
+    ck_assert_ptr_nonnull(dense_f);
+    ck_assert_ptr_nonnull(sparse_f);
+
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        vector_set(dense, i, TMP_REF(double, (double) i));
+        vector_set(dense_f, i, TMP_REF(float, (float) (i % 10)));
+    }
+
+    double expected = 0.0;
+    float expected_f = 0.0f;
+    for (size_t i = 1; i < 1000; i += 13)
+    {
+        ck_assert_int_eq(sparsevec_set(&sparsevec, i, TMP_REF(double, 2.0)), SPARSEVEC_SUCCESS);
+        ck_assert_int_eq(sparsevec_set(&sparse_f, i, TMP_REF(float, 0.5f)), SPARSEVEC_SUCCESS);
+        expected += 2.0 * i;
+        expected_f += 0.5f * (i % 10);
+    }
+
+    ck_assert_double_eq(sparsevec_dot_double(sparsevec, dense), expected);
+    ck_assert_float_eq(sparsevec_dot_float(sparse_f, dense_f), expected_f); /* exact in binary */
+
+    sparsevec_destroy(sparse_f);
+    vector_destroy(dense_f);
+    vector_destroy(dense);
+}
+END_TEST
+
+
+Suite *sparsevec_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Sparse Vector");
+
+    /* Core test case */
+    tc_core = tcase_create("Core");
+
+    tcase_add_checked_fixture(tc_core, setup_empty, teardown);
+    tcase_add_test(tc_core, test_sparsevec_create);
+    tcase_add_test(tc_core, test_sparsevec_set_get);
+    tcase_add_test(tc_core, test_sparsevec_dense_roundtrip);
+    tcase_add_test(tc_core, test_sparsevec_dot);
+
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+
+int main(void)
+{
+    int number_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = sparsevec_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
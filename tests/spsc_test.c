@@ -0,0 +1,159 @@
+#include <check.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../src/spsc.h"
+
+static spsc_t *queue;
+
+static void setup_empty(void)
+{
+    queue = spsc_create(
+       .element_size = sizeof(int),
+       .capacity = 8
+    );
+    ck_assert_ptr_nonnull(queue);
+}
+
+static void teardown(void)
+{
+    spsc_destroy(queue);
+}
+
+
+START_TEST (test_spsc_create)
+{
+    ck_assert_uint_eq(spsc_capacity(queue), 8);
+    ck_assert_uint_eq(spsc_size(queue), 0);
+
+    spsc_t *q = spsc_create(.element_size = sizeof(int), .capacity = 9);
+    ck_assert_uint_eq(spsc_capacity(q), 16);
+    spsc_destroy(q);
+}
+END_TEST
+
+
+START_TEST (test_spsc_push_pop)
+{
+    int value;
+    ck_assert(!spsc_try_pop(queue, &value));
+
+    for (int i = 0; i < 8; ++i)
+    {
+        ck_assert(spsc_try_push(queue, &i));
+    }
+    ck_assert(!spsc_try_push(queue, TMP_REF(int, 8)));
+    ck_assert_uint_eq(spsc_size(queue), 8);
+
+    for (int i = 0; i < 8; ++i)
+    {
+        ck_assert(spsc_try_pop(queue, &value));
+        ck_assert_int_eq(value, i);
+    }
+    ck_assert(!spsc_try_pop(queue, &value));
+}
+END_TEST
+
+
+START_TEST (test_spsc_publish_consume)
+{
+    const int values[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    int out[10];
+
+    ck_assert_uint_eq(spsc_publish(queue, values, 5), 5);
+    ck_assert_uint_eq(spsc_consume(queue, out, 3), 3);
+    ck_assert_mem_eq(out, values, 3 * sizeof(int));
+
+    /* wraps around, only free slots are published */
+    ck_assert_uint_eq(spsc_publish(queue, values + 5, 5), 5);
+    ck_assert_uint_eq(spsc_publish(queue, values, 10), 1);
+    ck_assert_uint_eq(spsc_consume(queue, out, 10), 8);
+    ck_assert_mem_eq(out, values + 3, 7 * sizeof(int));
+    ck_assert_int_eq(out[7], 0);
+    ck_assert_uint_eq(spsc_consume(queue, out, 10), 0);
+}
+END_TEST
+
+
+#define RECORDS 20000
+
+static void *producer(void *param)
+{
+    spsc_t *q = param;
+    int batch[7];
+    for (int i = 0; i < RECORDS;)
+    {
+        int n = 0;
+        for (; n < 7 && i + n < RECORDS; ++n) batch[n] = i + n;
+        size_t sent = 0;
+        while (sent < (size_t)n)
+        {
+            sent += spsc_publish(q, batch + sent, n - sent);
+        }
+        i += n;
+    }
+    return NULL;
+}
+
+START_TEST (test_spsc_threads)
+{
+    spsc_t *q = spsc_create(.element_size = sizeof(int), .capacity = 256);
+    pthread_t thread;
+    ck_assert_int_eq(0, pthread_create(&thread, NULL, producer, q));
+
+    int expected = 0;
+    int out[5];
+    while (expected < RECORDS)
+    {
+        const size_t got = spsc_consume(q, out, 5);
+        for (size_t i = 0; i < got; ++i)
+        {
+            ck_assert_int_eq(out[i], expected++);
+        }
+    }
+
+    pthread_join(thread, NULL);
+    ck_assert_uint_eq(spsc_size(q), 0);
+    spsc_destroy(q);
+}
+END_TEST
+
+
+Suite *spsc_suite(void)
+{
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("SPSC");
+
+    /* Core test case */
+    tc_core = tcase_create("Core");
+
+    tcase_add_checked_fixture(tc_core, setup_empty, teardown);
+    tcase_add_test(tc_core, test_spsc_create);
+    tcase_add_test(tc_core, test_spsc_push_pop);
+    tcase_add_test(tc_core, test_spsc_publish_consume);
+    tcase_add_test(tc_core, test_spsc_threads);
+
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+
+int main(void)
+{
+    int number_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = spsc_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
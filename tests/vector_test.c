@@ -1,6 +1,8 @@
 #include <check.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 
 #include "../src/vector.h"
@@ -220,6 +222,49 @@ START_TEST (test_vector_resize)
 END_TEST
 
 
+START_TEST (test_vector_create_zero_init)
+{
+    vector_t *v = vector_create(.element_size = sizeof(int), .initial_cap = 100, .zero_init = true);
+    ck_assert_ptr_nonnull(v);
+    ck_assert_uint_eq(vector_capacity(v), 100);
+
+    for (size_t i = 0; i < vector_capacity(v); ++i)
+    {
+        ck_assert_int_eq(0, *(int*) vector_get(v, i));
+    }
+
+    vector_destroy(v);
+}
+END_TEST
+
+
+START_TEST (test_vector_resize_zeroed)
+{
+    const size_t capacity = vector_capacity(vector);
+    random_fill(vector, capacity);
+    int *expected = malloc(sizeof(int) * capacity);
+    vector_copy(vector, (char*) expected, 0, capacity);
+
+    const size_t grown_cap = 1024;
+    ck_assert_uint_eq(VECTOR_SUCCESS, vector_resize_zeroed(&vector, grown_cap, VECTOR_ALLOC_ERROR));
+    ck_assert_uint_eq(vector_capacity(vector), grown_cap);
+
+    ck_assert_mem_eq(vector_get(vector, 0), expected, sizeof(int) * capacity);
+    for (size_t i = capacity; i < grown_cap; ++i)
+    {
+        ck_assert_int_eq(0, *(int*) vector_get(vector, i));
+    }
+
+    /* shrinking behaves as regular resize */
+    ck_assert_uint_eq(VECTOR_SUCCESS, vector_resize_zeroed(&vector, capacity, VECTOR_ALLOC_ERROR));
+    ck_assert_uint_eq(vector_capacity(vector), capacity);
+    ck_assert_mem_eq(vector_get(vector, 0), expected, sizeof(int) * capacity);
+
+    free(expected);
+}
+END_TEST
+
+
 START_TEST (test_vector_copy)
 {
     const size_t capacity = vector_capacity(vector);
@@ -290,6 +335,271 @@ START_TEST (test_vector_shift)
 END_TEST
 
 
+START_TEST (test_vector_insert_batch)
+{
+    const int data[] = {0, 1, 2, 3, 4};
+    memcpy(vector_get(vector, 0), data, sizeof(data));
+
+    const size_t indices[] = {0, 2, 2, 5};
+    const int values[] = {10, 11, 12, 13};
+    vector_insert_batch(vector, 5, indices, values, 4);
+
+    const int expected[] = {10, 0, 1, 11, 12, 2, 3, 4, 13};
+    ck_assert_mem_eq(vector_get(vector, 0), expected, sizeof(expected));
+}
+END_TEST
+
+
+START_TEST (test_vector_resize_insert_batch)
+{
+    const int data[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    memcpy(vector_get(vector, 0), data, sizeof(data));
+
+    const size_t indices[] = {1, 9, 10};
+    const int values[] = {-1, -9, -10};
+    ck_assert_uint_eq(VECTOR_SUCCESS,
+            vector_resize_insert_batch(&vector, 20, 10, indices, values, 3, VECTOR_ALLOC_ERROR));
+    ck_assert_uint_eq(vector_capacity(vector), 20);
+
+    const int expected[] = {0, -1, 1, 2, 3, 4, 5, 6, 7, 8, -9, 9, -10};
+    ck_assert_mem_eq(vector_get(vector, 0), expected, sizeof(expected));
+
+    /* fits into current capacity, performed in place */
+    const size_t front[] = {0};
+    ck_assert_uint_eq(VECTOR_SUCCESS,
+            vector_resize_insert_batch(&vector, 20, 13, front, TMP_REF(int, 42), 1, VECTOR_ALLOC_ERROR));
+    ck_assert_int_eq(*(int*) vector_get(vector, 0), 42);
+    ck_assert_mem_eq(vector_get(vector, 1), expected, sizeof(expected));
+}
+END_TEST
+
+
+START_TEST (test_vector_erase_batch)
+{
+    const int data[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    memcpy(vector_get(vector, 0), data, sizeof(data));
+
+    const size_t indices[] = {0, 3, 4, 9};
+    const size_t length = vector_erase_batch(vector, 10, indices, 4);
+
+    const int expected[] = {1, 2, 5, 6, 7, 8};
+    ck_assert_uint_eq(length, 6);
+    ck_assert_mem_eq(vector_get(vector, 0), expected, sizeof(expected));
+
+    ck_assert_uint_eq(vector_erase_batch(vector, length, NULL, 0), length);
+}
+END_TEST
+
+
+static bool is_odd(const void *const element, void *const param)
+{
+    (void) param;
+    return *(const int*)element % 2;
+}
+
+
+static bool is_odd_counted(const void *const element, void *const param)
+{
+    ++*(size_t*)param;
+    return *(const int*)element % 2;
+}
+
+
+START_TEST (test_vector_remove_if)
+{
+    const int data[] = {1, 2, 3, 5, 6, 8, 10, 11, 12, 13};
+    memcpy(vector_get(vector, 0), data, sizeof(data));
+
+    const size_t length = vector_remove_if(vector, 10, is_odd, NULL);
+
+    const int expected[] = {2, 6, 8, 10, 12};
+    ck_assert_uint_eq(length, 5);
+    ck_assert_mem_eq(vector_get(vector, 0), expected, sizeof(expected));
+
+    /* predicate is called once per element, also on alternating runs */
+    const int alternating[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    memcpy(vector_get(vector, 0), alternating, sizeof(alternating));
+
+    size_t calls = 0;
+    ck_assert_uint_eq(vector_remove_if(vector, 10, is_odd_counted, &calls), 5);
+    ck_assert_uint_eq(calls, 10);
+    ck_assert_int_eq(*(int*) vector_get(vector, 4), 10);
+}
+END_TEST
+
+
+START_TEST (test_vector_remove_key)
+{
+    /* plain 4 byte keys, length is not a multiple of SIMD block */
+    const size_t capacity = 1003;
+    ck_assert_uint_eq(VECTOR_SUCCESS, vector_resize(&vector, capacity, VECTOR_ALLOC_ERROR));
+    size_t expected_length = 0;
+    for (int i = 0; i < (int)capacity; ++i)
+    {
+        const int value = (i % 3 && i % 7) ? i : 0;
+        expected_length += value != 0;
+        vector_set(vector, i, &value);
+    }
+
+    const size_t length = vector_remove_key(vector, capacity, 0, sizeof(int), TMP_REF(int, 0));
+    ck_assert_uint_eq(length, expected_length);
+
+    int prev = 0;
+    for (size_t i = 0; i < length; ++i)
+    {
+        const int value = *(int*) vector_get(vector, i);
+        ck_assert_int_ne(value, 0);
+        ck_assert_int_gt(value, prev);
+        prev = value;
+    }
+
+    /* odd extension header leaves data misaligned for 4 byte keys */
+    vector_t *v = vector_create(.element_size = sizeof(uint32_t), .initial_cap = 11, .ext_header_size = 3);
+    ck_assert_ptr_nonnull(v);
+    for (uint32_t i = 0; i < 11; ++i) vector_set(v, i, TMP_REF(uint32_t, i % 2 ? 7 : i));
+
+    ck_assert_uint_eq(vector_remove_key(v, 11, 0, sizeof(uint32_t), TMP_REF(uint32_t, 7)), 6);
+    uint32_t last;
+    memcpy(&last, vector_get(v, 5), sizeof(last));
+    ck_assert_uint_eq(last, 10);
+    vector_destroy(v);
+}
+END_TEST
+
+
+START_TEST (test_vector_remove_key_records)
+{
+    typedef struct { long payload; short alive; char pad[6]; } record_t;
+
+    vector_t *v = vector_create(.element_size = sizeof(record_t), .initial_cap = 9);
+    for (size_t i = 0; i < 9; ++i)
+    {
+        vector_set(v, i, &(record_t){.payload = (long)i, .alive = (short)(i % 3 != 1)});
+    }
+
+    const size_t length = vector_remove_key(v, 9, offsetof(record_t, alive), sizeof(short), TMP_REF(short, 0));
+
+    const long expected[] = {0, 2, 3, 5, 6, 8};
+    ck_assert_uint_eq(length, 6);
+    for (size_t i = 0; i < length; ++i)
+    {
+        ck_assert_int_eq(((record_t*) vector_get(v, i))->payload, expected[i]);
+    }
+
+    vector_destroy(v);
+}
+END_TEST
+
+
+START_TEST (test_vector_unique)
+{
+    const int input[] = {1, 1, 2, 3, 3, 3, 7, 8, 8, 9};
+    for (size_t i = 0; i < 10; ++i) vector_set(vector, i, &input[i]);
+
+    const size_t length = vector_unique(vector, 10, cmp_lex_asc, (void *)sizeof(int));
+
+    const int expected[] = {1, 2, 3, 7, 8, 9};
+    ck_assert_uint_eq(length, 6);
+    for (size_t i = 0; i < length; ++i)
+    {
+        ck_assert_int_eq(*(int*) vector_get(vector, i), expected[i]);
+    }
+
+    ck_assert_uint_eq(vector_unique(vector, 1, cmp_lex_asc, (void *)sizeof(int)), 1);
+    ck_assert_uint_eq(vector_unique(vector, 0, cmp_lex_asc, (void *)sizeof(int)), 0);
+}
+END_TEST
+
+
+START_TEST (test_vector_unique_records)
+{
+    typedef struct { char key[3]; char tag; } record_t;
+
+    vector_t *v = vector_create(.element_size = sizeof(record_t), .initial_cap = 6);
+    const record_t input[] = {{"aa", 0}, {"aa", 1}, {"ab", 2}, {"ab", 3}, {"ab", 4}, {"b", 5}};
+    for (size_t i = 0; i < 6; ++i) vector_set(v, i, &input[i]);
+
+    /* prefix key goes the generic bytewise path, first of each run is kept */
+    const size_t length = vector_unique(v, 6, cmp_lex_dsc, (void *)sizeof(input[0].key));
+
+    const char expected[] = {0, 2, 5};
+    ck_assert_uint_eq(length, 3);
+    for (size_t i = 0; i < length; ++i)
+    {
+        ck_assert_int_eq(((record_t*) vector_get(v, i))->tag, expected[i]);
+    }
+
+    vector_destroy(v);
+}
+END_TEST
+
+
+START_TEST (test_vector_run_length)
+{
+    const int input[] = {4, 4, 4, 5, 6, 6, 4, 4, 9, 9};
+    for (size_t i = 0; i < 10; ++i) vector_set(vector, i, &input[i]);
+
+    vector_t *values = vector_create(.element_size = sizeof(int), .initial_cap = 1);
+    vector_t *counts = vector_create(.element_size = sizeof(size_t), .initial_cap = 1);
+    size_t runs = 0;
+
+    ck_assert_int_eq(vector_run_length(vector, 10, cmp_lex_asc, (void *)sizeof(int), &values, &counts, &runs),
+            VECTOR_SUCCESS);
+
+    const int expected_values[] = {4, 5, 6, 4, 9};
+    const size_t expected_counts[] = {3, 1, 2, 2, 2};
+    ck_assert_uint_eq(runs, 5);
+    ck_assert_uint_ge(vector_capacity(values), 5);
+    for (size_t i = 0; i < runs; ++i)
+    {
+        ck_assert_int_eq(*(int*) vector_get(values, i), expected_values[i]);
+        ck_assert_uint_eq(*(size_t*) vector_get(counts, i), expected_counts[i]);
+    }
+
+    ck_assert_int_eq(vector_run_length(vector, 0, cmp_lex_asc, (void *)sizeof(int), &values, &counts, &runs),
+            VECTOR_SUCCESS);
+    ck_assert_uint_eq(runs, 0);
+
+    vector_destroy(counts);
+    vector_destroy(values);
+}
+END_TEST
+
+
+START_TEST (test_vector_run_length_misaligned)
+{
+    /* odd extension headers leave word paths misaligned */
+    vector_t *v = vector_create(.element_size = sizeof(uint32_t), .initial_cap = 300, .ext_header_size = 3);
+    vector_t *values = vector_create(.element_size = sizeof(uint32_t), .initial_cap = 1, .ext_header_size = 5);
+    vector_t *counts = vector_create(.element_size = sizeof(size_t), .initial_cap = 1, .ext_header_size = 1);
+    for (uint32_t i = 0; i < 300; ++i) vector_set(v, i, TMP_REF(uint32_t, i / 3));
+
+    /* outputs grow along the way, 100 runs of 3 */
+    size_t runs = 0;
+    ck_assert_int_eq(vector_run_length(v, 300, cmp_u32_asc, NULL, &values, &counts, &runs), VECTOR_SUCCESS);
+    ck_assert_uint_eq(runs, 100);
+    for (size_t i = 0; i < runs; ++i)
+    {
+        uint32_t value;
+        size_t count;
+        memcpy(&value, vector_get(values, i), sizeof(value));
+        memcpy(&count, vector_get(counts, i), sizeof(count));
+        ck_assert_uint_eq(value, i);
+        ck_assert_uint_eq(count, 3);
+    }
+
+    ck_assert_uint_eq(vector_unique(v, 300, cmp_u32_asc, NULL), 100);
+    uint32_t last;
+    memcpy(&last, vector_get(v, 99), sizeof(last));
+    ck_assert_uint_eq(last, 99);
+
+    vector_destroy(counts);
+    vector_destroy(values);
+    vector_destroy(v);
+}
+END_TEST
+
+
 START_TEST (test_vector_swap)
 {
     const size_t capacity = vector_capacity(vector);
@@ -470,6 +780,133 @@ START_TEST (test_vector_binary_find_lex_dsc)
 END_TEST
 
 
+START_TEST (test_vector_cmp_lex_fixed)
+{
+    const compare_t asc[] = {cmp_lex4_asc, cmp_lex8_asc, cmp_lex16_asc, cmp_lex32_asc};
+    const compare_t dsc[] = {cmp_lex4_dsc, cmp_lex8_dsc, cmp_lex16_dsc, cmp_lex32_dsc};
+    const size_t sizes[] = {4, 8, 16, 32};
+    unsigned char a[32], b[32];
+
+    srand(time(0));
+    for (size_t k = 0; k < 4; ++k)
+    {
+        for (int round = 0; round < 1000; ++round)
+        {
+            for (size_t i = 0; i < sizes[k]; ++i)
+            {
+                a[i] = (unsigned char)rand();
+                b[i] = (round % 2) ? a[i] : (unsigned char)rand();
+            }
+            b[rand() % sizes[k]] ^= (unsigned char)(round % 4 ? 0 : 0x80);
+
+            const int expected = memcmp(a, b, sizes[k]);
+            const ssize_t order = asc[k](a, b, NULL);
+            ck_assert_int_eq((order > 0) - (order < 0), (expected > 0) - (expected < 0));
+            ck_assert_int_eq((dsc[k](a, b, NULL) > 0) - (dsc[k](a, b, NULL) < 0), -((order > 0) - (order < 0)));
+        }
+    }
+}
+END_TEST
+
+
+START_TEST (test_vector_cmp_native)
+{
+    ck_assert_int_lt(cmp_u32_asc(TMP_REF(uint32_t, 1), TMP_REF(uint32_t, 0x80000000u), NULL), 0);
+    ck_assert_int_gt(cmp_i32_asc(TMP_REF(int32_t, 1), TMP_REF(int32_t, -5), NULL), 0);
+    ck_assert_int_gt(cmp_i32_dsc(TMP_REF(int32_t, -5), TMP_REF(int32_t, 1), NULL), 0);
+    ck_assert_int_lt(cmp_u64_asc(TMP_REF(uint64_t, 1), TMP_REF(uint64_t, UINT64_MAX), NULL), 0);
+    ck_assert_int_lt(cmp_i64_asc(TMP_REF(int64_t, INT64_MIN), TMP_REF(int64_t, 0), NULL), 0);
+    ck_assert_int_eq(cmp_float_asc(TMP_REF(float, -0.0f), TMP_REF(float, 0.0f), NULL), 0);
+    ck_assert_int_lt(cmp_float_asc(TMP_REF(float, -1.5f), TMP_REF(float, 0.5f), NULL), 0);
+    ck_assert_int_gt(cmp_double_dsc(TMP_REF(double, -1.5), TMP_REF(double, 0.5), NULL), 0);
+    ck_assert_int_eq(cmp_u64_dsc(TMP_REF(uint64_t, 7), TMP_REF(uint64_t, 7), NULL), 0);
+
+    /* specialized comparators are detected by search */
+    const int data[] = {-100, -1, 0, 10, 12, 20, 21, 30, 34, 60};
+    memcpy(vector_get(vector, 0), data, sizeof(data));
+
+    for (size_t i = 0; i < 10; ++i)
+    {
+        ck_assert_int_eq(vector_binary_find_index(vector, &data[i], 10, cmp_i32_asc, NULL), (ssize_t)i);
+    }
+    ck_assert_int_eq(vector_binary_find_index(vector, TMP_REF(int, 11), 10, cmp_i32_asc, NULL), -1);
+    ck_assert_ptr_null(vector_binary_find(vector, TMP_REF(int, 61), 10, cmp_i32_asc, NULL));
+
+    const int duplicates[] = {-3, -3, 0, 0, 0, 5, 5, 7, 8, 8};
+    memcpy(vector_get(vector, 0), duplicates, sizeof(duplicates));
+    ck_assert_uint_eq(vector_unique(vector, 10, cmp_i32_asc, NULL), 5);
+    ck_assert_int_eq(*(int*) vector_get(vector, 4), 8);
+}
+END_TEST
+
+
+START_TEST (test_vector_hash)
+{
+    for (int i = 0; i < 10; ++i) *(int*) vector_get(vector, i) = i * 3;
+
+    const uint64_t full = vector_hash(vector, 0, 10, 0);
+    ck_assert_uint_eq(full, vector_hash_bytes(vector_data(vector), 10 * sizeof(int), 0));
+    ck_assert_uint_ne(full, vector_hash(vector, 0, 10, 1));
+    ck_assert_uint_ne(full, vector_hash(vector, 0, 9, 0));
+    ck_assert_uint_eq(vector_hash(vector, 2, 5, 0), vector_hash_bytes(vector_get(vector, 2), 5 * sizeof(int), 0));
+
+    *(int*) vector_get(vector, 7) ^= 1;
+    ck_assert_uint_ne(full, vector_hash(vector, 0, 10, 0));
+
+    const vector_hash128_t wide = vector_hash128(vector, 0, 10, 0);
+    ck_assert_uint_eq(wide.low, vector_hash(vector, 0, 10, 0));
+    ck_assert_uint_ne(wide.low, wide.high);
+
+    /* multi-chunk hash is a fold of chunk digests */
+    vector_t *big = vector_create(.element_size = 1, .initial_cap = VECTOR_HASH_CHUNK * 2 + 100);
+    ck_assert_ptr_nonnull(big);
+    for (size_t i = 0; i < vector_capacity(big); ++i) vector_data(big)[i] = (char) (i * 31);
+
+    const size_t size = vector_capacity(big);
+    const uint64_t digests[] = {
+        vector_hash_bytes(vector_data(big), VECTOR_HASH_CHUNK, 5),
+        vector_hash_bytes(vector_data(big) + VECTOR_HASH_CHUNK, VECTOR_HASH_CHUNK, 5),
+        vector_hash_bytes(vector_data(big) + 2 * VECTOR_HASH_CHUNK, 100, 5),
+    };
+    ck_assert_uint_eq(vector_hash(big, 0, size, 5), vector_hash_fold(digests, 3, size, 5));
+    vector_destroy(big);
+}
+END_TEST
+
+
+START_TEST (test_vector_equal)
+{
+    for (int i = 0; i < 10; ++i) *(int*) vector_get(vector, i) = i;
+
+    vector_t *other = vector_clone(vector);
+    ck_assert_ptr_nonnull(other);
+    ck_assert(vector_equal(vector, vector));
+    ck_assert(vector_equal(vector, other));
+    ck_assert_int_eq(vector_compare_range(vector, other, 0, 10), -1);
+
+    *(int*) vector_get(other, 6) = -1;
+    ck_assert(!vector_equal(vector, other));
+    ck_assert_int_eq(vector_compare_range(vector, other, 0, 10), 6);
+    ck_assert_int_eq(vector_compare_range(vector, other, 2, 4), -1);
+    ck_assert_int_eq(vector_compare_range(vector, other, 7, 3), -1);
+
+    /* a single flipped bit deep in a wide range is located */
+    vector_t *a = vector_create(.element_size = 1, .initial_cap = 1000);
+    vector_t *b = vector_create(.element_size = 1, .initial_cap = 1000);
+    memset(vector_data(a), 0x5a, 1000);
+    memset(vector_data(b), 0x5a, 1000);
+    vector_data(b)[777] ^= 0x10;
+    ck_assert_int_eq(vector_compare_range(a, b, 0, 1000), 777);
+    ck_assert_int_eq(vector_compare_range(a, b, 778, 222), -1);
+    ck_assert(!vector_equal(a, b));
+
+    vector_destroy(a);
+    vector_destroy(b);
+    vector_destroy(other);
+}
+END_TEST
+
+
 START_TEST (test_vector_binary_find_index)
 {
     const size_t capacity = vector_capacity(vector);
@@ -520,6 +957,145 @@ START_TEST (test_vector_spread)
 END_TEST
 
 
+START_TEST (test_vector_fill_range)
+{
+    const size_t capacity = vector_capacity(vector);
+    random_fill(vector, capacity);
+
+    const int value = 0x11223344;
+    vector_fill_range(vector, 2, 6, &value);
+
+    for (size_t i = 2; i < 8; ++i)
+    {
+        ck_assert_mem_eq(&value, vector_get(vector, i), sizeof(int));
+    }
+}
+END_TEST
+
+
+START_TEST (test_vector_fill_range_stream)
+{
+    /* odd element size exercises pattern phase of streaming stores */
+    const char value[3] = {'a', 'b', 'c'};
+    const size_t capacity = VECTOR_STREAM_THRESHOLD / sizeof(value) + 123;
+    vector_t *v = vector_create(.element_size = sizeof(value), .initial_cap = capacity);
+    ck_assert_ptr_nonnull(v);
+
+    vector_fill_range(v, 1, capacity - 1, value);
+
+    for (size_t i = 1; i < capacity; ++i)
+    {
+        ck_assert_mem_eq(value, vector_get(v, i), sizeof(value));
+    }
+
+    vector_destroy(v);
+}
+END_TEST
+
+
+START_TEST (test_vector_fill_range_element_sizes)
+{
+    const size_t sizes[] = {1, 2, 3, 4, 8, 16, 24};
+    const char value[24] = "0123456789abcdefghijklm";
+
+    for (size_t s = 0; s < sizeof(sizes)/sizeof(sizes[0]); ++s)
+    {
+        const size_t element_size = sizes[s];
+        const size_t capacities[] = {37, VECTOR_STREAM_THRESHOLD / element_size + 3};
+
+        for (size_t c = 0; c < 2; ++c)
+        {
+            const size_t capacity = capacities[c];
+            vector_t *v = vector_create(.element_size = element_size, .initial_cap = capacity);
+            ck_assert_ptr_nonnull(v);
+            vector_zero_range(v, 0, capacity);
+
+            /* odd offset to misalign destination */
+            vector_fill_range(v, 1, capacity - 2, value);
+
+            ck_assert_mem_ne(value, vector_get(v, 0), element_size);
+            for (size_t i = 1; i < capacity - 1; ++i)
+            {
+                ck_assert_mem_eq(value, vector_get(v, i), element_size);
+            }
+            ck_assert_mem_ne(value, vector_get(v, capacity - 1), element_size);
+
+            vector_destroy(v);
+        }
+    }
+}
+END_TEST
+
+
+START_TEST (test_vector_zero_range_lazy)
+{
+    const size_t capacity = 2 * VECTOR_STREAM_THRESHOLD / sizeof(int) + 3;
+    ck_assert_uint_eq(VECTOR_SUCCESS, vector_resize(&vector, capacity, VECTOR_ALLOC_ERROR));
+
+    const int value = -1;
+    const int expected = 0x0;
+    vector_fill_range(vector, 0, capacity, &value);
+
+    vector_zero_range_lazy(vector, 1, capacity - 2);
+
+    ck_assert_mem_eq(&value, vector_get(vector, 0), sizeof(int));
+    for (size_t i = 1; i < capacity - 1; ++i)
+    {
+        ck_assert_mem_eq(&expected, vector_get(vector, i), sizeof(int));
+    }
+    ck_assert_mem_eq(&value, vector_get(vector, capacity - 1), sizeof(int));
+}
+END_TEST
+
+
+START_TEST (test_vector_zero_range)
+{
+    const size_t capacity = VECTOR_STREAM_THRESHOLD / sizeof(int) + 7;
+    ck_assert_uint_eq(VECTOR_SUCCESS, vector_resize(&vector, capacity, VECTOR_ALLOC_ERROR));
+
+    const int value = -1;
+    const int expected = 0x0;
+    vector_fill_range(vector, 0, capacity, &value);
+
+    vector_zero_range(vector, 1, 3);
+    ck_assert_mem_eq(&value, vector_get(vector, 0), sizeof(int));
+    ck_assert_mem_eq(&expected, vector_get(vector, 3), sizeof(int));
+    ck_assert_mem_eq(&value, vector_get(vector, 4), sizeof(int));
+
+    vector_zero_range(vector, 1, capacity - 2);
+    for (size_t i = 1; i < capacity - 1; ++i)
+    {
+        ck_assert_mem_eq(&expected, vector_get(vector, i), sizeof(int));
+    }
+    ck_assert_mem_eq(&value, vector_get(vector, capacity - 1), sizeof(int));
+}
+END_TEST
+
+
+START_TEST (test_vector_stream_copy)
+{
+    const size_t capacity = VECTOR_STREAM_THRESHOLD / sizeof(int) + 5;
+    ck_assert_uint_eq(VECTOR_SUCCESS, vector_resize(&vector, capacity, VECTOR_ALLOC_ERROR));
+    for (int i = 0; i < (int)capacity; ++i)
+    {
+        vector_set(vector, i, &i);
+    }
+
+    int *output = malloc(capacity * sizeof(int));
+    ck_assert_ptr_nonnull(output);
+
+    vector_stream_copy(vector, (char*) output, 0, 3);
+    ck_assert_mem_eq(vector_get(vector, 0), output, sizeof(int) * 3);
+
+    /* misaligned destination */
+    vector_stream_copy(vector, (char*) output + 1, 1, capacity - 2);
+    ck_assert_mem_eq(vector_get(vector, 1), (char*) output + 1, sizeof(int) * (capacity - 2));
+
+    free(output);
+}
+END_TEST
+
+
 #define MAXBUFSIZE 256
 struct buf
 {
@@ -673,17 +1249,39 @@ Suite *vector_suite(void)
     tcase_add_test(tc_core, test_vector_data);
     tcase_add_test(tc_core, test_calc_aligned_size);
     tcase_add_test(tc_core, test_vector_resize);
+    tcase_add_test(tc_core, test_vector_create_zero_init);
+    tcase_add_test(tc_core, test_vector_resize_zeroed);
     tcase_add_test(tc_core, test_vector_copy);
     tcase_add_test(tc_core, test_vector_move);
     tcase_add_test(tc_core, test_vector_shift);
     tcase_add_test(tc_core, test_vector_spread);
+    tcase_add_test(tc_core, test_vector_fill_range);
+    tcase_add_test(tc_core, test_vector_fill_range_stream);
+    tcase_add_test(tc_core, test_vector_fill_range_element_sizes);
+    tcase_add_test(tc_core, test_vector_zero_range);
+    tcase_add_test(tc_core, test_vector_zero_range_lazy);
+    tcase_add_test(tc_core, test_vector_stream_copy);
     tcase_add_test(tc_core, test_vector_swap);
+    tcase_add_test(tc_core, test_vector_insert_batch);
+    tcase_add_test(tc_core, test_vector_resize_insert_batch);
+    tcase_add_test(tc_core, test_vector_erase_batch);
+    tcase_add_test(tc_core, test_vector_remove_if);
+    tcase_add_test(tc_core, test_vector_remove_key);
+    tcase_add_test(tc_core, test_vector_remove_key_records);
+    tcase_add_test(tc_core, test_vector_unique);
+    tcase_add_test(tc_core, test_vector_unique_records);
+    tcase_add_test(tc_core, test_vector_run_length);
+    tcase_add_test(tc_core, test_vector_run_length_misaligned);
     tcase_add_test(tc_core, test_vector_part_copy);
     tcase_add_test(tc_core, test_vector_linear_find);
     tcase_add_test(tc_core, test_vector_binary_find);
     tcase_add_test(tc_core, test_vector_binary_find_none);
     tcase_add_test(tc_core, test_vector_binary_find_lex);
     tcase_add_test(tc_core, test_vector_binary_find_lex_dsc);
+    tcase_add_test(tc_core, test_vector_cmp_lex_fixed);
+    tcase_add_test(tc_core, test_vector_cmp_native);
+    tcase_add_test(tc_core, test_vector_hash);
+    tcase_add_test(tc_core, test_vector_equal);
     tcase_add_test(tc_core, test_vector_binary_find_index);
     tcase_add_test(tc_core, test_vector_binary_find_index_none);
     tcase_add_test(tc_core, test_vector_foreach);
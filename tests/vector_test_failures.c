@@ -35,6 +35,17 @@ void* vector_alloc(size_t size, void *const param)
 }
 
 
+void* vector_calloc(size_t size, void *const param)
+{
+    void *block = vector_alloc(size, param);
+    if (block)
+    {
+        memset(block, 0x00, size);
+    }
+    return block;
+}
+
+
 void *vector_realloc(void *ptr, size_t size, void *const param)
 {
     mock_alloc_t *alloc = ((alloc_param_t*)param)->allocator;
@@ -231,6 +242,78 @@ START_TEST (test_vector_resize)
 END_TEST
 
 
+START_TEST (test_vector_resize_zeroed)
+{
+    mock_alloc_t alloc = { .limit = MOCK_MEMORY_MAX };
+    alloc_param_t alloc_param = { &alloc }; /* struct will be copied into the vectors memory region */
+
+    vector_t *vec = vector_create(
+        .element_size = sizeof(int),
+        .initial_cap = 10,
+        .zero_init = true,
+        .alloc_opts = alloc_opts(
+            .size = sizeof(alloc_param),
+            .data = &alloc_param
+        ),
+    );
+    ck_assert_ptr_nonnull(vec);
+
+    ck_assert_uint_eq(VECTOR_SUCCESS, vector_resize_zeroed(&vec, 11, 999));
+    ck_assert_int_eq(0, *(int*) vector_get(vec, 10));
+    ck_assert_uint_eq(VECTOR_ALLOC_ERROR, vector_resize_zeroed(&vec, alloc.limit, VECTOR_ALLOC_ERROR));
+
+    vector_destroy(vec);
+}
+END_TEST
+
+
+START_TEST (test_vector_resize_insert_batch_failure)
+{
+    mock_alloc_t alloc = { .limit = MOCK_MEMORY_MAX };
+    alloc_param_t alloc_param = { &alloc }; /* struct will be copied into the vectors memory region */
+
+    vector_t *vec = vector_create(
+        .element_size = sizeof(int),
+        .initial_cap = 10,
+        .alloc_opts = alloc_opts(
+            .size = sizeof(alloc_param),
+            .data = &alloc_param
+        ),
+    );
+    ck_assert_ptr_nonnull(vec);
+    vector_t *orig = vec;
+
+    const size_t indices[] = {0};
+    ck_assert_uint_eq(VECTOR_ALLOC_ERROR,
+            vector_resize_insert_batch(&vec, alloc.limit, 10, indices, &(int){1}, 1, VECTOR_ALLOC_ERROR));
+    ck_assert_ptr_eq(vec, orig);
+    ck_assert_uint_eq(vector_capacity(vec), 10);
+
+    vector_destroy(vec);
+}
+END_TEST
+
+
+START_TEST (test_vector_zero_init_failure)
+{
+    mock_alloc_t alloc = { .limit = MOCK_MEMORY_MAX };
+    alloc_param_t alloc_param = { &alloc }; /* struct will be copied into the vectors memory region */
+
+    vector_t *vec = vector_create(
+        .element_size = sizeof(int),
+        .initial_cap = (MOCK_MEMORY_MAX / sizeof(int)),
+        .zero_init = true,
+        .alloc_opts = alloc_opts(
+            .size = sizeof(alloc_param),
+            .data = &alloc_param
+        ),
+    ); /* exceedes maximum */
+
+    ck_assert_ptr_null(vec);
+}
+END_TEST
+
+
 Suite * vector_other_suite(void)
 {
     Suite *s;
@@ -244,6 +327,9 @@ Suite * vector_other_suite(void)
     tcase_add_test(tc_core, test_vector_resize);
     tcase_add_test(tc_core, test_vector_alloc_failure);
     tcase_add_test(tc_core, test_vector_clone_failure);
+    tcase_add_test(tc_core, test_vector_resize_zeroed);
+    tcase_add_test(tc_core, test_vector_zero_init_failure);
+    tcase_add_test(tc_core, test_vector_resize_insert_batch_failure);
 
 #ifndef _WIN64
     /*